@@ -0,0 +1,32 @@
+# - Try to find LZ4
+#
+# Once done this will define
+#
+#  LZ4_FOUND - system has LZ4
+#  LZ4_INCLUDE_DIRS - the LZ4 include directory
+#  LZ4_LIBRARIES - Link these to use LZ4
+#
+
+find_path(
+    LZ4_INCLUDE_DIRS
+    NAMES lz4frame.h
+    HINTS ${LZ4_INCLUDE_DIRS}
+)
+
+find_library(
+    LZ4_LIBRARIES
+    NAMES lz4
+    HINTS ${LZ4_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(
+    LZ4
+    DEFAULT_MSG
+    LZ4_LIBRARIES
+    LZ4_INCLUDE_DIRS
+)
+
+if(LZ4_FOUND)
+    mark_as_advanced(LZ4_LIBRARIES LZ4_INCLUDE_DIRS)
+endif()
@@ -28,6 +28,7 @@ option (BUILD_COVERAGE          "Compile to collect code coverage reports"
 option (BUILD_ALL               "Build client, server, lib, preload, shrinkwrap, unit tests"       OFF)
 
 option (ENABLE_ASAN             "Enable the Address Sanitizer"                                     OFF)
+option (ENABLE_ZSTD_LZ4         "Support zstd and lz4 compression, requires libzstd and liblz4"    OFF)
 
 option (INSTALL_UNITTESTS       "Install the unit test binary (mainly for packaging)"              OFF)
 option (INSTALL_UNITTESTS_DEBUG "Install the unit test debug binary"                               OFF)
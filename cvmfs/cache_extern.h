@@ -342,6 +342,9 @@ class ExternalQuotaManager : public QuotaManager {
   virtual uint64_t GetSize();
   virtual uint64_t GetSizePinned();
   virtual uint64_t GetCleanupRate(uint64_t period_s);
+  virtual EvictionStatistics GetEvictionStatistics() {
+    return EvictionStatistics();
+  }
 
   virtual void Spawn() { }
   virtual pid_t GetPid() { return cache_mgr_->pid_plugin(); }
@@ -58,8 +58,10 @@
 #include "quota.h"
 #include "shortstring.h"
 #include "statistics.h"
+#include "uring.h"
 #include "util/atomic.h"
 #include "util/logging.h"
+#include "util/mutex.h"
 #include "util/platform.h"
 #include "util/posix.h"
 #include "util/smalloc.h"
@@ -110,6 +112,13 @@ atomic_int32 CallGuard::global_drainout_ = 0;
 const uint64_t PosixCacheManager::kBigFile = 25 * 1024 * 1024;  // 25M
 
 
+PosixCacheManager::~PosixCacheManager() {
+  for (unsigned i = 0; i < uring_pool_.size(); ++i)
+    delete uring_pool_[i];
+  pthread_mutex_destroy(&lock_uring_pool_);
+}
+
+
 int PosixCacheManager::AbortTxn(void *txn) {
   Transaction *transaction = reinterpret_cast<Transaction *>(txn);
   LogCvmfs(kLogCache, kLogDebug, "abort %s", transaction->tmp_path.c_str());
@@ -137,6 +146,37 @@ bool PosixCacheManager::AcquireQuotaManager(QuotaManager *quota_mgr) {
 }
 
 
+/**
+ * Returns NULL if all io_uring instances are in use or if a new instance cannot
+ * be created, e.g. due to file descriptor or memlock limits.
+ */
+IoUring *PosixCacheManager::AcquireUring() {
+  {
+    MutexLockGuard guard(&lock_uring_pool_);
+    if (!uring_pool_.empty()) {
+      IoUring *ring = uring_pool_.back();
+      uring_pool_.pop_back();
+      return ring;
+    }
+    if (num_urings_ >= kMaxUrings)
+      return NULL;
+    num_urings_++;
+  }
+  IoUring *ring = IoUring::Create(kUringDepth);
+  if (ring == NULL) {
+    MutexLockGuard guard(&lock_uring_pool_);
+    num_urings_--;
+  }
+  return ring;
+}
+
+
+void PosixCacheManager::ReleaseUring(IoUring *ring) {
+  MutexLockGuard guard(&lock_uring_pool_);
+  uring_pool_.push_back(ring);
+}
+
+
 int PosixCacheManager::Close(int fd) {
   int retval = do_refcount_ ? fd_mgr_->Close(fd) : close(fd);
   if (retval != 0)
@@ -151,6 +191,15 @@ int PosixCacheManager::CommitTxn(void *txn) {
   LogCvmfs(kLogCache, kLogDebug, "commit %s %s",
            transaction->final_path.c_str(), transaction->tmp_path.c_str());
 
+  // Files with an unexpected size take the slow path to the quarantine
+  if (use_io_uring_ && !alien_cache_ &&
+      (rename_workaround_ != kRenameLink) &&
+      ((transaction->expected_size == kSizeUnknown) ||
+       (transaction->size == transaction->expected_size)))
+  {
+    return CommitTxnUring(transaction);
+  }
+
   result = Flush(transaction);
   close(transaction->fd);
   if (result < 0) {
@@ -228,6 +277,91 @@ int PosixCacheManager::CommitTxn(void *txn) {
   return result;
 }
 
+
+/**
+ * Writes the remaining buffer, closes the file descriptor, and renames the
+ * file into the cache as a single chain of linked io_uring operations.  Unlike
+ * in CommitTxn(), files to be pinned are pinned before they are written.
+ */
+int PosixCacheManager::CommitTxnUring(Transaction *transaction) {
+  const bool is_pinned = (transaction->label.flags & kLabelPinned) ||
+                         (transaction->label.flags & kLabelCatalog);
+  if (is_pinned) {
+    bool retval = quota_mgr_->Pin(
+      transaction->id, transaction->size, transaction->label.GetDescription(),
+      (transaction->label.flags & kLabelCatalog));
+    if (!retval) {
+      LogCvmfs(kLogCache, kLogDebug, "commit failed: cannot pin %s",
+               transaction->id.ToString().c_str());
+      close(transaction->fd);
+      unlink(transaction->tmp_path.c_str());
+      transaction->~Transaction();
+      atomic_dec32(&no_inflight_txns_);
+      return -ENOSPC;
+    }
+  }
+
+  vector<int> results;
+  int result = -ENOSYS;
+  IoUring *ring = AcquireUring();
+  if (ring != NULL) {
+    if (transaction->buf_pos > 0) {
+      ring->PrepWrite(transaction->fd, transaction->buffer,
+                      transaction->buf_pos,
+                      transaction->size - transaction->buf_pos);
+      ring->Link();
+    }
+    ring->PrepClose(transaction->fd);
+    ring->Link();
+    ring->PrepRename(transaction->tmp_path.c_str(),
+                     transaction->final_path.c_str());
+    result = ring->Submit(&results);
+    ReleaseUring(ring);
+  }
+
+  if (result < 0) {
+    // Nothing happened, the file descriptor is still open
+    result = Flush(transaction);
+    close(transaction->fd);
+    if (result == 0) {
+      result = Rename(transaction->tmp_path.c_str(),
+                      transaction->final_path.c_str());
+    }
+  } else {
+    // The first failed operation cancels the rest of the chain
+    unsigned i = 0;
+    if (transaction->buf_pos > 0) {
+      const int written = results[i++];
+      if (static_cast<unsigned>(written) != transaction->buf_pos)
+        result = (written < 0) ? written : -EIO;
+    }
+    const int result_close = results[i++];
+    if (result_close == -ECANCELED)
+      close(transaction->fd);
+    else if ((result == 0) && (result_close < 0))
+      result = result_close;
+    if (result == 0)
+      result = results[i];
+  }
+
+  if (result < 0) {
+    LogCvmfs(kLogCache, kLogDebug, "commit failed: %s", strerror(-result));
+    unlink(transaction->tmp_path.c_str());
+    if (is_pinned)
+      quota_mgr_->Remove(transaction->id);
+  } else if (transaction->label.flags & kLabelVolatile) {
+    quota_mgr_->InsertVolatile(transaction->id, transaction->size,
+                               transaction->label.GetDescription());
+  } else if (!is_pinned) {
+    quota_mgr_->Insert(transaction->id, transaction->size,
+                       transaction->label.GetDescription());
+  }
+  transaction->~Transaction();
+  atomic_dec32(&no_inflight_txns_);
+  return result;
+}
+
+
 bool PosixCacheManager::InitCacheDirectory(const string &cache_path) {
   FileSystemInfo fs_info = GetFileSystemInfo(cache_path);
 
@@ -273,13 +407,22 @@ PosixCacheManager *PosixCacheManager::Create(
   const string &cache_path,
   const bool alien_cache,
   const RenameWorkarounds rename_workaround,
-  const bool do_refcount)
+  const bool do_refcount,
+  const bool use_io_uring)
 {
   UniquePtr<PosixCacheManager> cache_manager(
     new PosixCacheManager(cache_path, alien_cache, do_refcount));
   assert(cache_manager.IsValid());
 
   cache_manager->rename_workaround_ = rename_workaround;
+  if (use_io_uring) {
+    if (IoUring::IsAvailable()) {
+      cache_manager->use_io_uring_ = true;
+    } else {
+      LogCvmfs(kLogCache, kLogDebug | kLogSyslogWarn,
+               "io_uring not supported by the kernel, using blocking I/O");
+    }
+  }
 
   bool result_ = cache_manager->InitCacheDirectory(cache_path);
   if (!result_) {
@@ -503,6 +646,11 @@ int PosixCacheManager::Readahead(int fd) {
   if (is_tmpfs()) {
     return 0;
   }
+  if (use_io_uring_) {
+    const int retval = ReadaheadUring(fd);
+    if (retval != -ENOSYS)
+      return retval;
+  }
   do {
     nbytes = Pread(fd, buf, 4096, pos);
     pos += nbytes;
@@ -514,6 +662,54 @@ int PosixCacheManager::Readahead(int fd) {
 }
 
 
+/**
+ * Like Readahead() but with kUringDepth reads per system call.  Returns -ENOSYS
+ * if no io_uring instance is available or if the submission fails, in which
+ * case the caller falls back to pread().
+ */
+int PosixCacheManager::ReadaheadUring(int fd) {
+  const unsigned kBlockSize = 4096;
+  IoUring *ring = AcquireUring();
+  if (ring == NULL)
+    return -ENOSYS;
+  unsigned char *buf =
+    reinterpret_cast<unsigned char *>(smalloc(kUringDepth * kBlockSize));
+  vector<int> results;
+  int result = 0;
+  uint64_t pos = 0;
+  bool eof = false;
+  while (!eof) {
+    for (unsigned i = 0; i < kUringDepth; ++i) {
+      ring->PrepRead(fd, buf + i * kBlockSize, kBlockSize,
+                     pos + i * kBlockSize);
+    }
+    result = ring->Submit(&results);
+    if (result < 0) {
+      // Let the caller read ahead with pread() instead
+      result = -ENOSYS;
+      break;
+    }
+    for (unsigned i = 0; i < results.size(); ++i) {
+      if (results[i] < 0) {
+        result = results[i];
+        eof = true;
+        break;
+      }
+      pos += results[i];
+      if (static_cast<unsigned>(results[i]) != kBlockSize) {
+        eof = true;
+        break;
+      }
+    }
+  }
+  free(buf);
+  ReleaseUring(ring);
+  LogCvmfs(kLogCache, kLogDebug, "read-ahead %d, %" PRIu64 " (io_uring)",
+           fd, pos);
+  return result;
+}
+
+
 int PosixCacheManager::Reset(void *txn) {
   Transaction *transaction = reinterpret_cast<Transaction *>(txn);
   transaction->buf_pos = 0;
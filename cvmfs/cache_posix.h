@@ -5,9 +5,11 @@
 #ifndef CVMFS_CACHE_POSIX_H_
 #define CVMFS_CACHE_POSIX_H_
 
+#include <pthread.h>
 #include <stdint.h>
 #include <sys/types.h>
 
+#include <cassert>
 #include <map>
 #include <string>
 #include <vector>
@@ -33,6 +35,8 @@ namespace download {
 class DownloadManager;
 }
 
+class IoUring;
+
 /**
  * Cache manager implementation using a file system (cache directory) as a
  * backing storage.
@@ -40,6 +44,7 @@ class DownloadManager;
 class PosixCacheManager : public CacheManager {
   FRIEND_TEST(T_CacheManager, CommitTxnQuotaNotifications);
   FRIEND_TEST(T_CacheManager, CommitTxnRenameFail);
+  FRIEND_TEST(T_CacheManager, CommitTxnUring);
   FRIEND_TEST(T_CacheManager, Open);
   FRIEND_TEST(T_CacheManager, OpenFromTxn);
   FRIEND_TEST(T_CacheManager, OpenPinned);
@@ -66,6 +71,18 @@ class PosixCacheManager : public CacheManager {
    */
   static const uint64_t kBigFile;
 
+  /**
+   * Number of operations that are submitted at once to an io_uring instance,
+   * i.e. the number of 4k reads per system call during read-ahead
+   */
+  static const unsigned kUringDepth = 16;
+
+  /**
+   * Every io_uring instance takes a file descriptor and locked memory.  Callers
+   * that find all instances in use fall back to regular system calls.
+   */
+  static const unsigned kMaxUrings = 8;
+
   virtual CacheManagerIds id() { return kPosixCacheManager; }
   virtual std::string Describe();
 
@@ -73,8 +90,9 @@ class PosixCacheManager : public CacheManager {
     const std::string &cache_path,
     const bool alien_cache,
     const RenameWorkarounds rename_workaround = kRenameNormal,
-    const bool do_refcount = false);
-  virtual ~PosixCacheManager() { }
+    const bool do_refcount = false,
+    const bool use_io_uring = false);
+  virtual ~PosixCacheManager();
   virtual bool AcquireQuotaManager(QuotaManager *quota_mgr);
 
   virtual int Open(const LabeledObject &object);
@@ -107,6 +125,7 @@ class PosixCacheManager : public CacheManager {
   std::string cache_path() { return cache_path_; }
   bool is_tmpfs() { return is_tmpfs_; }
   bool do_refcount() const { return do_refcount_; }
+  bool use_io_uring() const { return use_io_uring_; }
 
  protected:
   virtual void *DoSaveState();
@@ -150,13 +169,21 @@ class PosixCacheManager : public CacheManager {
     , is_tmpfs_(false)
     , do_refcount_(do_refcount)
     , fd_mgr_(new FdRefcountMgr())
+    , use_io_uring_(false)
+    , num_urings_(0)
   {
     atomic_init32(&no_inflight_txns_);
+    int retval = pthread_mutex_init(&lock_uring_pool_, NULL);
+    assert(retval == 0);
   }
 
   std::string GetPathInCache(const shash::Any &id);
   int Rename(const char *oldpath, const char *newpath);
   int Flush(Transaction *transaction);
+  IoUring *AcquireUring();
+  void ReleaseUring(IoUring *ring);
+  int CommitTxnUring(Transaction *transaction);
+  int ReadaheadUring(int fd);
 
 
   std::string cache_path_;
@@ -197,6 +224,21 @@ class PosixCacheManager : public CacheManager {
    */
   bool do_refcount_;
   UniquePtr<FdRefcountMgr> fd_mgr_;
+
+  /**
+   * Commits transactions with a single linked write-close-rename submission
+   * and batches the reads of Readahead().  Switched off if the kernel does not
+   * support io_uring.
+   */
+  bool use_io_uring_;
+  /**
+   * io_uring instances are not thread-safe, every caller takes one from the
+   * pool and puts it back afterwards.  The pool grows to the number of
+   * concurrent callers, at most to kMaxUrings instances.
+   */
+  std::vector<IoUring *> uring_pool_;
+  unsigned num_urings_;
+  pthread_mutex_t lock_uring_pool_;
 };  // class PosixCacheManager
 
 #endif  // CVMFS_CACHE_POSIX_H_
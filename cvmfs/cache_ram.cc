@@ -30,7 +30,9 @@ RamCacheManager::RamCacheManager(
   uint64_t max_size,
   unsigned max_entries,
   MemoryKvStore::MemoryAllocator alloc,
-  perf::StatisticsTemplate statistics)
+  perf::StatisticsTemplate statistics,
+  unsigned num_nodes,
+  bool huge_pages)
   : max_size_(max_size)
   , fd_table_(max_entries, ReadOnlyHandle())
   // TODO(jblomer): the number of slots in the kv-stores should _not_ be the
@@ -38,11 +40,15 @@ RamCacheManager::RamCacheManager(
   , regular_entries_(max_entries,
                      alloc,
                      max_size,
-                     perf::StatisticsTemplate("kv.regular", statistics))
+                     perf::StatisticsTemplate("kv.regular", statistics),
+                     num_nodes,
+                     huge_pages)
   , volatile_entries_(max_entries,
                       alloc,
                       max_size,
-                      perf::StatisticsTemplate("kv.volatile", statistics))
+                      perf::StatisticsTemplate("kv.volatile", statistics),
+                      num_nodes,
+                      huge_pages)
   , counters_(statistics)
 {
   int retval = pthread_rwlock_init(&rwlock_, NULL);
@@ -346,7 +352,7 @@ int64_t RamCacheManager::CommitToKvStore(Transaction *transaction) {
   int64_t regular_size = regular_entries_.GetUsed();
   int64_t volatile_size = volatile_entries_.GetUsed();
   int64_t overrun = regular_size + volatile_size +
-    transaction->buffer.size - max_size_;
+    store->GetFootprint(transaction->buffer) - max_size_;
 
   if (overrun > 0) {
     // if we're going to clean the cache, try to remove at least 25%
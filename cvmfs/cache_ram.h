@@ -103,11 +103,17 @@ class RamCacheManager : public CacheManager {
   virtual CacheManagerIds id() { return kRamCacheManager; }
   virtual std::string Describe();
 
+  /**
+   * With num_nodes > 1, the heap allocator uses a heap per NUMA node, see
+   * MemoryKvStore.
+   */
   RamCacheManager(
     uint64_t max_size,
     unsigned max_entries,
     MemoryKvStore::MemoryAllocator alloc,
-    perf::StatisticsTemplate statistics);
+    perf::StatisticsTemplate statistics,
+    unsigned num_nodes = 1,
+    bool huge_pages = false);
 
   virtual ~RamCacheManager();
 
@@ -108,10 +108,10 @@ int64_t StreamingCacheManager::Stream(
   } else {
     url = "/data/" + info.object_id.MakePath();
   }
-  bool is_zipped = info.label.zip_algorithm == zlib::kZlibDefault;
-
-  download::JobInfo download_job(&url, is_zipped, true /* probe_hosts */,
+  download::JobInfo download_job(&url, false /* compressed */,
+                                 true /* probe_hosts */,
                                  &info.object_id, &sink);
+  download_job.SetCompressionAlgorithm(info.label.zip_algorithm);
   download_job.SetExtraInfo(&info.label.path);
   download_job.SetRangeOffset(info.label.range_offset);
   download_job.SetRangeSize(static_cast<int64_t>(info.label.size));
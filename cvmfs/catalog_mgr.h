@@ -23,6 +23,7 @@
 #include "file_chunk.h"
 #include "statistics.h"
 #include "util/atomic.h"
+#include "util/concurrency.h"
 #include "util/logging.h"
 
 class XattrList;
@@ -219,6 +220,14 @@ class AbstractCatalogManager : public SingleCopy {
                                 shash::Any   *catalog_hash) = 0;
   virtual void UnloadCatalog(const CatalogT *catalog) { }
   virtual void ActivateCatalog(CatalogT *catalog) { }
+  /**
+   * Called without holding the catalog lock before the nested catalog with the
+   * given hash gets mounted.  Derived classes can use it to download the
+   * catalog in advance, so that the write lock is only held for attaching the
+   * catalog.  Must not modify any state shared with LoadCatalog().
+   */
+  virtual void StageCatalog(const PathString &mountpoint,
+                            const shash::Any &hash) { }
   const std::vector<CatalogT*>& GetCatalogs() const { return catalogs_; }
 
   /**
@@ -240,6 +249,9 @@ class AbstractCatalogManager : public SingleCopy {
                     const CatalogT *entry_point,
                     bool can_listing,
                     CatalogT **leaf_catalog);
+  void UpgradeLock(const PathString &path,
+                   const CatalogT *entry_point,
+                   bool is_listable);
 
   CatalogT *LoadFreeCatalog(const PathString &mountpoint,
                             const shash::Any &hash);
@@ -254,22 +266,22 @@ class AbstractCatalogManager : public SingleCopy {
 
   CatalogT *FindCatalog(const PathString &path) const;
 
-  inline void ReadLock() const {
-    int retval = pthread_rwlock_rdlock(rwlock_);
-    assert(retval == 0);
-  }
-  inline void WriteLock() const {
-    int retval = pthread_rwlock_wrlock(rwlock_);
-    assert(retval == 0);
-  }
-  inline void Unlock() const {
-    int retval = pthread_rwlock_unlock(rwlock_);
-    assert(retval == 0);
-  }
+  /**
+   * Lookups only take the read lock, which does not touch a shared cache line.
+   * The write lock is taken for attaching and detaching catalogs.
+   */
+  inline void ReadLock() const { rwlock_->ReadLock(); }
+  inline void WriteLock() const { rwlock_->WriteLock(); }
+  inline void Unlock() const { rwlock_->Unlock(); }
   virtual void EnforceSqliteMemLimit();
 
  private:
   void CheckInodeWatermark();
+  bool FindNextNested(const PathString &path,
+                      const CatalogT *parent,
+                      bool is_listable,
+                      PathString *nested_mountpoint,
+                      shash::Any *nested_hash);
 
   /**
    * The flat list of all attached catalogs.
@@ -303,7 +315,7 @@ class AbstractCatalogManager : public SingleCopy {
   uint64_t incarnation_;
   // TODO(molina) we could just add an atomic global counter instead
   InodeAnnotation *inode_annotation_;  /**< applied to all catalogs */
-  pthread_rwlock_t *rwlock_;
+  ShardedRwLock *rwlock_;
   Statistics statistics_;
   pthread_key_t pkey_sqlitemem_;
   OwnerMap uid_map_;
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "cache_posix.h"
+#include "catalog_prefetch.h"
 #include "crypto/signature.h"
 #include "fetch.h"
 #include "manifest.h"
@@ -32,6 +33,12 @@ void ClientCatalogManager::ActivateCatalog(Catalog *catalog) {
     all_inodes_ = counters.GetAllEntries();
   }
   loaded_inodes_ += counters.GetSelfEntries();
+  if (prefetcher_ != NULL) {
+    prefetcher_->OnMount(catalog->mountpoint(), catalog->hash(),
+                         catalog->ListNestedCatalogs());
+  }
+  if (md_snapshot_ != NULL)
+    md_snapshot_->OnMount(catalog);
 }
 
 
@@ -39,6 +46,8 @@ ClientCatalogManager::ClientCatalogManager(MountPoint *mountpoint)
   : AbstractCatalogManager<Catalog>(mountpoint->statistics())
   , repo_name_(mountpoint->fqrn())
   , fetcher_(mountpoint->fetcher())
+  , prefetcher_(mountpoint->catalog_prefetcher())
+  , md_snapshot_(NULL)
   , signature_mgr_(mountpoint->signature_mgr())
   , workspace_(mountpoint->file_system()->workspace())
   , offline_mode_(false)
@@ -77,6 +86,37 @@ Catalog *ClientCatalogManager::CreateCatalog(
 }
 
 
+/**
+ * The snapshot is created after the root catalog has been mounted.  Catalogs
+ * that are already attached are handed to the snapshot right away.
+ */
+void ClientCatalogManager::SetMetadataSnapshot(MetadataSnapshot *snapshot) {
+  WriteLock();
+  md_snapshot_ = snapshot;
+  const vector<Catalog *> &catalogs = GetCatalogs();
+  for (unsigned i = 0; i < catalogs.size(); ++i)
+    md_snapshot_->OnMount(catalogs[i]);
+  Unlock();
+}
+
+
+void ClientCatalogManager::ListCatalogInodes(
+  vector<MetadataSnapshot::CatalogInodes> *result)
+{
+  result->clear();
+  ReadLock();
+  const vector<Catalog *> &catalogs = GetCatalogs();
+  for (unsigned i = 0; i < catalogs.size(); ++i) {
+    const InodeRange range = catalogs[i]->inode_range();
+    if (range.IsDummy())
+      continue;
+    result->push_back(MetadataSnapshot::CatalogInodes(
+      catalogs[i]->hash(), catalogs[i]->GetMangledInode(0, 0), range.size));
+  }
+  Unlock();
+}
+
+
 shash::Any ClientCatalogManager::GetRootHash() {
   ReadLock();
   shash::Any result = mounted_catalogs_[PathString("", 0)];
@@ -279,6 +319,30 @@ LoadError ClientCatalogManager::LoadCatalogCas(
 }
 
 
+/**
+ * Downloads a nested catalog into the cache while no catalog lock is held.  The
+ * following LoadCatalog() under the write lock then opens the cached copy.  If
+ * another thread mounts the same catalog in the meantime, the downloads are
+ * collapsed by the fetcher.
+ */
+void ClientCatalogManager::StageCatalog(
+  const PathString &mountpoint,
+  const shash::Any &hash)
+{
+  CacheManager::Label label;
+  label.path = repo_name_ + ":" + mountpoint.ToString() +
+               " (" + hash.ToString() + ")";
+  label.flags = CacheManager::kLabelCatalog;
+  int fd = fetcher_->Fetch(CacheManager::LabeledObject(hash, label));
+  if (fd < 0) {
+    LogCvmfs(kLogCache, kLogDebug, "failed to stage catalog %s (%d)",
+             label.path.c_str(), fd);
+    return;
+  }
+  fetcher_->cache_mgr()->Close(fd);
+}
+
+
 void ClientCatalogManager::UnloadCatalog(const Catalog *catalog) {
   LogCvmfs(kLogCache, kLogDebug, "unloading catalog %s",
            catalog->mountpoint().c_str());
@@ -11,10 +11,12 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "backoff.h"
 #include "crypto/hash.h"
 #include "manifest_fetch.h"
+#include "md_snapshot.h"
 #include "shortstring.h"
 
 class CacheManager;
@@ -32,6 +34,8 @@ class SignatureManager;
 
 namespace catalog {
 
+class CatalogPrefetcher;
+
 /**
  * A catalog manager that uses a Fetcher to get file catalgs in the form of
  * (virtual) file descriptors from a cache manager.  Sqlite has a path based
@@ -60,6 +64,9 @@ class ClientCatalogManager : public AbstractCatalogManager<Catalog> {
 
   bool IsRevisionBlacklisted();
 
+  void SetMetadataSnapshot(MetadataSnapshot *snapshot);
+  void ListCatalogInodes(std::vector<MetadataSnapshot::CatalogInodes> *result);
+
   bool offline_mode() const { return offline_mode_; }
   uint64_t all_inodes() const { return all_inodes_; }
   uint64_t loaded_inodes() const { return loaded_inodes_; }
@@ -77,6 +84,7 @@ class ClientCatalogManager : public AbstractCatalogManager<Catalog> {
                                   const shash::Any  &catalog_hash,
                                   catalog::Catalog *parent_catalog);
   void ActivateCatalog(catalog::Catalog *catalog);
+  void StageCatalog(const PathString &mountpoint, const shash::Any &hash);
 
  private:
   LoadError LoadCatalogCas(const shash::Any &hash,
@@ -94,6 +102,14 @@ class ClientCatalogManager : public AbstractCatalogManager<Catalog> {
 
   std::string repo_name_;
   cvmfs::Fetcher *fetcher_;
+  /**
+   * Downloads nested catalogs ahead of time, NULL if disabled
+   */
+  CatalogPrefetcher *prefetcher_;
+  /**
+   * Restores cached meta-data of attached catalogs, NULL if disabled
+   */
+  MetadataSnapshot *md_snapshot_;
   signature::SignatureManager *signature_mgr_;
   std::string workspace_;
   bool offline_mode_;  /**< cached copy used because there is no network */
@@ -36,11 +36,8 @@ AbstractCatalogManager<CatalogT>::AbstractCatalogManager(
   has_authz_cache_ = false;
   inode_annotation_ = NULL;
   incarnation_ = 0;
-  rwlock_ =
-    reinterpret_cast<pthread_rwlock_t *>(smalloc(sizeof(pthread_rwlock_t)));
-  int retval = pthread_rwlock_init(rwlock_, NULL);
-  assert(retval == 0);
-  retval = pthread_key_create(&pkey_sqlitemem_, NULL);
+  rwlock_ = new ShardedRwLock();
+  int retval = pthread_key_create(&pkey_sqlitemem_, NULL);
   assert(retval == 0);
 }
 
@@ -48,8 +45,7 @@ template <class CatalogT>
 AbstractCatalogManager<CatalogT>::~AbstractCatalogManager() {
   DetachAll();
   pthread_key_delete(pkey_sqlitemem_);
-  pthread_rwlock_destroy(rwlock_);
-  free(rwlock_);
+  delete rwlock_;
 }
 
 template <class CatalogT>
@@ -270,8 +266,7 @@ bool AbstractCatalogManager<CatalogT>::LookupPath(const PathString &path,
   if (!found && MountSubtree(path, best_fit, false /* is_listable */, NULL)) {
     LogCvmfs(kLogCatalog, kLogDebug, "looking up '%s' in a nested catalog",
              path.c_str());
-    Unlock();
-    WriteLock();
+    UpgradeLock(path, best_fit, false /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(path);
     assert(best_fit != NULL);
@@ -371,8 +366,7 @@ bool AbstractCatalogManager<CatalogT>::LookupNested(
   CatalogT *best_fit = FindCatalog(catalog_path);
   CatalogT *catalog = best_fit;
   if (MountSubtree(catalog_path, best_fit, false /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(catalog_path, best_fit, false /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(catalog_path);
     result =
@@ -434,8 +428,7 @@ bool AbstractCatalogManager<CatalogT>::ListCatalogSkein(
   CatalogT *catalog = best_fit;
   // True if there is an available nested catalog
   if (MountSubtree(test, best_fit, false /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(test, best_fit, false /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(test);
     result = MountSubtree(test, best_fit, false /* is_listable */, &catalog);
@@ -490,8 +483,7 @@ bool AbstractCatalogManager<CatalogT>::LookupXattrs(
   CatalogT *best_fit = FindCatalog(path);
   CatalogT *catalog = best_fit;
   if (MountSubtree(path, best_fit, false /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(path, best_fit, false /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(path);
     result = MountSubtree(path, best_fit, false /* is_listable */, &catalog);
@@ -528,8 +520,7 @@ bool AbstractCatalogManager<CatalogT>::Listing(const PathString &path,
   CatalogT *best_fit = FindCatalog(path);
   CatalogT *catalog = best_fit;
   if (MountSubtree(path, best_fit, true /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(path, best_fit, true /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(path);
     result = MountSubtree(path, best_fit, true /* is_listable */, &catalog);
@@ -565,8 +556,7 @@ bool AbstractCatalogManager<CatalogT>::ListingStat(const PathString &path,
   CatalogT *best_fit = FindCatalog(path);
   CatalogT *catalog = best_fit;
   if (MountSubtree(path, best_fit, true /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(path, best_fit, true /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(path);
     result = MountSubtree(path, best_fit, true /* is_listable */, &catalog);
@@ -605,8 +595,7 @@ bool AbstractCatalogManager<CatalogT>::ListFileChunks(
   CatalogT *best_fit = FindCatalog(path);
   CatalogT *catalog = best_fit;
   if (MountSubtree(path, best_fit, false /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(path, best_fit, false /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(path);
     result = MountSubtree(path, best_fit, false /* is_listable */, &catalog);
@@ -641,8 +630,7 @@ catalog::Counters AbstractCatalogManager<CatalogT>::LookupCounters(
   CatalogT *best_fit = FindCatalog(catalog_path);
   CatalogT *catalog = best_fit;
   if (MountSubtree(catalog_path, best_fit, false /* is_listable */, NULL)) {
-    Unlock();
-    WriteLock();
+    UpgradeLock(catalog_path, best_fit, false /* is_listable */);
     // Check again to avoid race
     best_fit = FindCatalog(catalog_path);
     result =
@@ -800,30 +788,22 @@ bool AbstractCatalogManager<CatalogT>::IsAttached(const PathString &root_path,
 
 
 /**
- * Recursively mounts all nested catalogs required to serve a path.
- * If leaf_catalog is NULL, just indicate if it is necessary to load a
- * nested catalog for the given path.
- * The final leaf nested catalog is returned.
+ * Finds the nested catalog of parent on the way to path, if any.
  * The is_listable parameter is relevant if path is a nested catalog.  Only
  * if is_listable is true, the nested catalog will be used; otherwise the parent
  * with the transaction point is sufficient.
  */
 template <class CatalogT>
-bool AbstractCatalogManager<CatalogT>::MountSubtree(
+bool AbstractCatalogManager<CatalogT>::FindNextNested(
   const PathString &path,
-  const CatalogT *entry_point,
+  const CatalogT *parent,
   bool is_listable,
-  CatalogT **leaf_catalog)
+  PathString *nested_mountpoint,
+  shash::Any *nested_hash)
 {
-  bool result = true;
-  CatalogT *parent = (entry_point == NULL) ?
-                     GetRootCatalog() : const_cast<CatalogT *>(entry_point);
-  assert(path.StartsWith(parent->mountpoint()));
-
   unsigned path_len = path.GetLength();
 
   // Try to find path as a super string of nested catalog mount points
-  perf::Inc(statistics_.n_nested_listing);
   typedef typename CatalogT::NestedCatalogList NestedCatalogList;
   const NestedCatalogList& nested_catalogs =
     parent->ListNestedCatalogs();
@@ -841,26 +821,61 @@ bool AbstractCatalogManager<CatalogT>::MountSubtree(
 
       // Found a nested catalog transition point
       if (!is_listable && (path_len == mountpoint_len))
-        break;
-
-      if (leaf_catalog == NULL)
-        return true;
-      CatalogT *new_nested;
-      LogCvmfs(kLogCatalog, kLogDebug, "load nested catalog at %s",
-               i->mountpoint.c_str());
-      // prevent endless recursion with corrupted catalogs
-      // (due to reloading root)
-      if (i->hash.IsNull())
-        return false;
-      new_nested = MountCatalog(i->mountpoint, i->hash, parent);
-      if (!new_nested)
         return false;
 
-      result = MountSubtree(path, new_nested, is_listable, &parent);
-      break;
+      *nested_mountpoint = i->mountpoint;
+      *nested_hash = i->hash;
+      return true;
     }
   }
 
+  return false;
+}
+
+
+/**
+ * Recursively mounts all nested catalogs required to serve a path.
+ * If leaf_catalog is NULL, just indicate if it is necessary to load a
+ * nested catalog for the given path.
+ * The final leaf nested catalog is returned.
+ * The is_listable parameter is relevant if path is a nested catalog.  Only
+ * if is_listable is true, the nested catalog will be used; otherwise the parent
+ * with the transaction point is sufficient.
+ */
+template <class CatalogT>
+bool AbstractCatalogManager<CatalogT>::MountSubtree(
+  const PathString &path,
+  const CatalogT *entry_point,
+  bool is_listable,
+  CatalogT **leaf_catalog)
+{
+  bool result = true;
+  CatalogT *parent = (entry_point == NULL) ?
+                     GetRootCatalog() : const_cast<CatalogT *>(entry_point);
+  assert(path.StartsWith(parent->mountpoint()));
+
+  perf::Inc(statistics_.n_nested_listing);
+  PathString nested_mountpoint;
+  shash::Any nested_hash;
+  if (FindNextNested(path, parent, is_listable,
+                     &nested_mountpoint, &nested_hash))
+  {
+    if (leaf_catalog == NULL)
+      return true;
+    CatalogT *new_nested;
+    LogCvmfs(kLogCatalog, kLogDebug, "load nested catalog at %s",
+             nested_mountpoint.c_str());
+    // prevent endless recursion with corrupted catalogs
+    // (due to reloading root)
+    if (nested_hash.IsNull())
+      return false;
+    new_nested = MountCatalog(nested_mountpoint, nested_hash, parent);
+    if (!new_nested)
+      return false;
+
+    result = MountSubtree(path, new_nested, is_listable, &parent);
+  }
+
   if (leaf_catalog == NULL)
     return false;
   *leaf_catalog = parent;
@@ -868,6 +883,33 @@ bool AbstractCatalogManager<CatalogT>::MountSubtree(
 }
 
 
+/**
+ * Trades the read lock for the write lock when MountSubtree() reported that
+ * the path requires a nested catalog to be mounted.  In between, the next
+ * nested catalog is staged without holding any lock, so that a slow catalog
+ * download does not stall all the other lookups.  Callers must search for their
+ * catalog again after the upgrade.
+ */
+template <class CatalogT>
+void AbstractCatalogManager<CatalogT>::UpgradeLock(
+  const PathString &path,
+  const CatalogT *entry_point,
+  bool is_listable)
+{
+  PathString nested_mountpoint;
+  shash::Any nested_hash;
+  const bool has_nested = FindNextNested(
+    path, (entry_point == NULL) ? GetRootCatalog() : entry_point, is_listable,
+    &nested_mountpoint, &nested_hash);
+  Unlock();
+
+  if (has_nested && !nested_hash.IsNull())
+    StageCatalog(nested_mountpoint, nested_hash);
+
+  WriteLock();
+}
+
+
 /**
  * Load a catalog file and attach it to the tree of Catalog objects.
  * Loading of catalogs is implemented by derived classes.
@@ -13,6 +13,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <string>
+#include <vector>
 
 #include "catalog_balancer.h"
 #include "catalog_rw.h"
@@ -21,6 +22,7 @@
 #include "upload.h"
 #include "util/exception.h"
 #include "util/logging.h"
+#include "util/platform.h"
 #include "util/posix.h"
 #include "util/smalloc.h"
 
@@ -53,21 +55,16 @@ WritableCatalogManager::WritableCatalogManager(
   , max_weight_(max_weight)
   , min_weight_(min_weight)
   , balance_weight_(max_weight / 2)
+  , snapshot_counters_(perf::StatisticsTemplate("publish", statistics))
 {
-  sync_lock_ =
-    reinterpret_cast<pthread_mutex_t *>(smalloc(sizeof(pthread_mutex_t)));
-  int retval = pthread_mutex_init(sync_lock_, NULL);
-  assert(retval == 0);
   catalog_processing_lock_ =
     reinterpret_cast<pthread_mutex_t *>(smalloc(sizeof(pthread_mutex_t)));
-  retval = pthread_mutex_init(catalog_processing_lock_, NULL);
+  int retval = pthread_mutex_init(catalog_processing_lock_, NULL);
   assert(retval == 0);
 }
 
 
 WritableCatalogManager::~WritableCatalogManager() {
-  pthread_mutex_destroy(sync_lock_);
-  free(sync_lock_);
   pthread_mutex_destroy(catalog_processing_lock_);
   free(catalog_processing_lock_);
 }
@@ -189,6 +186,8 @@ manifest::Manifest *WritableCatalogManager::CreateRepository(
  * Other than AbstractCatalogManager::FindCatalog() this mounts nested
  * catalogs if necessary and returns  WritableCatalog objects.
  * Furthermore it optionally returns the looked-up DirectoryEntry.
+ * Mounting changes the catalog tree, so the caller needs to hold the writer
+ * lock.
  *
  * @param path    the path to look for
  * @param result  the retrieved catalog (as a pointer)
@@ -222,11 +221,69 @@ bool WritableCatalogManager::FindCatalog(const string     &path,
 }
 
 
+/**
+ * Like FindCatalog() but for updates that can run concurrently with other
+ * updates.  Takes the catalog tree lock as a reader and locks the resulting
+ * catalog.  If a nested catalog needs to be mounted first, the tree lock is
+ * upgraded to the writer lock.  On success, the caller must release the
+ * catalog with ReleaseCatalog().  On failure, no lock is held.
+ */
+bool WritableCatalogManager::AcquireCatalog(const string     &path,
+                                            WritableCatalog **result,
+                                            DirectoryEntry   *dirent) {
+  const PathString ps_path(path);
+
+  ReadLock();
+  Catalog *best_fit =
+    AbstractCatalogManager<Catalog>::FindCatalog(ps_path);
+  assert(best_fit != NULL);
+  if (!best_fit->IsWritable()) {
+    Unlock();
+    return false;
+  }
+  WritableCatalog *catalog = static_cast<WritableCatalog *>(best_fit);
+  catalog->SyncLock();
+
+  if (MountSubtree(ps_path, best_fit, true /* is_listable */, NULL)) {
+    catalog->SyncUnlock();
+    UpgradeLock(ps_path, best_fit, true /* is_listable */);
+    if (!FindCatalog(path, &catalog, dirent)) {
+      Unlock();
+      return false;
+    }
+    catalog->SyncLock();
+    *result = catalog;
+    return true;
+  }
+
+  catalog::DirectoryEntry dummy;
+  if (NULL == dirent) {
+    dirent = &dummy;
+  }
+  if (!catalog->LookupPath(ps_path, dirent)) {
+    catalog->SyncUnlock();
+    Unlock();
+    return false;
+  }
+
+  *result = catalog;
+  return true;
+}
+
+
+void WritableCatalogManager::ReleaseCatalog(WritableCatalog *catalog) {
+  catalog->SyncUnlock();
+  Unlock();
+}
+
+
 WritableCatalog *WritableCatalogManager::GetHostingCatalog(
   const std::string &path)
 {
   WritableCatalog *result = NULL;
+  WriteLock();
   bool retval = FindCatalog(MakeRelativePath(path), &result, NULL);
+  Unlock();
   if (!retval) return NULL;
   return result;
 }
@@ -241,15 +298,14 @@ void WritableCatalogManager::RemoveFile(const std::string &path) {
   const string file_path = MakeRelativePath(path);
   const string parent_path = GetParentPath(file_path);
 
-  SyncLock();
   WritableCatalog *catalog;
-  if (!FindCatalog(parent_path, &catalog)) {
+  if (!AcquireCatalog(parent_path, &catalog)) {
     PANIC(kLogStderr, "catalog for file '%s' cannot be found",
           file_path.c_str());
   }
 
   catalog->RemoveEntry(file_path);
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 
@@ -262,10 +318,9 @@ void WritableCatalogManager::RemoveDirectory(const std::string &path) {
   const string directory_path = MakeRelativePath(path);
   const string parent_path = GetParentPath(directory_path);
 
-  SyncLock();
   WritableCatalog *catalog;
   DirectoryEntry parent_entry;
-  if (!FindCatalog(parent_path, &catalog, &parent_entry)) {
+  if (!AcquireCatalog(parent_path, &catalog, &parent_entry)) {
     PANIC(kLogStderr, "catalog for directory '%s' cannot be found",
           directory_path.c_str());
   }
@@ -281,9 +336,11 @@ void WritableCatalogManager::RemoveDirectory(const std::string &path) {
       reinterpret_cast<WritableCatalog *>(catalog->parent());
     parent_entry.set_is_nested_catalog_mountpoint(true);
     parent_entry.set_is_nested_catalog_root(false);
+    parent_catalog->SyncLock();
     parent_catalog->UpdateEntry(parent_entry, parent_path);
+    parent_catalog->SyncUnlock();
   }
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 /**
@@ -476,10 +533,9 @@ void WritableCatalogManager::AddDirectory(const DirectoryEntryBase &entry,
   string directory_path = parent_path + "/";
   directory_path.append(entry.name().GetChars(), entry.name().GetLength());
 
-  SyncLock();
   WritableCatalog *catalog;
   DirectoryEntry parent_entry;
-  if (!FindCatalog(parent_path, &catalog, &parent_entry)) {
+  if (!AcquireCatalog(parent_path, &catalog, &parent_entry)) {
     PANIC(kLogStderr, "catalog for directory '%s' cannot be found",
           directory_path.c_str());
   }
@@ -498,9 +554,11 @@ void WritableCatalogManager::AddDirectory(const DirectoryEntryBase &entry,
       reinterpret_cast<WritableCatalog *>(catalog->parent());
     parent_entry.set_is_nested_catalog_mountpoint(true);
     parent_entry.set_is_nested_catalog_root(false);
+    parent_catalog->SyncLock();
     parent_catalog->UpdateEntry(parent_entry, parent_path);
+    parent_catalog->SyncUnlock();
   }
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 /**
@@ -518,9 +576,8 @@ void WritableCatalogManager::AddFile(
   const string parent_path = MakeRelativePath(parent_directory);
   const string file_path   = entry.GetFullPath(parent_path);
 
-  SyncLock();
   WritableCatalog *catalog;
-  if (!FindCatalog(parent_path, &catalog)) {
+  if (!AcquireCatalog(parent_path, &catalog)) {
     PANIC(kLogStderr, "catalog for file '%s' cannot be found",
           file_path.c_str());
   }
@@ -544,7 +601,7 @@ void WritableCatalogManager::AddFile(
   }
 
   catalog->AddEntry(entry, xattrs, file_path, parent_path);
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 
@@ -564,9 +621,8 @@ void WritableCatalogManager::AddChunkedFile(
   const string parent_path = MakeRelativePath(parent_directory);
   const string file_path   = entry.GetFullPath(parent_path);
 
-  SyncLock();
   WritableCatalog *catalog;
-  if (!FindCatalog(parent_path, &catalog)) {
+  if (!AcquireCatalog(parent_path, &catalog)) {
     PANIC(kLogStderr, "catalog for file '%s' cannot be found",
           file_path.c_str());
   }
@@ -574,7 +630,7 @@ void WritableCatalogManager::AddChunkedFile(
   for (unsigned i = 0; i < file_chunks.size(); ++i) {
     catalog->AddFileChunk(file_path, *file_chunks.AtPtr(i));
   }
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 
@@ -625,9 +681,8 @@ void WritableCatalogManager::AddHardlinkGroup(
             file_mbyte_limit_, mbytes);
   }
 
-  SyncLock();
   WritableCatalog *catalog;
-  if (!FindCatalog(parent_path, &catalog)) {
+  if (!AcquireCatalog(parent_path, &catalog)) {
     PANIC(kLogStderr,
           "catalog for hardlink group containing '%s' cannot be found",
           parent_path.c_str());
@@ -661,23 +716,22 @@ void WritableCatalogManager::AddHardlinkGroup(
       }
     }
   }
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 
 void WritableCatalogManager::ShrinkHardlinkGroup(const string &remove_path) {
   const string relative_path = MakeRelativePath(remove_path);
 
-  SyncLock();
   WritableCatalog *catalog;
-  if (!FindCatalog(relative_path, &catalog)) {
+  if (!AcquireCatalog(relative_path, &catalog)) {
     PANIC(kLogStderr,
           "catalog for hardlink group containing '%s' cannot be found",
           remove_path.c_str());
   }
 
   catalog->IncLinkcount(relative_path, -1);
-  SyncUnlock();
+  ReleaseCatalog(catalog);
 }
 
 
@@ -698,10 +752,9 @@ void WritableCatalogManager::TouchDirectory(const DirectoryEntryBase &entry,
   const string entry_path = MakeRelativePath(directory_path);
   const string parent_path = GetParentPath(entry_path);
 
-  SyncLock();
   // find the catalog to be updated
   WritableCatalog *catalog;
-  if (!FindCatalog(parent_path, &catalog)) {
+  if (!AcquireCatalog(parent_path, &catalog)) {
     PANIC(kLogStderr, "catalog for entry '%s' cannot be found",
           entry_path.c_str());
   }
@@ -720,25 +773,39 @@ void WritableCatalogManager::TouchDirectory(const DirectoryEntryBase &entry,
   bool retval = catalog->LookupPath(transition_path,
                                     &potential_transition_point);
   assert(retval);
-  if (potential_transition_point.IsNestedCatalogMountpoint()) {
-    LogCvmfs(kLogCatalog, kLogVerboseMsg,
-             "updating transition point at %s", entry_path.c_str());
-
-    // find and mount nested catalog associated to this transition point
-    shash::Any nested_hash;
-    uint64_t nested_size;
-    retval = catalog->FindNested(transition_path, &nested_hash, &nested_size);
-    assert(retval);
-    Catalog *nested_catalog;
+  if (!potential_transition_point.IsNestedCatalogMountpoint()) {
+    ReleaseCatalog(catalog);
+    return;
+  }
+
+  LogCvmfs(kLogCatalog, kLogVerboseMsg,
+           "updating transition point at %s", entry_path.c_str());
+
+  // find and mount nested catalog associated to this transition point
+  shash::Any nested_hash;
+  uint64_t nested_size;
+  retval = catalog->FindNested(transition_path, &nested_hash, &nested_size);
+  assert(retval);
+  catalog->SyncUnlock();
+  Catalog *nested_catalog = NULL;
+  if (!IsAttached(transition_path, &nested_catalog)) {
+    // mounting changes the catalog tree and requires the writer lock
+    UpgradeLock(transition_path, catalog, true /* is_listable */);
+    if (!FindCatalog(parent_path, &catalog)) {
+      Unlock();
+      PANIC(kLogStderr, "catalog for entry '%s' cannot be found",
+            entry_path.c_str());
+    }
     nested_catalog = MountCatalog(transition_path, nested_hash, catalog);
     assert(nested_catalog != NULL);
-
-    // update nested catalog root in the child catalog
-    reinterpret_cast<WritableCatalog *>(nested_catalog)->
-      TouchEntry(entry, xattrs, entry_path);
   }
 
-  SyncUnlock();
+  // update nested catalog root in the child catalog
+  WritableCatalog *wr_nested_catalog =
+    static_cast<WritableCatalog *>(nested_catalog);
+  wr_nested_catalog->SyncLock();
+  wr_nested_catalog->TouchEntry(entry, xattrs, entry_path);
+  ReleaseCatalog(wr_nested_catalog);
 }
 
 
@@ -753,7 +820,7 @@ void WritableCatalogManager::CreateNestedCatalog(const std::string &mountpoint)
   const string nested_root_path = MakeRelativePath(mountpoint);
   const PathString ps_nested_root_path(nested_root_path);
 
-  SyncLock();
+  WriteLock();
   // Find the catalog currently containing the directory structure, which
   // will be represented as a new nested catalog and its root-entry/mountpoint
   // along the way
@@ -832,7 +899,7 @@ void WritableCatalogManager::CreateNestedCatalog(const std::string &mountpoint)
   wr_new_catalog->UpdateCounters();
   wr_new_catalog->delta_counters_ = save_counters;
 
-  SyncUnlock();
+  Unlock();
 }
 
 
@@ -851,7 +918,7 @@ void WritableCatalogManager::RemoveNestedCatalog(const string &mountpoint,
                                                  const bool merge) {
   const string nested_root_path = MakeRelativePath(mountpoint);
 
-  SyncLock();
+  WriteLock();
   // Find the catalog which should be removed
   WritableCatalog *nested_catalog = NULL;
   if (!FindCatalog(nested_root_path, &nested_catalog)) {
@@ -881,7 +948,7 @@ void WritableCatalogManager::RemoveNestedCatalog(const string &mountpoint,
 
   // Remove the catalog from internal data structures
   DetachCatalog(nested_catalog);
-  SyncUnlock();
+  Unlock();
 }
 
 
@@ -903,12 +970,12 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
   const string parent_path = GetParentPath(nested_root_path);
   const PathString nested_root_ps = PathString(nested_root_path);
 
-  SyncLock();
+  WriteLock();
 
   // Find the immediate parent catalog
   WritableCatalog *parent = NULL;
   if (!FindCatalog(parent_path, &parent)) {
-    SyncUnlock();  // this is needed for the unittest. otherwise they get stuck
+    Unlock();  // this is needed for the unittest. otherwise they get stuck
     PANIC(kLogStderr,
           "failed to swap nested catalog '%s': could not find parent '%s'",
           nested_root_path.c_str(), parent_path.c_str());
@@ -923,7 +990,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
     // that it has not been modified, get counters, and detach it.
     WritableCatalogList list;
     if (GetModifiedCatalogLeafsRecursively(old_attached_catalog, &list)) {
-      SyncUnlock();
+      Unlock();
       PANIC(kLogStderr,
             "failed to swap nested catalog '%s': already modified",
             nested_root_path.c_str());
@@ -939,7 +1006,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
     const bool old_found = parent->FindNested(nested_root_ps, &old_hash,
                                               &old_size);
     if (!old_found) {
-      SyncUnlock();
+      Unlock();
       PANIC(kLogStderr,
             "failed to swap nested catalog '%s': not found in parent",
             nested_root_path.c_str());
@@ -947,7 +1014,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
     UniquePtr<Catalog> old_free_catalog(
       LoadFreeCatalog(nested_root_ps, old_hash));
     if (!old_free_catalog.IsValid()) {
-      SyncUnlock();
+      Unlock();
       PANIC(kLogStderr,
             "failed to swap nested catalog '%s': failed to load old catalog",
             nested_root_path.c_str());
@@ -958,7 +1025,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
   // Load freely attached new catalog
   UniquePtr<Catalog> new_catalog(LoadFreeCatalog(nested_root_ps, new_hash));
   if (!new_catalog.IsValid()) {
-    SyncUnlock();
+    Unlock();
     PANIC(kLogStderr,
           "failed to swap nested catalog '%s': failed to load new catalog",
           nested_root_path.c_str());
@@ -969,7 +1036,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
   XattrList xattrs;
   const bool dirent_found = new_catalog->LookupPath(nested_root_ps, &dirent);
   if (!dirent_found) {
-    SyncUnlock();
+    Unlock();
     PANIC(kLogStderr,
           "failed to swap nested catalog '%s': missing dirent in new catalog",
           nested_root_path.c_str());
@@ -978,7 +1045,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
     const bool xattrs_found = new_catalog->LookupXattrsPath(nested_root_ps,
                                                             &xattrs);
     if (!xattrs_found) {
-      SyncUnlock();
+      Unlock();
       PANIC(kLogStderr,
             "failed to swap nested catalog '%s': missing xattrs in new catalog",
             nested_root_path.c_str());
@@ -1000,7 +1067,7 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
                                        new_catalog->GetCounters());
   delta.PopulateToParent(&parent->delta_counters_);
 
-  SyncUnlock();
+  Unlock();
 }
 
 
@@ -1010,15 +1077,14 @@ void WritableCatalogManager::SwapNestedCatalog(const string &mountpoint,
 bool WritableCatalogManager::IsTransitionPoint(const string &mountpoint) {
   const string path = MakeRelativePath(mountpoint);
 
-  SyncLock();
   WritableCatalog *catalog;
   DirectoryEntry entry;
-  if (!FindCatalog(path, &catalog, &entry)) {
+  if (!AcquireCatalog(path, &catalog, &entry)) {
     PANIC(kLogStderr, "catalog for directory '%s' cannot be found",
           path.c_str());
   }
   const bool result = entry.IsNestedCatalogRoot();
-  SyncUnlock();
+  ReleaseCatalog(catalog);
   return result;
 }
 
@@ -1029,18 +1095,21 @@ void WritableCatalogManager::PrecalculateListings() {
 
 
 void WritableCatalogManager::SetTTL(const uint64_t new_ttl) {
-  SyncLock();
-  reinterpret_cast<WritableCatalog *>(GetRootCatalog())->SetTTL(new_ttl);
-  SyncUnlock();
+  ReadLock();
+  WritableCatalog *root = static_cast<WritableCatalog *>(GetRootCatalog());
+  root->SyncLock();
+  root->SetTTL(new_ttl);
+  ReleaseCatalog(root);
 }
 
 
 bool WritableCatalogManager::SetVOMSAuthz(const std::string &voms_authz) {
   bool result;
-  SyncLock();
-  result = reinterpret_cast<WritableCatalog *>(
-    GetRootCatalog())->SetVOMSAuthz(voms_authz);
-  SyncUnlock();
+  ReadLock();
+  WritableCatalog *root = static_cast<WritableCatalog *>(GetRootCatalog());
+  root->SyncLock();
+  result = root->SetVOMSAuthz(voms_authz);
+  ReleaseCatalog(root);
   return result;
 }
 
@@ -1067,11 +1136,14 @@ bool WritableCatalogManager::Commit(const bool           stop_for_tweaks,
   }
 
   // do the actual catalog snapshotting and upload
+  const uint64_t start_ns = platform_monotonic_time_ns();
   CatalogInfo root_catalog_info;
   if (getenv("_CVMFS_SERIALIZED_CATALOG_PROCESSING_") == NULL)
     root_catalog_info = SnapshotCatalogs(stop_for_tweaks);
   else
     root_catalog_info = SnapshotCatalogsSerialized(stop_for_tweaks);
+  perf::Xadd(snapshot_counters_.sz_catalog_snapshot_time,
+             (platform_monotonic_time_ns() - start_ns) / 1000);
   if (spooler_->GetNumberOfErrors() > 0) {
     LogCvmfs(kLogCatalog, kLogStderr, "failed to commit catalogs");
     return false;
@@ -1093,8 +1165,9 @@ bool WritableCatalogManager::Commit(const bool           stop_for_tweaks,
 
 /**
  * Handles the snapshotting of dirty (i.e. modified) catalogs while trying to
- * parallelize the compression and upload as much as possible. We use a parallel
- * depth first post order tree traversal based on 'continuations'.
+ * parallelize the finalization, compression, and upload as much as possible.
+ * The catalog tree is processed as a dependency graph: a catalog can only be
+ * finalized once the content hashes of all its dirty children are known.
  *
  * The idea is as follows:
  *  1. find all leaf-catalogs (i.e. dirty catalogs with no dirty children)
@@ -1103,59 +1176,105 @@ bool WritableCatalogManager::Commit(const bool           stop_for_tweaks,
  *  2. annotate non-leaf catalogs with their number of dirty children
  *     --> a finished child will notify it's parent and decrement this number
  *         see WritableCatalogManager::CatalogUploadCallback()
- *  3. if a non-leaf catalog's dirty children number reaches 0, it is scheduled
- *     for processing as well (continuation)
+ *  3. if a non-leaf catalog's dirty children number reaches 0, it is queued
+ *     for finalization as well (continuation)
  *     --> the parallel processing walks bottom-up through the catalog tree
  *         see WritableCatalogManager::CatalogUploadCallback()
  *  4. when the root catalog is reached, we notify the main thread and return
  *     --> done through a Future<> in WritableCatalogManager::SnapshotCatalogs
  *
- * Note: The catalog finalisation (see WritableCatalogManager::FinalizeCatalog)
- *       happens in a worker thread (i.e. the callback method) for non-leaf
- *       catalogs.
- *
- * TODO(rmeusel): since all leaf catalogs are finalized in the main thread, we
- *                sacrifice some potential concurrency for simplicity.
+ * Queued catalogs are finalized (see WritableCatalogManager::FinalizeCatalog)
+ * by a pool of finalizer threads, which then hand them to the spooler for
+ * compression, hashing, and upload.  Independent catalogs, such as the leafs or
+ * siblings whose children are done, are thus processed concurrently.  With
+ * stop_for_tweaks, there is a single finalizer thread so that the tweaks are
+ * requested one catalog at a time.
  */
 WritableCatalogManager::CatalogInfo WritableCatalogManager::SnapshotCatalogs(
                                                    const bool stop_for_tweaks) {
+  // find dirty leaf catalogs and annotate non-leaf catalogs (dirty child count)
+  // post-condition: the entire catalog tree is ready for concurrent processing
+  WritableCatalogList leafs_to_snapshot;
+  GetModifiedCatalogLeafs(&leafs_to_snapshot);
+
+  unsigned num_finalizers = stop_for_tweaks ? 1 : GetNumberOfCpuCores();
+  if (num_finalizers > kMaxFinalizers)
+    num_finalizers = kMaxFinalizers;
+  // Every catalog is queued at most once, so that the spooler's callback
+  // thread never blocks on a full queue
+  const size_t queue_length = GetCatalogs().size() + num_finalizers;
+  FifoChannel<WritableCatalog *> finalize_queue(queue_length, queue_length);
+
   // prepare environment for parallel processing
   Future<CatalogInfo>  root_catalog_info_future;
   CatalogUploadContext upload_context;
   upload_context.root_catalog_info = &root_catalog_info_future;
   upload_context.stop_for_tweaks   = stop_for_tweaks;
+  upload_context.finalize_queue    = &finalize_queue;
 
   spooler_->RegisterListener(
     &WritableCatalogManager::CatalogUploadCallback, this, upload_context);
 
-  // find dirty leaf catalogs and annotate non-leaf catalogs (dirty child count)
-  // post-condition: the entire catalog tree is ready for concurrent processing
-  WritableCatalogList leafs_to_snapshot;
-  GetModifiedCatalogLeafs(&leafs_to_snapshot);
+  FinalizerContext finalizer_context;
+  finalizer_context.catalog_mgr    = this;
+  finalizer_context.upload_context = upload_context;
+  std::vector<pthread_t> finalizers(num_finalizers);
+  for (unsigned i = 0; i < num_finalizers; ++i) {
+    int retval = pthread_create(&finalizers[i], NULL, MainFinalizer,
+                                &finalizer_context);
+    if (retval != 0)
+      PANIC(kLogStderr, "failed to create catalog finalizer (%d)", retval);
+  }
+  LogCvmfs(kLogCatalog, kLogVerboseMsg, "finalizing catalogs with %u threads",
+           num_finalizers);
 
-  // finalize and schedule the catalog processing
+  // the leaf catalogs can be finalized right away
         WritableCatalogList::const_iterator i    = leafs_to_snapshot.begin();
   const WritableCatalogList::const_iterator iend = leafs_to_snapshot.end();
   for (; i != iend; ++i) {
-    FinalizeCatalog(*i, stop_for_tweaks);
-    ScheduleCatalogProcessing(*i);
+    finalize_queue.Enqueue(*i);
   }
 
   LogCvmfs(kLogCatalog, kLogVerboseMsg, "waiting for upload of catalogs");
   CatalogInfo& root_catalog_info = root_catalog_info_future.Get();
   spooler_->WaitForUpload();
 
+  // a NULL catalog terminates a finalizer thread
+  for (unsigned i = 0; i < num_finalizers; ++i)
+    finalize_queue.Enqueue(NULL);
+  for (unsigned i = 0; i < num_finalizers; ++i)
+    pthread_join(finalizers[i], NULL);
+
   spooler_->UnregisterListeners();
   return root_catalog_info;
 }
 
 
+void *WritableCatalogManager::MainFinalizer(void *data) {
+  FinalizerContext *context = reinterpret_cast<FinalizerContext *>(data);
+  WritableCatalogManager *catalog_mgr = context->catalog_mgr;
+  FifoChannel<WritableCatalog *> *finalize_queue =
+    context->upload_context.finalize_queue;
+
+  while (true) {
+    WritableCatalog *catalog = finalize_queue->Dequeue();
+    if (catalog == NULL)
+      break;
+    catalog_mgr->FinalizeCatalog(catalog,
+                                 context->upload_context.stop_for_tweaks);
+    catalog_mgr->ScheduleCatalogProcessing(catalog);
+  }
+  return NULL;
+}
+
+
 void WritableCatalogManager::FinalizeCatalog(WritableCatalog *catalog,
                                              const bool stop_for_tweaks) {
   // update meta information of this catalog
   LogCvmfs(kLogCatalog, kLogVerboseMsg, "creating snapshot of catalog '%s'",
            catalog->mountpoint().c_str());
 
+  const uint64_t start_ns = platform_monotonic_time_ns();
   catalog->UpdateCounters();
   catalog->UpdateLastModified();
   catalog->IncrementRevision();
@@ -1168,14 +1287,15 @@ void WritableCatalogManager::FinalizeCatalog(WritableCatalog *catalog,
     catalog->SetPreviousRevision(base_hash());
   } else {
     // Multiple catalogs might query the parent concurrently
-    SyncLock();
+    WritableCatalog *parent = catalog->GetWritableParent();
+    parent->SyncLock();
     shash::Any hash_previous;
     uint64_t size_previous;
     const bool retval =
-      catalog->parent()->FindNested(catalog->mountpoint(),
-                                    &hash_previous, &size_previous);
+      parent->FindNested(catalog->mountpoint(),
+                         &hash_previous, &size_previous);
     assert(retval);
-    SyncUnlock();
+    parent->SyncUnlock();
 
     LogCvmfs(kLogCatalog, kLogVerboseMsg, "found '%s' as previous revision "
                                           "for nested catalog '%s'",
@@ -1205,6 +1325,9 @@ void WritableCatalogManager::FinalizeCatalog(WritableCatalog *catalog,
             catalog_limit, catalog->GetCounters().GetSelfEntries());
   }
 
+  perf::Xadd(snapshot_counters_.sz_catalog_finalize_time,
+             (platform_monotonic_time_ns() - start_ns) / 1000);
+
   // allow for manual adjustments in the catalog
   if (stop_for_tweaks) {
     LogCvmfs(kLogCatalog, kLogStdout, "Allowing for tweaks in %s at %s "
@@ -1215,7 +1338,11 @@ void WritableCatalogManager::FinalizeCatalog(WritableCatalog *catalog,
   }
 
   // compaction of bloated catalogs (usually after high database churn)
+  const uint64_t vacuum_start_ns = platform_monotonic_time_ns();
   catalog->VacuumDatabaseIfNecessary();
+  perf::Xadd(snapshot_counters_.sz_catalog_vacuum_time,
+             (platform_monotonic_time_ns() - vacuum_start_ns) / 1000);
+  perf::Inc(snapshot_counters_.n_catalogs_snapshot);
 }
 
 
@@ -1224,7 +1351,8 @@ void WritableCatalogManager::ScheduleCatalogProcessing(
   {
     MutexLockGuard guard(catalog_processing_lock_);
     // register catalog object for WritableCatalogManager::CatalogUploadCallback
-    catalog_processing_map_[catalog->database_path()] = catalog;
+    catalog_processing_map_[catalog->database_path()] =
+      ScheduledCatalog(catalog, platform_monotonic_time_ns());
   }
   spooler_->ProcessCatalog(catalog->database_path());
 }
@@ -1241,24 +1369,28 @@ void WritableCatalogManager::CatalogUploadCallback(
   // retrieve the catalog object based on the callback information
   // see WritableCatalogManager::ScheduleCatalogProcessing()
   WritableCatalog *catalog = NULL;
+  uint64_t scheduled_ns = 0;
   {
     MutexLockGuard guard(catalog_processing_lock_);
-    std::map<std::string, WritableCatalog*>::iterator c =
+    std::map<std::string, ScheduledCatalog>::iterator c =
       catalog_processing_map_.find(result.local_path);
     assert(c != catalog_processing_map_.end());
-    catalog = c->second;
+    catalog = c->second.catalog;
+    scheduled_ns = c->second.timestamp_ns;
   }
+  perf::Xadd(snapshot_counters_.sz_catalog_upload_time,
+             (platform_monotonic_time_ns() - scheduled_ns) / 1000);
 
   uint64_t catalog_size = GetFileSize(result.local_path);
   assert(catalog_size > 0);
 
-  SyncLock();
   if (catalog->HasParent()) {
     // finalized nested catalogs will update their parent's pointer and schedule
     // them for processing (continuation) if the 'dirty children count' == 0
     LogCvmfs(kLogCatalog, kLogVerboseMsg, "updating nested catalog link");
     WritableCatalog *parent = catalog->GetWritableParent();
 
+    parent->SyncLock();
     parent->UpdateNestedCatalog(catalog->mountpoint().ToString(),
                                 result.content_hash,
                                 catalog_size,
@@ -1268,14 +1400,12 @@ void WritableCatalogManager::CatalogUploadCallback(
     const int remaining_dirty_children =
       catalog->GetWritableParent()->DecrementDirtyChildren();
 
-    SyncUnlock();
+    parent->SyncUnlock();
 
     // continuation of the dirty catalog tree traversal
     // see WritableCatalogManager::SnapshotCatalogs()
-    if (remaining_dirty_children == 0) {
-      FinalizeCatalog(parent, catalog_upload_context.stop_for_tweaks);
-      ScheduleCatalogProcessing(parent);
-    }
+    if (remaining_dirty_children == 0)
+      catalog_upload_context.finalize_queue->Enqueue(parent);
 
   } else if (catalog->IsRoot()) {
     // once the root catalog is reached, we are done with processing and report
@@ -1286,7 +1416,6 @@ void WritableCatalogManager::CatalogUploadCallback(
     root_catalog_info.content_hash = result.content_hash;
     root_catalog_info.revision     = catalog->GetRevision();
     catalog_upload_context.root_catalog_info->Set(root_catalog_info);
-    SyncUnlock();
   } else {
     PANIC(kLogStderr, "inconsistent state detected");
   }
@@ -1419,6 +1548,7 @@ WritableCatalogManager::SnapshotCatalogsSerialized(
   CatalogUploadContext unused;
   unused.root_catalog_info = NULL;
   unused.stop_for_tweaks = false;
+  unused.finalize_queue = NULL;
   spooler_->RegisterListener(
     &WritableCatalogManager::CatalogUploadSerializedCallback, this, unused);
 
@@ -24,6 +24,19 @@
  * The WritableCatalogManager starts with a base repository (given by the
  * root hash), and downloads and uncompresses all required catalogs into
  * temporary storage.
+ *
+ * Updates of directory entries take the catalog tree lock as readers and lock
+ * only the WritableCatalog(s) they modify, so that updates of different nested
+ * catalogs do not wait for each other in the catalog manager.  Note that
+ * SQLite still takes process-wide mutexes for memory statistics and for its
+ * shared page cache.  Operations that change the catalog tree, such
+ * as mounting, creating, or removing nested catalogs, take the tree lock as a
+ * writer.
+ *
+ * On commit, the dirty catalogs are finalized by a pool of finalizer threads
+ * and uploaded through the spooler.  A catalog is handed to the finalizers as
+ * soon as all of its dirty children are uploaded, i.e. the catalogs are
+ * processed in the order of the (bottom-up) dependencies in the catalog tree.
  */
 
 #ifndef CVMFS_CATALOG_MGR_RW_H_
@@ -39,6 +52,7 @@
 #include "catalog_mgr_ro.h"
 #include "catalog_rw.h"
 #include "file_chunk.h"
+#include "statistics.h"
 #include "upload_spooler_result.h"
 #include "util/concurrency.h"
 #include "xattr.h"
@@ -56,10 +70,6 @@ namespace manifest {
 class Manifest;
 }
 
-namespace perf {
-class Statistics;
-}
-
 namespace catalog {
 template <class CatalogMgrT>
 class CatalogBalancer;
@@ -67,6 +77,34 @@ class CatalogBalancer;
 
 namespace catalog {
 
+struct CatalogSnapshotCounters {
+  perf::Counter *n_catalogs_snapshot;
+  perf::Counter *sz_catalog_snapshot_time;
+  perf::Counter *sz_catalog_finalize_time;
+  perf::Counter *sz_catalog_vacuum_time;
+  perf::Counter *sz_catalog_upload_time;
+
+  explicit CatalogSnapshotCounters(perf::StatisticsTemplate statistics) {
+    n_catalogs_snapshot = statistics.RegisterTemplated("n_catalogs_snapshot",
+        "Number of catalogs finalized on commit");
+    sz_catalog_snapshot_time = statistics.RegisterTemplated(
+        "sz_catalog_snapshot_time",
+        "Wall clock time of finalizing and uploading the catalogs "
+        "(microseconds)");
+    sz_catalog_finalize_time = statistics.RegisterTemplated(
+        "sz_catalog_finalize_time",
+        "Time spent updating and committing catalogs (microseconds)");
+    sz_catalog_vacuum_time = statistics.RegisterTemplated(
+        "sz_catalog_vacuum_time",
+        "Time spent defragmenting catalogs (microseconds)");
+    sz_catalog_upload_time = statistics.RegisterTemplated(
+        "sz_catalog_upload_time",
+        "Time spent compressing, hashing, and uploading catalogs "
+        "(microseconds)");
+  }
+};  // CatalogSnapshotCounters
+
+
 class WritableCatalogManager : public SimpleCatalogManager {
   friend class CatalogBalancer<WritableCatalogManager>;
   // TODO(jblomer): only needed to get Spooler's hash algorithm.  Remove me
@@ -170,6 +208,10 @@ class WritableCatalogManager : public SimpleCatalogManager {
   bool FindCatalog(const std::string  &path,
                    WritableCatalog   **result,
                    DirectoryEntry     *dirent = NULL);
+  bool AcquireCatalog(const std::string  &path,
+                      WritableCatalog   **result,
+                      DirectoryEntry     *dirent = NULL);
+  void ReleaseCatalog(WritableCatalog *catalog);
   void DoBalance();
   void FixWeight(WritableCatalog *catalog);
 
@@ -187,9 +229,39 @@ class WritableCatalogManager : public SimpleCatalogManager {
   struct CatalogUploadContext {
     Future<CatalogInfo>* root_catalog_info;
     bool                 stop_for_tweaks;
+    /**
+     * Catalogs ready to be finalized, consumed by the finalizer threads.
+     * NULL for the serialized catalog processing.
+     */
+    FifoChannel<WritableCatalog *> *finalize_queue;
+  };
+
+  /**
+   * Passed to the finalizer threads
+   */
+  struct FinalizerContext {
+    WritableCatalogManager *catalog_mgr;
+    CatalogUploadContext    upload_context;
+  };
+
+  /**
+   * A catalog handed to the spooler and the time it was scheduled
+   */
+  struct ScheduledCatalog {
+    ScheduledCatalog() : catalog(NULL), timestamp_ns(0) { }
+    ScheduledCatalog(WritableCatalog *c, uint64_t t)
+      : catalog(c), timestamp_ns(t) { }
+    WritableCatalog *catalog;
+    uint64_t         timestamp_ns;
   };
 
+  /**
+   * Upper bound for the number of finalizer threads
+   */
+  static const unsigned kMaxFinalizers = 16;
+
   CatalogInfo SnapshotCatalogs(const bool stop_for_tweaks);
+  static void *MainFinalizer(void *data);
   void FinalizeCatalog(WritableCatalog *catalog,
                        const bool stop_for_tweaks);
   void ScheduleCatalogProcessing(WritableCatalog *catalog);
@@ -206,9 +278,6 @@ class WritableCatalogManager : public SimpleCatalogManager {
                              const CatalogUploadContext   clg_upload_context);
 
  private:
-  inline void SyncLock() { pthread_mutex_lock(sync_lock_); }
-  inline void SyncUnlock() { pthread_mutex_unlock(sync_lock_); }
-
   //****************************************************************************
   // Workaround -- Serialized Catalog Committing
   void GetModifiedCatalogs(WritableCatalogList *result) const {
@@ -227,12 +296,10 @@ class WritableCatalogManager : public SimpleCatalogManager {
   // defined in catalog_mgr_rw.cc
   static const std::string kCatalogFilename;
 
-  // private lock of WritableCatalogManager
-  pthread_mutex_t *sync_lock_;
   upload::Spooler *spooler_;
 
-  pthread_mutex_t                         *catalog_processing_lock_;
-  std::map<std::string, WritableCatalog*>  catalog_processing_map_;
+  pthread_mutex_t                          *catalog_processing_lock_;
+  std::map<std::string, ScheduledCatalog>   catalog_processing_map_;
 
   // TODO(jblomer): catalog limits should become its own struct
   bool enforce_limits_;
@@ -273,6 +340,8 @@ class WritableCatalogManager : public SimpleCatalogManager {
    * min_weight. By default it is set to max_weight / 2.
    */
   const unsigned balance_weight_;
+
+  CatalogSnapshotCounters snapshot_counters_;
 };  // class WritableCatalogManager
 
 }  // namespace catalog
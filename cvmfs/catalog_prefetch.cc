@@ -0,0 +1,209 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "catalog_prefetch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "clientctx.h"
+#include "fetch.h"
+#include "util/concurrency.h"
+#include "util/exception.h"
+#include "util/logging.h"
+
+using namespace std;  // NOLINT
+
+namespace catalog {
+
+static inline uint32_t hasher_md5(const shash::Md5 &key) {
+  // Don't start with the first bytes, because == is using them as well
+  return (uint32_t) *(reinterpret_cast<const uint32_t *>(key.digest) + 1);
+}
+
+static inline uint32_t hasher_any(const shash::Any &key) {
+  return (uint32_t) *(reinterpret_cast<const uint32_t *>(key.digest) + 1);
+}
+
+namespace {
+
+/**
+ * Previously mounted nested catalogs first, then the smaller ones
+ */
+struct SelectionOrder {
+  explicit SelectionOrder(const std::vector<bool> *m) : mounted(m) { }
+  bool operator()(const std::pair<unsigned, const Catalog::NestedCatalog *> &a,
+                  const std::pair<unsigned, const Catalog::NestedCatalog *> &b)
+  {
+    if ((*mounted)[a.first] != (*mounted)[b.first])
+      return (*mounted)[a.first];
+    return a.second->size < b.second->size;
+  }
+  const std::vector<bool> *mounted;
+};
+
+}  // anonymous namespace
+
+
+CatalogPrefetcher::CatalogPrefetcher(
+  const unsigned budget,
+  const string &repo_name,
+  cvmfs::Fetcher *fetcher,
+  perf::StatisticsTemplate statistics)
+  : budget_(budget)
+  , repo_name_(repo_name)
+  , fetcher_(fetcher)
+  , spawned_(false)
+  , counters_(statistics)
+{
+  history_.Init(16, shash::Md5(shash::AsciiPtr("!")), hasher_md5);
+  scheduled_.Init(16, shash::Any(), hasher_any);
+  int retval = pthread_mutex_init(&lock_history_, NULL);
+  assert(retval == 0);
+}
+
+
+CatalogPrefetcher::~CatalogPrefetcher() {
+  // Drop pending requests, the thread should terminate quickly
+  PrefetchJob *job;
+  while ((job = jobs_.TryPopFront()) != NULL)
+    delete job;
+
+  if (spawned_) {
+    jobs_.EnqueueBack(new PrefetchJob(
+      CacheManager::LabeledObject(shash::Any()), 0, 0, 0));
+    pthread_join(thread_prefetch_, NULL);
+  }
+  pthread_mutex_destroy(&lock_history_);
+}
+
+
+void CatalogPrefetcher::Spawn() {
+  assert(!spawned_);
+  int retval = pthread_create(&thread_prefetch_, NULL, MainPrefetch, this);
+  if (retval != 0)
+    PANIC(kLogStderr, "failed to create catalog prefetch thread (%d)", retval);
+  spawned_ = true;
+  LogCvmfs(kLogCatalog, kLogDebug,
+           "nested catalog prefetch enabled (budget %u catalogs)", budget_);
+}
+
+
+void *CatalogPrefetcher::MainPrefetch(void *data) {
+  CatalogPrefetcher *prefetcher = static_cast<CatalogPrefetcher *>(data);
+
+  while (true) {
+    PrefetchJob *job = prefetcher->jobs_.PopFront();
+    if (job->object.id.IsNull()) {
+      delete job;
+      break;
+    }
+
+    {
+      ClientCtxGuard ctx_guard(job->uid, job->gid, job->pid, NULL);
+      int fd = prefetcher->fetcher_->Fetch(job->object);
+      if (fd >= 0) {
+        prefetcher->fetcher_->cache_mgr()->Close(fd);
+      } else {
+        LogCvmfs(kLogCatalog, kLogDebug, "prefetching catalog %s failed (%d)",
+                 job->object.label.path.c_str(), fd);
+        perf::Inc(prefetcher->counters_.n_prefetch_failed);
+      }
+    }
+    delete job;
+  }
+
+  return NULL;
+}
+
+
+/**
+ * Picks up to budget_ nested catalogs that are neither null nor already
+ * scheduled.  Must be called with lock_history_ held.
+ */
+void CatalogPrefetcher::Select(
+  const Catalog::NestedCatalogList &nested_catalogs,
+  vector<const Catalog::NestedCatalog *> *selection)
+{
+  vector<bool> mounted;
+  vector<pair<unsigned, const Catalog::NestedCatalog *> > candidates;
+  for (unsigned i = 0; i < nested_catalogs.size(); ++i) {
+    const Catalog::NestedCatalog *nested = &nested_catalogs[i];
+    if (nested->hash.IsNull() || scheduled_.Contains(nested->hash))
+      continue;
+    mounted.push_back(history_.Contains(shash::Md5(
+      nested->mountpoint.GetChars(), nested->mountpoint.GetLength())));
+    candidates.push_back(make_pair(candidates.size(), nested));
+  }
+
+  const unsigned num = min(static_cast<unsigned>(candidates.size()), budget_);
+  partial_sort(candidates.begin(), candidates.begin() + num, candidates.end(),
+               SelectionOrder(&mounted));
+  selection->clear();
+  for (unsigned i = 0; i < num; ++i)
+    selection->push_back(candidates[i].second);
+}
+
+
+void CatalogPrefetcher::OnMount(
+  const PathString &mountpoint,
+  const shash::Any &hash,
+  const Catalog::NestedCatalogList &nested_catalogs)
+{
+  vector<const Catalog::NestedCatalog *> selection;
+  {
+    MutexLockGuard guard(&lock_history_);
+    if (scheduled_.Erase(hash))
+      perf::Inc(counters_.n_prefetch_hits);
+    if (history_.size() >= kMaxHistory)
+      history_.Clear();
+    history_.Insert(
+      shash::Md5(mountpoint.GetChars(), mountpoint.GetLength()), true);
+
+    if (budget_ == 0)
+      return;
+    Select(nested_catalogs, &selection);
+    if (scheduled_.size() + selection.size() > kMaxHistory)
+      scheduled_.Clear();
+    for (unsigned i = 0; i < selection.size(); ++i)
+      scheduled_.Insert(selection[i]->hash, true);
+  }
+  if (selection.empty())
+    return;
+
+  uid_t uid = 0;
+  gid_t gid = 0;
+  pid_t pid = 0;
+  InterruptCue *ic;
+  ClientCtx *ctx = ClientCtx::GetInstance();
+  if (ctx->IsSet())
+    ctx->Get(&uid, &gid, &pid, &ic);
+
+  for (unsigned i = 0; i < selection.size(); ++i) {
+    if (jobs_.size() >= kMaxPendingJobs) {
+      perf::Xadd(counters_.n_prefetch_dropped, selection.size() - i);
+      // Allow for another attempt when the parent is mounted again
+      MutexLockGuard guard(&lock_history_);
+      for (; i < selection.size(); ++i)
+        scheduled_.Erase(selection[i]->hash);
+      return;
+    }
+
+    CacheManager::Label label;
+    label.path = repo_name_ + ":" + selection[i]->mountpoint.ToString() +
+                 " (" + selection[i]->hash.ToString() + ")";
+    // Not labeled as a catalog: catalogs are pinned in the cache until they
+    // are unloaded, which never happens for catalogs that are not mounted.
+    // Mounting the prefetched catalog later pins it.
+    label.flags = 0;
+    jobs_.EnqueueBack(new PrefetchJob(
+      CacheManager::LabeledObject(selection[i]->hash, label), uid, gid, pid));
+    perf::Inc(counters_.n_prefetch_issued);
+    perf::Xadd(counters_.sz_prefetch_bytes, selection[i]->size);
+  }
+}
+
+}  // namespace catalog
@@ -0,0 +1,143 @@
+/**
+ * This file is part of the CernVM File System.
+ *
+ * Prefetching of nested catalogs.  Nested catalogs are loaded on demand when
+ * a path lookup crosses a nested catalog mountpoint.  A recursive traversal of
+ * a deep tree therefore waits for one catalog download per level.  After a
+ * catalog is mounted, the CatalogPrefetcher downloads some of its nested
+ * catalogs into the cache in the background.  Mounting them later only opens
+ * the cached copy.  If the mount happens while the download is in flight, the
+ * Fetcher collapses the two requests.  Prefetched catalogs are regular cache
+ * objects; they are only pinned once they are mounted.
+ */
+
+#ifndef CVMFS_CATALOG_PREFETCH_H_
+#define CVMFS_CATALOG_PREFETCH_H_
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#include <string>
+#include <vector>
+
+#include "cache.h"
+#include "catalog.h"
+#include "crypto/hash.h"
+#include "ingestion/tube.h"
+#include "shortstring.h"
+#include "smallhash.h"
+#include "statistics.h"
+#include "util/single_copy.h"
+
+namespace cvmfs {
+class Fetcher;
+}
+
+namespace catalog {
+
+struct CatalogPrefetchCounters {
+  perf::Counter *n_prefetch_issued;
+  perf::Counter *n_prefetch_hits;
+  perf::Counter *n_prefetch_dropped;
+  perf::Counter *n_prefetch_failed;
+  perf::Counter *sz_prefetch_bytes;
+
+  explicit CatalogPrefetchCounters(perf::StatisticsTemplate statistics) {
+    n_prefetch_issued = statistics.RegisterTemplated("n_prefetch_issued",
+        "Number of nested catalogs scheduled for prefetching");
+    n_prefetch_hits = statistics.RegisterTemplated("n_prefetch_hits",
+        "Number of nested catalogs mounted after being scheduled");
+    n_prefetch_dropped = statistics.RegisterTemplated("n_prefetch_dropped",
+        "Number of catalog prefetch requests dropped due to a full queue");
+    n_prefetch_failed = statistics.RegisterTemplated("n_prefetch_failed",
+        "Number of failed catalog prefetch downloads");
+    sz_prefetch_bytes = statistics.RegisterTemplated("sz_prefetch_bytes",
+        "Number of catalog bytes scheduled for prefetching");
+  }
+};  // CatalogPrefetchCounters
+
+
+/**
+ * Schedules the nested catalogs of a freshly mounted catalog for download by
+ * a background thread.  At most budget nested catalogs are scheduled per
+ * mounted catalog.  Nested catalogs that have been mounted before, e.g. before
+ * a catalog update, come first, followed by the smallest ones.  Prefetching is
+ * best effort: if the queue is full, requests are dropped.  Thread-safe.
+ */
+class CatalogPrefetcher : SingleCopy {
+  friend class T_CatalogPrefetch;
+
+ public:
+  /**
+   * Prefetch requests that find more than this number of pending jobs in the
+   * queue are dropped.
+   */
+  static const unsigned kMaxPendingJobs = 128;
+  /**
+   * Number of remembered mountpoints and scheduled catalogs.  If full, the
+   * tables are cleared.
+   */
+  static const unsigned kMaxHistory = 8192;
+
+  CatalogPrefetcher(const unsigned budget,
+                    const std::string &repo_name,
+                    cvmfs::Fetcher *fetcher,
+                    perf::StatisticsTemplate statistics);
+  ~CatalogPrefetcher();
+
+  /**
+   * Requests that arrive before Spawn() are queued and processed once the
+   * thread runs.
+   */
+  void Spawn();
+
+  /**
+   * Called by the catalog manager with the write lock held after a catalog
+   * has been attached.
+   */
+  void OnMount(const PathString &mountpoint,
+               const shash::Any &hash,
+               const Catalog::NestedCatalogList &nested_catalogs);
+
+  unsigned budget() const { return budget_; }
+
+ private:
+  struct PrefetchJob {
+    PrefetchJob(const CacheManager::LabeledObject &o, uid_t u, gid_t g, pid_t p)
+      : object(o), uid(u), gid(g), pid(p) { }
+    /**
+     * A null hash terminates the thread
+     */
+    CacheManager::LabeledObject object;
+    uid_t uid;
+    gid_t gid;
+    pid_t pid;
+  };
+
+  static void *MainPrefetch(void *data);
+  void Select(const Catalog::NestedCatalogList &nested_catalogs,
+              std::vector<const Catalog::NestedCatalog *> *selection);
+
+  unsigned budget_;
+  std::string repo_name_;
+  cvmfs::Fetcher *fetcher_;
+  bool spawned_;
+  pthread_t thread_prefetch_;
+  Tube<PrefetchJob> jobs_;
+
+  /**
+   * Md5 of the mountpoints of catalogs that have been mounted
+   */
+  SmallHashDynamic<shash::Md5, bool> history_;
+  /**
+   * Catalogs that have been scheduled and not yet mounted
+   */
+  SmallHashDynamic<shash::Any, bool> scheduled_;
+  pthread_mutex_t lock_history_;
+
+  CatalogPrefetchCounters counters_;
+};
+
+}  // namespace catalog
+
+#endif  // CVMFS_CATALOG_PREFETCH_H_
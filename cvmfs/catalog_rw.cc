@@ -13,6 +13,7 @@
 #include "util/concurrency.h"
 #include "util/exception.h"
 #include "util/logging.h"
+#include "util/smalloc.h"
 #include "xattr.h"
 
 using namespace std;  // NOLINT
@@ -22,6 +23,24 @@ namespace catalog {
 const double WritableCatalog::kMaximalFreePageRatio = 0.20;
 const double WritableCatalog::kMaximalRowIdWasteRatio = 0.25;
 
+/**
+ * zstd and lz4 compressed files may only be referenced from catalogs of
+ * schema revision 7 or newer.  Such catalogs are always upgraded on opening
+ * for writing, so a violation indicates a programming error.
+ */
+static void AssertCompressionAllowed(const CatalogDatabase &database,
+                                     const DirectoryEntry &entry)
+{
+  const zlib::Algorithms alg = entry.compression_algorithm();
+  if ((alg != zlib::kZstd) && (alg != zlib::kLz4))
+    return;
+  if (database.schema_revision() < 7) {
+    PANIC(kLogStderr, "compression algorithm %s requires catalog schema "
+          "revision 7 (found %u)", zlib::AlgorithmName(alg).c_str(),
+          database.schema_revision());
+  }
+}
+
 
 WritableCatalog::WritableCatalog(const string      &path,
                                  const shash::Any  &catalog_hash,
@@ -42,6 +61,10 @@ WritableCatalog::WritableCatalog(const string      &path,
   sql_inc_linkcount_(NULL),
   dirty_(false)
 {
+  sync_lock_ =
+    reinterpret_cast<pthread_mutex_t *>(smalloc(sizeof(pthread_mutex_t)));
+  int retval = pthread_mutex_init(sync_lock_, NULL);
+  assert(retval == 0);
   atomic_init32(&dirty_children_);
 }
 
@@ -66,6 +89,8 @@ WritableCatalog::~WritableCatalog() {
   // CAUTION HOT!
   // (see Catalog.h - near the definition of FinalizePreparedStatements)
   FinalizePreparedStatements();
+  pthread_mutex_destroy(sync_lock_);
+  free(sync_lock_);
 }
 
 
@@ -153,6 +178,7 @@ void WritableCatalog::AddEntry(
 
   shash::Md5 path_hash((shash::AsciiPtr(entry_path)));
   shash::Md5 parent_hash((shash::AsciiPtr(parent_path)));
+  AssertCompressionAllowed(database(), entry);
   DirectoryEntry effective_entry(entry);
   effective_entry.set_has_xattrs(!xattrs.IsEmpty());
 
@@ -252,6 +278,7 @@ void WritableCatalog::TouchEntry(const DirectoryEntryBase &entry,
 void WritableCatalog::UpdateEntry(const DirectoryEntry &entry,
                                   const shash::Md5 &path_hash) {
   SetDirty();
+  AssertCompressionAllowed(database(), entry);
 
   bool retval =
     sql_update_->BindPathHash(path_hash) &&
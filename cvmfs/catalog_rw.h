@@ -9,12 +9,15 @@
  *  - UpdateEntry
  *  - RemoveEntry
  *
- * Catalogs not thread safe.
+ * Catalogs not thread safe.  Concurrent updates of a catalog must be serialized
+ * by SyncLock() / SyncUnlock().  If a thread needs to lock a catalog and its
+ * parent, it locks the child first.
  */
 
 #ifndef CVMFS_CATALOG_RW_H_
 #define CVMFS_CATALOG_RW_H_
 
+#include <pthread.h>
 #include <stdint.h>
 
 #include <string>
@@ -54,6 +57,9 @@ class WritableCatalog : public Catalog {
   void Transaction();
   void Commit();
 
+  inline void SyncLock() { pthread_mutex_lock(sync_lock_); }
+  inline void SyncUnlock() { pthread_mutex_unlock(sync_lock_); }
+
   inline bool IsDirty() const { return dirty_; }
   inline bool IsWritable() const { return true; }
   uint32_t GetMaxLinkId() const;
@@ -160,6 +166,12 @@ class WritableCatalog : public Catalog {
 
   bool dirty_;  /**< Indicates if the catalog has been changed */
 
+  /**
+   * Serializes the updates of this catalog; different catalogs are locked
+   * independently.
+   */
+  pthread_mutex_t *sync_lock_;
+
   DeltaCounters delta_counters_;
 
   // parallel commit state
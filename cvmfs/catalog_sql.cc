@@ -77,7 +77,10 @@ const float CatalogDatabase::kLatestSupportedSchema = 2.5;  // + 1.X (r/o)
 //            * add self_special and subtree_special statistics counters
 //   5 --> 6: (Jul 01 2021):
 //            * Add kFlagDirectIo
-const unsigned CatalogDatabase::kLatestSchemaRevision = 6;
+//   6 --> 7: (Oct 18 2026):
+//            * zstd (2) and lz4 (3) as compression algorithms in the flags;
+//              only catalogs of this revision may contain them
+const unsigned CatalogDatabase::kLatestSchemaRevision = 7;
 
 bool CatalogDatabase::CheckSchemaCompatibility() {
   return !( (schema_version() >= 2.0-kSchemaEpsilon)                   &&
@@ -209,6 +212,17 @@ bool CatalogDatabase::LiveSchemaUpgradeIfNecessary() {
     }
   }
 
+
+  if (IsEqualSchema(schema_version(), 2.5) && (schema_revision() == 6)) {
+    LogCvmfs(kLogCatalog, kLogDebug, "upgrading schema revision (6 --> 7)");
+
+    set_schema_revision(7);
+    if (!StoreSchemaRevision()) {
+      LogCvmfs(kLogCatalog, kLogDebug, "failed to upgrade schema revision");
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -168,6 +168,34 @@ class CatalogTraversalParallel : public CatalogTraversalBase<ObjectFetcherT> {
     return result;
   }
 
+  /**
+   * Same as TraverseRevision but the traversal starts at a (nested) catalog
+   * that is attached at the given root path.  Used to process a subtree of the
+   * repository.
+   *
+   * @param root_catalog_hash  the entry point into the catalog traversal
+   * @param root_path          the mountpoint of the entry point catalog
+   * @return                   true when catalogs were successfully traversed
+   */
+  bool TraverseSubtree(
+    const shash::Any &root_catalog_hash,
+    const std::string &root_path,
+    const TraversalType type = Base::kBreadthFirst)
+  {
+    if (this->no_repeat_history_ &&
+        catalogs_done_.Contains(root_catalog_hash)) {
+      return true;
+    }
+    effective_traversal_type_ = type;
+    effective_history_depth_ = Parameters::kNoHistory;
+    effective_timestamp_threshold_ = Parameters::kNoTimestampThreshold;
+    PushJob(new CatalogJob(root_path, root_catalog_hash, 0, 0));
+    bool result = DoTraverse();
+    effective_history_depth_ = this->default_history_depth_;
+    effective_timestamp_threshold_ = this->default_timestamp_threshold_;
+    return result;
+  }
+
  protected:
   static uint32_t hasher(const shash::Any &key) {
     // Don't start with the first bytes, because == is using them as well
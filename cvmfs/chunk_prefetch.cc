@@ -0,0 +1,245 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "chunk_prefetch.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "clientctx.h"
+#include "fetch.h"
+#include "util/concurrency.h"
+#include "util/logging.h"
+#include "util/murmur.hxx"
+
+using namespace std;  // NOLINT
+
+namespace cvmfs {
+
+static inline uint32_t hasher_chunk_handle(const uint64_t &value) {
+  return MurmurHash2(&value, sizeof(value), 0x07387a4f);
+}
+
+
+ChunkPrefetcher::ChunkPrefetcher(
+  const unsigned window,
+  const unsigned num_threads,
+  perf::StatisticsTemplate statistics)
+  : window_(std::min(window, kMaxWindow))
+  , num_threads_(std::max(num_threads, 1U))
+  , spawned_(false)
+  , counters_(statistics)
+{
+  streams_.Init(16, 0, hasher_chunk_handle);
+  int retval = pthread_mutex_init(&lock_streams_, NULL);
+  assert(retval == 0);
+}
+
+
+ChunkPrefetcher::~ChunkPrefetcher() {
+  // Drop pending requests, the worker threads should terminate quickly
+  PrefetchJob *job;
+  while ((job = jobs_.TryPopFront()) != NULL)
+    delete job;
+
+  if (spawned_) {
+    for (unsigned i = 0; i < threads_.size(); ++i) {
+      jobs_.EnqueueBack(new PrefetchJob(
+        CacheManager::LabeledObject(shash::Any()), NULL, 0, 0, 0));
+    }
+    for (unsigned i = 0; i < threads_.size(); ++i)
+      pthread_join(threads_[i], NULL);
+  }
+  pthread_mutex_destroy(&lock_streams_);
+}
+
+
+void ChunkPrefetcher::Spawn() {
+  assert(!spawned_);
+  threads_.resize(num_threads_);
+  for (unsigned i = 0; i < num_threads_; ++i) {
+    int retval = pthread_create(&threads_[i], NULL, MainPrefetch, this);
+    assert(retval == 0);
+  }
+  spawned_ = true;
+  LogCvmfs(kLogCvmfs, kLogDebug,
+           "chunk read-ahead enabled (window %u chunks, %u threads)",
+           window_, num_threads_);
+}
+
+
+void *ChunkPrefetcher::MainPrefetch(void *data) {
+  ChunkPrefetcher *prefetcher = static_cast<ChunkPrefetcher *>(data);
+
+  while (true) {
+    PrefetchJob *job = prefetcher->jobs_.PopFront();
+    if (job->fetcher == NULL) {
+      delete job;
+      break;
+    }
+
+    {
+      ClientCtxGuard ctx_guard(job->uid, job->gid, job->pid, NULL);
+      int fd = job->fetcher->Fetch(job->object);
+      if (fd >= 0) {
+        job->fetcher->cache_mgr()->Close(fd);
+      } else {
+        LogCvmfs(kLogCvmfs, kLogDebug, "read-ahead of %s (%s) failed (%d)",
+                 job->object.label.path.c_str(),
+                 job->object.id.ToString().c_str(), fd);
+        perf::Inc(prefetcher->counters_.n_prefetch_failed);
+      }
+    }
+    delete job;
+  }
+
+  return NULL;
+}
+
+
+uint64_t ChunkPrefetcher::SumChunkSizes(
+  const FileChunkReflist &chunks,
+  unsigned begin,
+  unsigned end)
+{
+  uint64_t result = 0;
+  end = std::min(end, static_cast<unsigned>(chunks.list->size()));
+  for (unsigned i = begin; i < end; ++i)
+    result += chunks.list->AtPtr(i)->size();
+  return result;
+}
+
+
+/**
+ * Records the transition of the handle to chunk_idx.  Returns true if the
+ * chunks [begin, end) should be prefetched.
+ */
+bool ChunkPrefetcher::UpdateStream(
+  const uint64_t chunk_handle,
+  const unsigned chunk_idx,
+  const unsigned num_chunks,
+  const FileChunkReflist &chunks,
+  unsigned *begin,
+  unsigned *end)
+{
+  MutexLockGuard guard(&lock_streams_);
+
+  StreamInfo info;
+  if (streams_.Lookup(chunk_handle, &info)) {
+    if ((chunk_idx >= info.prefetch_begin) && (chunk_idx < info.prefetch_end)) {
+      perf::Inc(counters_.n_prefetch_hits);
+      // Skipped chunks in between are not going to be read through the handle
+      perf::Xadd(counters_.sz_prefetch_wasted,
+                 SumChunkSizes(chunks, info.prefetch_begin, chunk_idx));
+      info.prefetch_begin = chunk_idx + 1;
+    } else if (info.prefetch_begin < info.prefetch_end) {
+      // Seek away from the read-ahead window
+      perf::Xadd(counters_.sz_prefetch_wasted,
+                 SumChunkSizes(chunks, info.prefetch_begin, info.prefetch_end));
+      info.prefetch_begin = info.prefetch_end = 0;
+    }
+
+    if (chunk_idx == info.last_chunk_idx + 1)
+      info.num_sequential++;
+    else
+      info.num_sequential = 0;
+  }
+  info.last_chunk_idx = chunk_idx;
+
+  bool result = false;
+  if (info.num_sequential >= kSequentialThreshold) {
+    if (info.prefetch_begin >= info.prefetch_end)
+      info.prefetch_begin = info.prefetch_end = chunk_idx + 1;
+    *begin = std::max(info.prefetch_end, chunk_idx + 1);
+    *end = std::min(chunk_idx + 1 + window_, num_chunks);
+    if (*begin < *end) {
+      info.prefetch_end = *end;
+      result = true;
+    }
+  }
+  streams_.Insert(chunk_handle, info);
+  return result;
+}
+
+
+/**
+ * Called by the read function whenever a chunk handle opens a new chunk.  The
+ * label carries the file-wide information (path, compression, flags).
+ */
+void ChunkPrefetcher::OnOpenChunk(
+  const uint64_t chunk_handle,
+  const unsigned chunk_idx,
+  const FileChunkReflist &chunks,
+  const CacheManager::Label &label,
+  Fetcher *fetcher)
+{
+  if (!spawned_ || (window_ == 0))
+    return;
+
+  unsigned begin, end;
+  if (!UpdateStream(chunk_handle, chunk_idx, chunks.list->size(), chunks,
+                    &begin, &end))
+  {
+    return;
+  }
+
+  uid_t uid = 0;
+  gid_t gid = 0;
+  pid_t pid = 0;
+  InterruptCue *ic;
+  ClientCtx *ctx = ClientCtx::GetInstance();
+  if (ctx->IsSet())
+    ctx->Get(&uid, &gid, &pid, &ic);
+
+  for (unsigned i = begin; i < end; ++i) {
+    if (jobs_.size() >= kMaxPendingJobs) {
+      perf::Xadd(counters_.n_prefetch_dropped, end - i);
+      // Allow for another attempt on the next chunk transition
+      MutexLockGuard guard(&lock_streams_);
+      StreamInfo info;
+      if (streams_.Lookup(chunk_handle, &info)) {
+        info.prefetch_end = std::min(info.prefetch_end, i);
+        streams_.Insert(chunk_handle, info);
+      }
+      return;
+    }
+
+    const FileChunk *chunk = chunks.list->AtPtr(i);
+    CacheManager::Label chunk_label(label);
+    chunk_label.size = chunk->size();
+    if (chunk_label.IsExternal())
+      chunk_label.range_offset = chunk->offset();
+    jobs_.EnqueueBack(new PrefetchJob(
+      CacheManager::LabeledObject(chunk->content_hash(), chunk_label),
+      fetcher, uid, gid, pid));
+    perf::Inc(counters_.n_prefetch_issued);
+    perf::Xadd(counters_.sz_prefetch_bytes, chunk->size());
+  }
+}
+
+
+/**
+ * Forgets about the handle.  Scheduled chunks that have not been opened count
+ * as wasted.
+ */
+void ChunkPrefetcher::OnRelease(
+  const uint64_t chunk_handle,
+  const FileChunkReflist &chunks)
+{
+  if (!spawned_)
+    return;
+
+  MutexLockGuard guard(&lock_streams_);
+  StreamInfo info;
+  if (!streams_.Lookup(chunk_handle, &info))
+    return;
+  if (info.prefetch_begin < info.prefetch_end) {
+    perf::Xadd(counters_.sz_prefetch_wasted,
+               SumChunkSizes(chunks, info.prefetch_begin, info.prefetch_end));
+  }
+  streams_.Erase(chunk_handle);
+}
+
+}  // namespace cvmfs
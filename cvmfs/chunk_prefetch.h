@@ -0,0 +1,150 @@
+/**
+ * This file is part of the CernVM File System.
+ *
+ * Read-ahead for chunked files.  Large files are split into chunks that are
+ * fetched one at a time when a read crosses a chunk boundary.  For sequential
+ * readers this results in a stall at every boundary.  The ChunkPrefetcher
+ * watches the chunk transitions of every open chunk handle and, once a handle
+ * is found to be read sequentially, loads the next few chunks asynchronously
+ * into the cache.  When the reader arrives at such a chunk, it is either in
+ * the cache already or its download is in flight and the Fetcher collapses the
+ * two requests.
+ */
+
+#ifndef CVMFS_CHUNK_PREFETCH_H_
+#define CVMFS_CHUNK_PREFETCH_H_
+
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <vector>
+
+#include "cache.h"
+#include "file_chunk.h"
+#include "ingestion/tube.h"
+#include "smallhash.h"
+#include "statistics.h"
+#include "util/single_copy.h"
+
+namespace cvmfs {
+
+class Fetcher;
+
+struct ChunkPrefetchCounters {
+  perf::Counter *n_prefetch_issued;
+  perf::Counter *n_prefetch_hits;
+  perf::Counter *n_prefetch_dropped;
+  perf::Counter *n_prefetch_failed;
+  perf::Counter *sz_prefetch_bytes;
+  perf::Counter *sz_prefetch_wasted;
+
+  explicit ChunkPrefetchCounters(perf::StatisticsTemplate statistics) {
+    n_prefetch_issued = statistics.RegisterTemplated("n_prefetch_issued",
+        "Number of chunks scheduled for read-ahead");
+    n_prefetch_hits = statistics.RegisterTemplated("n_prefetch_hits",
+        "Number of chunks opened by a reader after being scheduled");
+    n_prefetch_dropped = statistics.RegisterTemplated("n_prefetch_dropped",
+        "Number of read-ahead requests dropped due to a full queue");
+    n_prefetch_failed = statistics.RegisterTemplated("n_prefetch_failed",
+        "Number of failed read-ahead downloads");
+    sz_prefetch_bytes = statistics.RegisterTemplated("sz_prefetch_bytes",
+        "Number of bytes scheduled for read-ahead");
+    sz_prefetch_wasted = statistics.RegisterTemplated("sz_prefetch_wasted",
+        "Number of read-ahead bytes never read through the handle");
+  }
+};  // ChunkPrefetchCounters
+
+
+/**
+ * Detects sequential access per chunk handle and schedules the next chunks of
+ * such handles for download by a small pool of worker threads.  Prefetching is
+ * best effort: if the queue is full, requests are dropped.  Thread-safe.
+ */
+class ChunkPrefetcher : SingleCopy {
+  friend class T_ChunkPrefetch;
+
+ public:
+  /**
+   * Number of consecutive forward chunk transitions before a handle is
+   * considered to be read sequentially.
+   */
+  static const unsigned kSequentialThreshold = 1;
+  static const unsigned kDefaultNumThreads = 2;
+  static const unsigned kMaxWindow = 64;
+  /**
+   * Prefetch requests that find more than this number of pending jobs in the
+   * queue are dropped.
+   */
+  static const unsigned kMaxPendingJobs = 256;
+
+  ChunkPrefetcher(const unsigned window,
+                  const unsigned num_threads,
+                  perf::StatisticsTemplate statistics);
+  ~ChunkPrefetcher();
+
+  void Spawn();
+
+  void OnOpenChunk(const uint64_t chunk_handle,
+                   const unsigned chunk_idx,
+                   const FileChunkReflist &chunks,
+                   const CacheManager::Label &label,
+                   Fetcher *fetcher);
+  void OnRelease(const uint64_t chunk_handle, const FileChunkReflist &chunks);
+
+  unsigned window() const { return window_; }
+
+ private:
+  /**
+   * Access history of a single chunk handle
+   */
+  struct StreamInfo {
+    StreamInfo()
+      : last_chunk_idx(0), num_sequential(0), prefetch_begin(0)
+      , prefetch_end(0) { }
+    unsigned last_chunk_idx;
+    unsigned num_sequential;
+    /**
+     * Chunks in [prefetch_begin, prefetch_end) have been scheduled and not yet
+     * been opened through the handle.
+     */
+    unsigned prefetch_begin;
+    unsigned prefetch_end;
+  };
+
+  struct PrefetchJob {
+    PrefetchJob(const CacheManager::LabeledObject &o, Fetcher *f,
+                uid_t u, gid_t g, pid_t p)
+      : object(o), fetcher(f), uid(u), gid(g), pid(p) { }
+    CacheManager::LabeledObject object;
+    /**
+     * NULL for the termination job
+     */
+    Fetcher *fetcher;
+    uid_t uid;
+    gid_t gid;
+    pid_t pid;
+  };
+
+  static void *MainPrefetch(void *data);
+  uint64_t SumChunkSizes(const FileChunkReflist &chunks,
+                         unsigned begin, unsigned end);
+  bool UpdateStream(const uint64_t chunk_handle, const unsigned chunk_idx,
+                    const unsigned num_chunks, const FileChunkReflist &chunks,
+                    unsigned *begin, unsigned *end);
+
+  unsigned window_;
+  unsigned num_threads_;
+  bool spawned_;
+  std::vector<pthread_t> threads_;
+  Tube<PrefetchJob> jobs_;
+
+  SmallHashDynamic<uint64_t, StreamInfo> streams_;
+  pthread_mutex_t lock_streams_;
+
+  ChunkPrefetchCounters counters_;
+};
+
+}  // namespace cvmfs
+
+#endif  // CVMFS_CHUNK_PREFETCH_H_
@@ -3,6 +3,8 @@
  *
  * This is a wrapper around zlib.  It provides
  * a set of functions to conveniently compress and decompress stuff.
+ * The Compressor and Decompressor classes additionally support Zstandard and
+ * LZ4 for file contents.
  * Almost all of the functions return true on success, otherwise false.
  *
  * TODO: think about code deduplication
@@ -14,6 +16,10 @@
 #include <alloca.h>
 #include <stdlib.h>
 #include <sys/stat.h>
+#ifdef HAS_ZSTD_LZ4
+#include <lz4frame.h>
+#include <zstd.h>
+#endif
 
 #include <algorithm>
 #include <cassert>
@@ -23,8 +29,10 @@
 #include "util/exception.h"
 #include "util/logging.h"
 #include "util/platform.h"
+#include "util/pointer.h"
 #include "util/posix.h"
 #include "util/smalloc.h"
+#include "util/string.h"
 
 using namespace std;  // NOLINT
 
@@ -143,13 +151,43 @@ namespace zlib {
 const unsigned kBufferSize = 32768;
 
 /**
- * Aborts if string doesn't match any of the algorithms.
+ * Aborts if string doesn't match any of the algorithms.  If level is given, it
+ * is set to the compression level encoded in the string ("zstd:N") or to 0 for
+ * the default level.
  */
-Algorithms ParseCompressionAlgorithm(const std::string &algorithm_option) {
+Algorithms ParseCompressionAlgorithm(const std::string &algorithm_option,
+                                     int *level)
+{
+  if (level != NULL)
+    *level = 0;
   if ((algorithm_option == "default") || (algorithm_option == "zlib"))
     return kZlibDefault;
   if (algorithm_option == "none")
     return kNoCompression;
+#ifdef HAS_ZSTD_LZ4
+  if (algorithm_option == "lz4")
+    return kLz4;
+  if (algorithm_option == "zstd")
+    return kZstd;
+  if (HasPrefix(algorithm_option, "zstd:", false /* ignore_case */)) {
+    uint64_t parsed_level;
+    if (String2Uint64Parse(algorithm_option.substr(5), &parsed_level) &&
+        (parsed_level >= 1) &&
+        (parsed_level <= static_cast<uint64_t>(ZSTD_maxCLevel())))
+    {
+      if (level != NULL)
+        *level = static_cast<int>(parsed_level);
+      return kZstd;
+    }
+  }
+#else
+  if ((algorithm_option == "lz4") ||
+      HasPrefix(algorithm_option, "zstd", false /* ignore_case */))
+  {
+    PANIC(kLogStderr, "compression algorithm %s not supported by this build",
+          algorithm_option.c_str());
+  }
+#endif
   PANIC(kLogStderr, "unknown compression algorithms: %s",
         algorithm_option.c_str());
 }
@@ -163,6 +201,12 @@ std::string AlgorithmName(const zlib::Algorithms alg) {
     case kNoCompression:
       return "none";
       break;
+    case kZstd:
+      return "zstd";
+      break;
+    case kLz4:
+      return "lz4";
+      break;
     // Purposely did not add a 'default' statement here: this will
     // cause the compiler to generate a warning if a new algorithm
     // is added but this function is not updated.
@@ -675,6 +719,65 @@ bool DecompressPath2File(const string &src, FILE *fdest) {
 }
 
 
+/**
+ * Compresses with any of the Compressor algorithms.
+ */
+bool CompressFile2File(FILE *fsrc, FILE *fdest, const Algorithms alg,
+                       const int level)
+{
+  UniquePtr<Compressor> compressor(Compressor::Construct(alg));
+  if (!compressor.IsValid())
+    return false;
+  compressor->SetLevel(level);
+
+  unsigned char in[kZChunk];
+  unsigned char out[kZChunk];
+  bool done;
+  do {
+    size_t have = fread(in, 1, kZChunk, fsrc);
+    if (ferror(fsrc))
+      return false;
+    const bool flush = feof(fsrc);
+    unsigned char *next_in = in;
+    do {
+      unsigned char *next_out = out;
+      size_t out_size = kZChunk;
+      done = compressor->Deflate(flush, &next_in, &have, &next_out, &out_size);
+      if ((fwrite(out, 1, out_size, fdest) != out_size) || ferror(fdest))
+        return false;
+    } while ((have > 0) || (flush && !done));
+    if (flush)
+      break;
+  } while (true);
+
+  return done;
+}
+
+
+/**
+ * Decompresses with any of the Decompressor algorithms.
+ */
+bool DecompressFile2Sink(FILE *fsrc, const Algorithms alg, cvmfs::Sink *sink) {
+  UniquePtr<Decompressor> decompressor(Decompressor::Construct(alg));
+  if (!decompressor.IsValid())
+    return false;
+
+  StreamStates stream_state = kStreamContinue;
+  size_t have;
+  unsigned char buf[kBufferSize];
+  while ((have = fread(buf, 1, kBufferSize, fsrc)) > 0) {
+    stream_state = decompressor->Inflate(buf, have, sink);
+    if ((stream_state == kStreamDataError) || (stream_state == kStreamIOError))
+      return false;
+  }
+  if (ferror(fsrc))
+    return false;
+  // Uncompressed data have no end marker
+  return (stream_state == kStreamEnd) ||
+         ((alg == kNoCompression) && (stream_state == kStreamContinue));
+}
+
+
 bool CompressMem2File(const unsigned char *buf, const size_t size,
                       FILE *fdest, shash::Any *compressed_hash) {
   int z_ret = 0;
@@ -858,6 +961,10 @@ bool DecompressMem2Mem(const void *buf, const int64_t size,
 void Compressor::RegisterPlugins() {
   RegisterPlugin<ZlibCompressor>();
   RegisterPlugin<EchoCompressor>();
+#ifdef HAS_ZSTD_LZ4
+  RegisterPlugin<ZstdCompressor>();
+  RegisterPlugin<Lz4Compressor>();
+#endif
 }
 
 
@@ -979,4 +1086,372 @@ size_t EchoCompressor::DeflateBound(const size_t bytes) {
   return (bytes == 0) ? 1 : bytes;
 }
 
+
+
+#ifdef HAS_ZSTD_LZ4
+//------------------------------------------------------------------------------
+
+
+const int ZstdCompressor::kDefaultLevel;
+
+
+bool ZstdCompressor::WillHandle(const zlib::Algorithms &alg) {
+  return alg == kZstd;
+}
+
+
+ZstdCompressor::ZstdCompressor(const Algorithms &alg)
+  : Compressor(alg)
+  , level_(0)
+  , stream_(ZSTD_createCCtx())
+{
+  assert(stream_ != NULL);
+  SetLevel(kDefaultLevel);
+}
+
+
+void ZstdCompressor::SetLevel(const int level) {
+  level_ = (level == 0) ? static_cast<int>(kDefaultLevel) : level;
+  const size_t retval =
+    ZSTD_CCtx_setParameter(stream_, ZSTD_c_compressionLevel, level_);
+  assert(!ZSTD_isError(retval));
+}
+
+
+ZstdCompressor::~ZstdCompressor() {
+  ZSTD_freeCCtx(stream_);
+}
+
+
+/**
+ * The zstd stream state cannot be copied once compression started, only the
+ * parameters are.  Therefore, the compressor must be cloned before it is fed.
+ */
+Compressor* ZstdCompressor::Clone() {
+  ZstdCompressor *other = new ZstdCompressor(zlib::kZstd);
+  other->SetLevel(level_);
+  return other;
+}
+
+
+bool ZstdCompressor::Deflate(
+  const bool flush,
+  unsigned char **inbuf, size_t *inbufsize,
+  unsigned char **outbuf, size_t *outbufsize)
+{
+  ZSTD_inBuffer input = {*inbuf, *inbufsize, 0};
+  ZSTD_outBuffer output = {*outbuf, *outbufsize, 0};
+  const size_t remaining = ZSTD_compressStream2(stream_, &output, &input,
+    flush ? ZSTD_e_end : ZSTD_e_continue);
+  assert(!ZSTD_isError(remaining));
+
+  *outbufsize = output.pos;
+  *inbuf += input.pos;
+  *inbufsize -= input.pos;
+
+  if (flush)
+    return remaining == 0;
+  return *inbufsize == 0;
+}
+
+
+size_t ZstdCompressor::DeflateBound(const size_t bytes) {
+  return ZSTD_compressBound(bytes);
+}
+
+
+//------------------------------------------------------------------------------
+
+
+const size_t Lz4Compressor::kBlockSize;
+
+
+/**
+ * Frame parameters shared by all LZ4 compressors: 64kB blocks, everything else
+ * at the library defaults.
+ */
+static LZ4F_preferences_t Lz4Preferences() {
+  LZ4F_preferences_t preferences;
+  memset(&preferences, 0, sizeof(preferences));
+  preferences.frameInfo.blockSizeID = LZ4F_max64KB;
+  return preferences;
+}
+
+
+bool Lz4Compressor::WillHandle(const zlib::Algorithms &alg) {
+  return alg == kLz4;
+}
+
+
+Lz4Compressor::Lz4Compressor(const Algorithms &alg)
+  : Compressor(alg)
+  , stream_(NULL)
+  , is_started_(false)
+  , is_finished_(false)
+  , staging_(NULL)
+  , staging_capacity_(0)
+  , staging_size_(0)
+  , staging_pos_(0)
+{
+  const LZ4F_errorCode_t retval =
+    LZ4F_createCompressionContext(&stream_, LZ4F_VERSION);
+  assert(!LZ4F_isError(retval));
+  const LZ4F_preferences_t preferences = Lz4Preferences();
+  staging_capacity_ = max(LZ4F_compressBound(kBlockSize, &preferences),
+                          static_cast<size_t>(LZ4F_HEADER_SIZE_MAX));
+  staging_ = static_cast<unsigned char *>(smalloc(staging_capacity_));
+}
+
+
+Lz4Compressor::~Lz4Compressor() {
+  free(staging_);
+  LZ4F_freeCompressionContext(stream_);
+}
+
+
+/**
+ * Like for zstd, only the parameters are cloned.
+ */
+Compressor* Lz4Compressor::Clone() {
+  return new Lz4Compressor(zlib::kLz4);
+}
+
+
+bool Lz4Compressor::Deflate(
+  const bool flush,
+  unsigned char **inbuf, size_t *inbufsize,
+  unsigned char **outbuf, size_t *outbufsize)
+{
+  size_t out_pos = 0;
+  while (true) {
+    // Hand out the staged compressed data first
+    const size_t nstaged = staging_size_ - staging_pos_;
+    const size_t ncopy = min(*outbufsize - out_pos, nstaged);
+    memcpy(*outbuf + out_pos, staging_ + staging_pos_, ncopy);
+    out_pos += ncopy;
+    staging_pos_ += ncopy;
+    if (staging_pos_ < staging_size_)
+      break;
+    staging_size_ = staging_pos_ = 0;
+
+    size_t retval;
+    if (!is_started_) {
+      const LZ4F_preferences_t preferences = Lz4Preferences();
+      retval = LZ4F_compressBegin(stream_, staging_, staging_capacity_,
+                                  &preferences);
+      is_started_ = true;
+    } else if (*inbufsize > 0) {
+      const size_t nbytes = min(*inbufsize, kBlockSize);
+      retval = LZ4F_compressUpdate(stream_, staging_, staging_capacity_,
+                                   *inbuf, nbytes, NULL);
+      *inbuf += nbytes;
+      *inbufsize -= nbytes;
+    } else if (flush && !is_finished_) {
+      retval = LZ4F_compressEnd(stream_, staging_, staging_capacity_, NULL);
+      is_finished_ = true;
+    } else {
+      break;
+    }
+    assert(!LZ4F_isError(retval));
+    staging_size_ = retval;
+  }
+  *outbufsize = out_pos;
+
+  if (!flush)
+    return *inbufsize == 0;
+  if (!is_finished_ || (staging_size_ > 0))
+    return false;
+  // Frame complete, a new one starts with the next Deflate()
+  is_started_ = is_finished_ = false;
+  return true;
+}
+
+
+size_t Lz4Compressor::DeflateBound(const size_t bytes) {
+  const LZ4F_preferences_t preferences = Lz4Preferences();
+  return LZ4F_compressFrameBound(bytes, &preferences);
+}
+#endif  // HAS_ZSTD_LZ4
+
+
+//------------------------------------------------------------------------------
+
+
+void Decompressor::RegisterPlugins() {
+  RegisterPlugin<ZlibDecompressor>();
+  RegisterPlugin<EchoDecompressor>();
+#ifdef HAS_ZSTD_LZ4
+  RegisterPlugin<ZstdDecompressor>();
+  RegisterPlugin<Lz4Decompressor>();
+#endif
+}
+
+
+bool ZlibDecompressor::WillHandle(const zlib::Algorithms &alg) {
+  return alg == kZlibDefault;
+}
+
+
+ZlibDecompressor::ZlibDecompressor(const Algorithms &alg)
+  : Decompressor(alg)
+{
+  DecompressInit(&stream_);
+}
+
+
+ZlibDecompressor::~ZlibDecompressor() {
+  DecompressFini(&stream_);
+}
+
+
+StreamStates ZlibDecompressor::Inflate(
+  const void *buf,
+  const int64_t size,
+  cvmfs::Sink *sink)
+{
+  return DecompressZStream2Sink(buf, size, &stream_, sink);
+}
+
+
+void ZlibDecompressor::Reset() {
+  const int retval = inflateReset(&stream_);
+  assert(retval == Z_OK);
+}
+
+
+//------------------------------------------------------------------------------
+
+
+bool EchoDecompressor::WillHandle(const zlib::Algorithms &alg) {
+  return alg == kNoCompression;
+}
+
+
+StreamStates EchoDecompressor::Inflate(
+  const void *buf,
+  const int64_t size,
+  cvmfs::Sink *sink)
+{
+  const int64_t written = sink->Write(buf, size);
+  if ((written < 0) || (written != size))
+    return kStreamIOError;
+  return kStreamContinue;
+}
+
+
+#ifdef HAS_ZSTD_LZ4
+//------------------------------------------------------------------------------
+
+
+bool ZstdDecompressor::WillHandle(const zlib::Algorithms &alg) {
+  return alg == kZstd;
+}
+
+
+ZstdDecompressor::ZstdDecompressor(const Algorithms &alg)
+  : Decompressor(alg)
+  , stream_(ZSTD_createDCtx())
+{
+  assert(stream_ != NULL);
+}
+
+
+ZstdDecompressor::~ZstdDecompressor() {
+  ZSTD_freeDCtx(stream_);
+}
+
+
+StreamStates ZstdDecompressor::Inflate(
+  const void *buf,
+  const int64_t size,
+  cvmfs::Sink *sink)
+{
+  unsigned char out[kZChunk];
+  ZSTD_inBuffer input = {buf, static_cast<size_t>(size), 0};
+  size_t retval;
+  bool is_output_full;
+  do {
+    ZSTD_outBuffer output = {out, kZChunk, 0};
+    retval = ZSTD_decompressStream(stream_, &output, &input);
+    if (ZSTD_isError(retval))
+      return kStreamDataError;
+    if (output.pos > 0) {
+      const int64_t written = sink->Write(out, output.pos);
+      if ((written < 0) || (static_cast<uint64_t>(written) != output.pos))
+        return kStreamIOError;
+    }
+    // A completed frame is fully flushed
+    is_output_full = (output.pos == output.size) && (retval != 0);
+  } while ((input.pos < input.size) || is_output_full);
+
+  return (retval == 0) ? kStreamEnd : kStreamContinue;
+}
+
+
+void ZstdDecompressor::Reset() {
+  const size_t retval = ZSTD_DCtx_reset(stream_, ZSTD_reset_session_only);
+  assert(!ZSTD_isError(retval));
+}
+
+
+//------------------------------------------------------------------------------
+
+
+bool Lz4Decompressor::WillHandle(const zlib::Algorithms &alg) {
+  return alg == kLz4;
+}
+
+
+Lz4Decompressor::Lz4Decompressor(const Algorithms &alg)
+  : Decompressor(alg)
+  , stream_(NULL)
+{
+  const LZ4F_errorCode_t retval =
+    LZ4F_createDecompressionContext(&stream_, LZ4F_VERSION);
+  assert(!LZ4F_isError(retval));
+}
+
+
+Lz4Decompressor::~Lz4Decompressor() {
+  LZ4F_freeDecompressionContext(stream_);
+}
+
+
+StreamStates Lz4Decompressor::Inflate(
+  const void *buf,
+  const int64_t size,
+  cvmfs::Sink *sink)
+{
+  unsigned char out[kZChunk];
+  const unsigned char *next_in = static_cast<const unsigned char *>(buf);
+  size_t remaining = size;
+  size_t retval;
+  bool is_output_full;
+  do {
+    size_t nbytes_out = kZChunk;
+    size_t nbytes_in = remaining;
+    retval =
+      LZ4F_decompress(stream_, out, &nbytes_out, next_in, &nbytes_in, NULL);
+    if (LZ4F_isError(retval))
+      return kStreamDataError;
+    next_in += nbytes_in;
+    remaining -= nbytes_in;
+    if (nbytes_out > 0) {
+      const int64_t written = sink->Write(out, nbytes_out);
+      if ((written < 0) || (static_cast<uint64_t>(written) != nbytes_out))
+        return kStreamIOError;
+    }
+    // A completed frame is fully flushed
+    is_output_full = (nbytes_out == kZChunk) && (retval != 0);
+  } while ((remaining > 0) || is_output_full);
+
+  return (retval == 0) ? kStreamEnd : kStreamContinue;
+}
+
+
+void Lz4Decompressor::Reset() {
+  LZ4F_resetDecompressionContext(stream_);
+}
+#endif  // HAS_ZSTD_LZ4
+
 }  // namespace zlib
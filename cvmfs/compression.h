@@ -20,6 +20,14 @@ struct Any;
 class ContextPtr;
 }
 
+#ifdef HAS_ZSTD_LZ4
+// Opaque stream states of libzstd and liblz4, only used through pointers
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct LZ4F_cctx_s;
+struct LZ4F_dctx_s;
+#endif
+
 bool CopyPath2Path(const std::string &src, const std::string &dest);
 bool CopyPath2File(const std::string &src, FILE *fdest);
 bool CopyMem2Path(const unsigned char *buffer, const unsigned buffer_size,
@@ -40,10 +48,13 @@ enum StreamStates {
   kStreamEnd,
 };
 
-// Do not change order of algorithms.  Used as flags in the catalog
+// Do not change order of algorithms.  Used as flags in the catalog.
+// kZstd and kLz4 are only available if built with ENABLE_ZSTD_LZ4.
 enum Algorithms {
   kZlibDefault = 0,
   kNoCompression,
+  kZstd,
+  kLz4,
 };
 
 /**
@@ -91,6 +102,12 @@ class Compressor: public PolymorphicConstruction<Compressor, Algorithms> {
   virtual size_t DeflateBound(const size_t bytes) = 0;
   virtual Compressor* Clone() = 0;
 
+  /**
+   * Selects the compression level for algorithms that have one; 0 stands for
+   * the algorithm's default.  Needs to be called before the first Deflate().
+   */
+  virtual void SetLevel(const int /* level */) { }
+
   static void RegisterPlugins();
 };
 
@@ -125,7 +142,136 @@ class EchoCompressor: public Compressor {
 };
 
 
-Algorithms ParseCompressionAlgorithm(const std::string &algorithm_option);
+#ifdef HAS_ZSTD_LZ4
+/**
+ * Zstandard frames.  The compression level can be selected as part of the
+ * algorithm name, e.g. "zstd:19", and is set per compressor instance.
+ */
+class ZstdCompressor: public Compressor {
+ public:
+  static const int kDefaultLevel = 3;
+
+  explicit ZstdCompressor(const Algorithms &alg);
+  ~ZstdCompressor();
+
+  bool Deflate(const bool flush,
+               unsigned char **inbuf, size_t *inbufsize,
+               unsigned char **outbuf, size_t *outbufsize);
+  size_t DeflateBound(const size_t bytes);
+  Compressor* Clone();
+  static bool WillHandle(const zlib::Algorithms &alg);
+
+  void SetLevel(const int level);
+  int level() const { return level_; }
+
+ private:
+  int level_;
+  ZSTD_CCtx_s *stream_;
+};
+
+
+/**
+ * LZ4 frames.  The LZ4 frame API requires the output buffer to hold an entire
+ * compressed block, so the compressed data is staged in an internal buffer
+ * and handed out in pieces of the size requested by the caller.
+ */
+class Lz4Compressor: public Compressor {
+ public:
+  explicit Lz4Compressor(const Algorithms &alg);
+  ~Lz4Compressor();
+
+  bool Deflate(const bool flush,
+               unsigned char **inbuf, size_t *inbufsize,
+               unsigned char **outbuf, size_t *outbufsize);
+  size_t DeflateBound(const size_t bytes);
+  Compressor* Clone();
+  static bool WillHandle(const zlib::Algorithms &alg);
+
+ private:
+  static const size_t kBlockSize = 64 * 1024;
+
+  LZ4F_cctx_s *stream_;
+  bool is_started_;
+  bool is_finished_;
+  unsigned char *staging_;
+  size_t staging_capacity_;
+  size_t staging_size_;
+  size_t staging_pos_;
+};
+#endif  // HAS_ZSTD_LZ4
+
+
+/**
+ * Counterpart of the Compressor for stream decompression into a sink, as used
+ * by the download manager.  Data arrive in arbitrary pieces through Inflate().
+ * Reset() prepares the decompressor for a new stream, e.g. after a failed
+ * download attempt.
+ */
+class Decompressor: public PolymorphicConstruction<Decompressor, Algorithms> {
+ public:
+  explicit Decompressor(const Algorithms & /* alg */) { }
+  virtual ~Decompressor() { }
+
+  virtual StreamStates Inflate(const void *buf, const int64_t size,
+                               cvmfs::Sink *sink) = 0;
+  virtual void Reset() = 0;
+
+  static void RegisterPlugins();
+};
+
+
+class ZlibDecompressor: public Decompressor {
+ public:
+  explicit ZlibDecompressor(const Algorithms &alg);
+  ~ZlibDecompressor();
+  StreamStates Inflate(const void *buf, const int64_t size, cvmfs::Sink *sink);
+  void Reset();
+  static bool WillHandle(const zlib::Algorithms &alg);
+
+ private:
+  z_stream stream_;
+};
+
+
+class EchoDecompressor: public Decompressor {
+ public:
+  explicit EchoDecompressor(const Algorithms &alg) : Decompressor(alg) { }
+  StreamStates Inflate(const void *buf, const int64_t size, cvmfs::Sink *sink);
+  void Reset() { }
+  static bool WillHandle(const zlib::Algorithms &alg);
+};
+
+
+#ifdef HAS_ZSTD_LZ4
+class ZstdDecompressor: public Decompressor {
+ public:
+  explicit ZstdDecompressor(const Algorithms &alg);
+  ~ZstdDecompressor();
+  StreamStates Inflate(const void *buf, const int64_t size, cvmfs::Sink *sink);
+  void Reset();
+  static bool WillHandle(const zlib::Algorithms &alg);
+
+ private:
+  ZSTD_DCtx_s *stream_;
+};
+
+
+class Lz4Decompressor: public Decompressor {
+ public:
+  explicit Lz4Decompressor(const Algorithms &alg);
+  ~Lz4Decompressor();
+  StreamStates Inflate(const void *buf, const int64_t size, cvmfs::Sink *sink);
+  void Reset();
+  static bool WillHandle(const zlib::Algorithms &alg);
+
+ private:
+  LZ4F_dctx_s *stream_;
+};
+#endif  // HAS_ZSTD_LZ4
+
+
+Algorithms ParseCompressionAlgorithm(const std::string &algorithm_option,
+                                     int *level = NULL);
 std::string AlgorithmName(const zlib::Algorithms alg);
 
 
@@ -158,6 +304,10 @@ bool CompressPath2File(const std::string &src, FILE *fdest,
 bool DecompressFile2File(FILE *fsrc, FILE *fdest);
 bool DecompressPath2File(const std::string &src, FILE *fdest);
 
+bool CompressFile2File(FILE *fsrc, FILE *fdest, const Algorithms alg,
+                       const int level = 0);
+bool DecompressFile2Sink(FILE *fsrc, const Algorithms alg, cvmfs::Sink *sink);
+
 bool CompressMem2File(const unsigned char *buf, const size_t size,
                       FILE *fdest, shash::Any *compressed_hash);
 
@@ -520,6 +520,43 @@ CVMFS_EXPORT void HashMem(const unsigned char *buffer,
                           const unsigned buffer_size,
                           Any *any_digest);
 CVMFS_EXPORT void HashString(const std::string &content, Any *any_digest);
+
+/**
+ * One step of a batch of independent hash operations, see UpdateBatch().
+ */
+struct CVMFS_EXPORT BatchItem {
+  BatchItem() : buffer(NULL), size(0) { }
+  BatchItem(const unsigned char *b, const unsigned s, ContextPtr c)
+    : buffer(b), size(s), context(c) { }
+  const unsigned char *buffer;
+  unsigned size;
+  ContextPtr context;
+};
+
+/**
+ * Equivalent to calling Update() for every item but SHA-1 contexts are
+ * processed in SIMD lanes, several streams at once.  The contexts of the items
+ * must be distinct.  Other algorithms are updated one after another.
+ */
+CVMFS_EXPORT void UpdateBatch(const BatchItem *items, const unsigned num_items);
+/**
+ * Like HashMem() for num_buffers buffers.  The algorithm is taken from the
+ * digests.
+ */
+CVMFS_EXPORT void HashMemBatch(const unsigned char * const *buffers,
+                               const unsigned *buffer_sizes,
+                               const unsigned num_buffers,
+                               Any *digests);
+/**
+ * Number of SHA-1 streams hashed at once by UpdateBatch(), 1 if the streams
+ * are hashed one after another by OpenSSL.  By default, it is chosen according
+ * to the CPU: 16 with AVX-512, 8 with AVX2 unless the CPU has SHA instructions
+ * (which OpenSSL uses), 1 otherwise.  Tests and benchmarks can force 1, 4, 8,
+ * or 16 lanes; setting 0 restores the default.
+ */
+CVMFS_EXPORT unsigned GetBatchLanes();
+CVMFS_EXPORT void SetBatchLanes(const unsigned num_lanes);
+
 CVMFS_EXPORT void Hmac(const std::string &key,
                        const unsigned char *buffer,
                        const unsigned buffer_size,
@@ -0,0 +1,376 @@
+/**
+ * This file is part of the CernVM File System.
+ *
+ * Multi-buffer SHA-1: the compression function runs on vectors of 32bit
+ * words, one vector element (lane) per independent stream.  The vectors are
+ * compiled for the baseline instruction set (4 lanes, SSE2 on x86_64), for
+ * AVX2 (8 lanes), and for AVX-512 (16 lanes).  Streams of different length
+ * are scheduled onto the lanes as they become free.  The state of a stream is
+ * kept in its OpenSSL SHA_CTX so that the lanes can be mixed freely with
+ * SHA1_Update() calls.
+ */
+
+#include "cvmfs_config.h"
+#include "crypto/hash.h"
+
+#include <alloca.h>
+#include <openssl/sha.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+#include "util/atomic.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#define CVMFS_HASH_BATCH_X86
+#endif
+
+using namespace std;  // NOLINT
+
+#ifdef CVMFS_NAMESPACE_GUARD
+namespace CVMFS_NAMESPACE_GUARD {
+#endif
+
+namespace shash {
+
+namespace {
+
+const unsigned kSha1BlockSize = 64;
+
+typedef uint32_t Vec4 __attribute__((vector_size(16)));
+#ifdef CVMFS_HASH_BATCH_X86
+typedef uint32_t Vec8 __attribute__((vector_size(32)));
+typedef uint32_t Vec16 __attribute__((vector_size(64)));
+// The helpers are always inlined, their calling convention does not matter
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+/**
+ * The part of a SHA-1 stream that consists of full blocks
+ */
+struct Sha1Stream {
+  Sha1Stream() : ctx(NULL), data(NULL), num_blocks(0) { }
+  Sha1Stream(SHA_CTX *c, const unsigned char *d, uint64_t n)
+    : ctx(c), data(d), num_blocks(n) { }
+  SHA_CTX *ctx;
+  const unsigned char *data;
+  uint64_t num_blocks;
+};
+
+/**
+ * Processes num_blocks blocks in every lane.  The data pointers advance by
+ * step[i] bytes per block, which is 0 for unused lanes.
+ */
+typedef void (*CompressFn)(uint32_t * const *state,
+                           const unsigned char **data,
+                           const unsigned *step,
+                           uint64_t num_blocks);
+
+
+template <class V>
+inline __attribute__((always_inline)) V Rotl(const V x, const unsigned n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+
+template <class V, unsigned N>
+inline __attribute__((always_inline)) V LoadWord(
+  const unsigned char * const *data,
+  const unsigned offset)
+{
+  V w;
+  for (unsigned i = 0; i < N; ++i) {
+    uint32_t x;
+    memcpy(&x, data[i] + offset, sizeof(x));
+    w[i] = __builtin_bswap32(x);
+  }
+  return w;
+}
+
+
+template <class V, unsigned N>
+inline __attribute__((always_inline)) void Sha1Compress(
+  uint32_t * const *state,
+  const unsigned char **data,
+  const unsigned *step,
+  uint64_t num_blocks)
+{
+  V a, b, c, d, e;
+  for (unsigned i = 0; i < N; ++i) {
+    a[i] = state[i][0];
+    b[i] = state[i][1];
+    c[i] = state[i][2];
+    d[i] = state[i][3];
+    e[i] = state[i][4];
+  }
+
+  for (; num_blocks > 0; --num_blocks) {
+    V w[16];
+    for (unsigned t = 0; t < 16; ++t)
+      w[t] = LoadWord<V, N>(data, 4 * t);
+    const V a0 = a, b0 = b, c0 = c, d0 = d, e0 = e;
+
+#define CVMFS_SHA1_ROUND(t, f, k) { \
+    if ((t) >= 16) { \
+      w[(t) & 15] = Rotl(w[((t) - 3) & 15] ^ w[((t) - 8) & 15] ^ \
+                         w[((t) - 14) & 15] ^ w[(t) & 15], 1); \
+    } \
+    const V tmp = Rotl(a, 5) + (f) + e + (k) + w[(t) & 15]; \
+    e = d; d = c; c = Rotl(b, 30); b = a; a = tmp; }
+
+    for (unsigned t = 0; t < 20; ++t)
+      CVMFS_SHA1_ROUND(t, (b & c) | (~b & d), 0x5A827999U);
+    for (unsigned t = 20; t < 40; ++t)
+      CVMFS_SHA1_ROUND(t, b ^ c ^ d, 0x6ED9EBA1U);
+    for (unsigned t = 40; t < 60; ++t)
+      CVMFS_SHA1_ROUND(t, (b & c) | (b & d) | (c & d), 0x8F1BBCDCU);
+    for (unsigned t = 60; t < 80; ++t)
+      CVMFS_SHA1_ROUND(t, b ^ c ^ d, 0xCA62C1D6U);
+#undef CVMFS_SHA1_ROUND
+
+    a += a0; b += b0; c += c0; d += d0; e += e0;
+    for (unsigned i = 0; i < N; ++i)
+      data[i] += step[i];
+  }
+
+  for (unsigned i = 0; i < N; ++i) {
+    state[i][0] = a[i];
+    state[i][1] = b[i];
+    state[i][2] = c[i];
+    state[i][3] = d[i];
+    state[i][4] = e[i];
+  }
+}
+
+
+void Sha1Compress4(uint32_t * const *state, const unsigned char **data,
+                   const unsigned *step, uint64_t num_blocks)
+{
+  Sha1Compress<Vec4, 4>(state, data, step, num_blocks);
+}
+
+#ifdef CVMFS_HASH_BATCH_X86
+__attribute__((target("avx2")))
+void Sha1Compress8(uint32_t * const *state, const unsigned char **data,
+                   const unsigned *step, uint64_t num_blocks)
+{
+  Sha1Compress<Vec8, 8>(state, data, step, num_blocks);
+}
+
+__attribute__((target("avx512f")))
+void Sha1Compress16(uint32_t * const *state, const unsigned char **data,
+                    const unsigned *step, uint64_t num_blocks)
+{
+  Sha1Compress<Vec16, 16>(state, data, step, num_blocks);
+}
+#endif
+
+
+/**
+ * Same bookkeeping as SHA1_Update(): the message length in bits
+ */
+void AddBlocks(SHA_CTX *ctx, const uint64_t num_blocks) {
+  uint64_t bits = (static_cast<uint64_t>(ctx->Nh) << 32) | ctx->Nl;
+  bits += num_blocks * kSha1BlockSize * 8;
+  ctx->Nl = static_cast<SHA_LONG>(bits);
+  ctx->Nh = static_cast<SHA_LONG>(bits >> 32);
+}
+
+
+/**
+ * Distributes the streams over the N lanes of compress.  Once there are no
+ * more streams waiting and half of the lanes are idle, the rest is handed to
+ * OpenSSL, which is faster for a few streams.
+ */
+template <unsigned N>
+void RunLanes(CompressFn compress, Sha1Stream *streams, unsigned num_streams) {
+  static const unsigned char kZeroBlock[kSha1BlockSize] = { 0 };
+  // Idle lanes hash zero blocks into a throw-away state
+  uint32_t dummy_state[N][5];
+  memset(dummy_state, 0, sizeof(dummy_state));
+  uint32_t *state[N];
+  const unsigned char *data[N];
+  unsigned step[N];
+  Sha1Stream *lanes[N];
+  for (unsigned i = 0; i < N; ++i)
+    lanes[i] = NULL;
+
+  unsigned next = 0;
+  while (true) {
+    unsigned num_active = 0;
+    uint64_t num_blocks = uint64_t(-1);
+    for (unsigned i = 0; i < N; ++i) {
+      if ((lanes[i] == NULL) && (next < num_streams))
+        lanes[i] = &streams[next++];
+      if (lanes[i] == NULL)
+        continue;
+      num_active++;
+      num_blocks = std::min(num_blocks, lanes[i]->num_blocks);
+    }
+    if ((num_active == 0) || ((next == num_streams) && (num_active <= N / 2)))
+      break;
+
+    for (unsigned i = 0; i < N; ++i) {
+      if (lanes[i] == NULL) {
+        state[i] = dummy_state[i];
+        data[i] = kZeroBlock;
+        step[i] = 0;
+      } else {
+        state[i] = &lanes[i]->ctx->h0;
+        data[i] = lanes[i]->data;
+        step[i] = kSha1BlockSize;
+      }
+    }
+    compress(state, data, step, num_blocks);
+    for (unsigned i = 0; i < N; ++i) {
+      if (lanes[i] == NULL)
+        continue;
+      AddBlocks(lanes[i]->ctx, num_blocks);
+      lanes[i]->data = data[i];
+      lanes[i]->num_blocks -= num_blocks;
+      if (lanes[i]->num_blocks == 0)
+        lanes[i] = NULL;
+    }
+  }
+
+  for (unsigned i = 0; i < N; ++i) {
+    if (lanes[i] == NULL)
+      continue;
+    SHA1_Update(lanes[i]->ctx, lanes[i]->data,
+                lanes[i]->num_blocks * kSha1BlockSize);
+  }
+}
+
+
+bool HasShaExtensions() {
+#ifdef CVMFS_HASH_BATCH_X86
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    return false;
+  return ebx & (1U << 29);
+#else
+  return false;
+#endif
+}
+
+
+/**
+ * One stream through OpenSSL runs at about the speed of 4 lanes of SSE2, and
+ * SHA instructions beat 8 lanes of AVX2, not 16 lanes of AVX-512.
+ */
+unsigned DetectBatchLanes() {
+#ifdef CVMFS_HASH_BATCH_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return 16;
+  if (HasShaExtensions())
+    return 1;
+  if (__builtin_cpu_supports("avx2"))
+    return 8;
+#endif
+  return 1;
+}
+
+atomic_int32 g_batch_lanes = 0;
+
+}  // anonymous namespace
+
+
+unsigned GetBatchLanes() {
+  int32_t num_lanes = atomic_read32(&g_batch_lanes);
+  if (num_lanes == 0) {
+    num_lanes = DetectBatchLanes();
+    atomic_write32(&g_batch_lanes, num_lanes);
+  }
+  return num_lanes;
+}
+
+
+void SetBatchLanes(const unsigned num_lanes) {
+  assert((num_lanes == 0) || (num_lanes == 1) || (num_lanes == 4) ||
+         (num_lanes == 8) || (num_lanes == 16));
+#ifndef CVMFS_HASH_BATCH_X86
+  assert(num_lanes <= 4);
+#endif
+  atomic_write32(&g_batch_lanes, num_lanes);
+}
+
+
+void UpdateBatch(const BatchItem *items, const unsigned num_items) {
+  const unsigned num_lanes = GetBatchLanes();
+  vector<Sha1Stream> streams;
+  vector<BatchItem> tails;
+
+  for (unsigned i = 0; i < num_items; ++i) {
+    if ((num_lanes == 1) || (items[i].context.algorithm != kSha1)) {
+      Update(items[i].buffer, items[i].size, items[i].context);
+      continue;
+    }
+
+    assert(items[i].context.size == sizeof(SHA_CTX));
+    SHA_CTX *ctx = reinterpret_cast<SHA_CTX *>(items[i].context.buffer);
+    const unsigned char *buffer = items[i].buffer;
+    unsigned size = items[i].size;
+    // Complete a partial block from a previous update
+    if ((ctx->num > 0) && (size > 0)) {
+      const unsigned nbytes = std::min(kSha1BlockSize - ctx->num, size);
+      SHA1_Update(ctx, buffer, nbytes);
+      buffer += nbytes;
+      size -= nbytes;
+    }
+    const unsigned num_blocks = size / kSha1BlockSize;
+    if (num_blocks > 0)
+      streams.push_back(Sha1Stream(ctx, buffer, num_blocks));
+    const unsigned tail = size % kSha1BlockSize;
+    if (tail > 0) {
+      tails.push_back(BatchItem(buffer + num_blocks * kSha1BlockSize, tail,
+                                items[i].context));
+    }
+  }
+
+  if (!streams.empty()) {
+#ifdef CVMFS_HASH_BATCH_X86
+    if (num_lanes == 16)
+      RunLanes<16>(Sha1Compress16, &streams[0], streams.size());
+    else if (num_lanes == 8)
+      RunLanes<8>(Sha1Compress8, &streams[0], streams.size());
+    else
+#endif
+      RunLanes<4>(Sha1Compress4, &streams[0], streams.size());
+  }
+  for (unsigned i = 0; i < tails.size(); ++i) {
+    SHA1_Update(reinterpret_cast<SHA_CTX *>(tails[i].context.buffer),
+                tails[i].buffer, tails[i].size);
+  }
+}
+
+
+void HashMemBatch(
+  const unsigned char * const *buffers,
+  const unsigned *buffer_sizes,
+  const unsigned num_buffers,
+  Any *digests)
+{
+  if (num_buffers == 0)
+    return;
+  vector<BatchItem> items(num_buffers);
+  for (unsigned i = 0; i < num_buffers; ++i) {
+    ContextPtr context(digests[i].algorithm);
+    context.buffer = alloca(context.size);
+    Init(context);
+    items[i] = BatchItem(buffers[i], buffer_sizes[i], context);
+  }
+  UpdateBatch(&items[0], num_buffers);
+  for (unsigned i = 0; i < num_buffers; ++i)
+    Final(items[i].context, &digests[i]);
+}
+
+}  // namespace shash
+
+#ifdef CVMFS_NAMESPACE_GUARD
+}  // namespace CVMFS_NAMESPACE_GUARD
+#endif
@@ -71,6 +71,8 @@
 #include "cache_posix.h"
 #include "cache_stream.h"
 #include "catalog_mgr_client.h"
+#include "catalog_prefetch.h"
+#include "chunk_prefetch.h"
 #include "clientctx.h"
 #include "compat.h"
 #include "compression.h"
@@ -92,6 +94,7 @@
 #include "lru_md.h"
 #include "magic_xattr.h"
 #include "manifest_fetch.h"
+#include "md_snapshot.h"
 #include "monitor.h"
 #include "mountpoint.h"
 #include "network/download.h"
@@ -1446,6 +1449,11 @@ static void cvmfs_read(fuse_req_t req, fuse_ino_t ino, size_t size, off_t off,
           return;
         }
         chunk_fd.chunk_idx = chunk_idx;
+
+        if (mount_point_->chunk_prefetcher() != NULL) {
+          mount_point_->chunk_prefetcher()->OnOpenChunk(
+            chunk_handle, chunk_idx, chunks, label, this_fetcher);
+        }
       }
 
       LogCvmfs(kLogCvmfs, kLogDebug, "reading from chunk fd %d",
@@ -1570,6 +1578,12 @@ static void cvmfs_release(fuse_req_t req, fuse_ino_t ino,
     assert(retval);
     chunk_tables->handle2fd.Erase(chunk_handle);
 
+    if ((mount_point_->chunk_prefetcher() != NULL) &&
+        chunk_tables->inode2chunks.Lookup(unique_inode, &chunks))
+    {
+      mount_point_->chunk_prefetcher()->OnRelease(chunk_handle, chunks);
+    }
+
     retval = chunk_tables->inode2references.Lookup(unique_inode, &refctr);
     assert(retval);
     refctr--;
@@ -2363,6 +2377,14 @@ static void Spawn() {
 
   cvmfs::mount_point_->download_mgr()->Spawn();
   cvmfs::mount_point_->external_download_mgr()->Spawn();
+  if (cvmfs::mount_point_->chunk_prefetcher() != NULL)
+    cvmfs::mount_point_->chunk_prefetcher()->Spawn();
+  if (cvmfs::mount_point_->catalog_prefetcher() != NULL)
+    cvmfs::mount_point_->catalog_prefetcher()->Spawn();
+  if (cvmfs::mount_point_->md_snapshot() != NULL) {
+    cvmfs::mount_point_->md_snapshot()->Spawn(
+      cvmfs::mount_point_->catalog_mgr());
+  }
   if (cvmfs::mount_point_->resolv_conf_watcher() != NULL) {
     cvmfs::mount_point_->resolv_conf_watcher()->Spawn();
   }
@@ -37,6 +37,7 @@ namespace catalog {
 // Create DirectoryEntries for unit test purposes.
 class DirectoryEntryTestFactory;
 
+class MetadataSnapshot;
 class MockCatalogManager;
 class Catalog;
 class WritableCatalogManager;
@@ -260,6 +261,8 @@ class DirectoryEntry : public DirectoryEntryBase {
   friend class WritableCatalogManager;
   // Create DirectoryEntries for unit test purposes.
   friend class DirectoryEntryTestFactory;
+  // Persist cached DirectoryEntry objects across mounts
+  friend class MetadataSnapshot;
 
  public:
   /**
@@ -49,7 +49,6 @@ void TLSDestructor(void *data) {
  * removes the pointer to it from tls_blocks_.
  */
 void Fetcher::CleanupTls(ThreadLocalStorage *tls) {
-  ClosePipe(tls->pipe_wait);
   delete tls;
 }
 
@@ -65,7 +64,6 @@ Fetcher::ThreadLocalStorage *Fetcher::GetTls() {
 
   tls = new ThreadLocalStorage();
   tls->fetcher = this;
-  MakePipe(tls->pipe_wait);
   tls->download_job.SetCompressed(true);
   tls->download_job.SetProbeHosts(true);
   int retval = pthread_setspecific(thread_local_storage_, tls);
@@ -101,36 +99,32 @@ int Fetcher::Fetch(
     return -EIO;
   }
 
-  ThreadLocalStorage *tls = GetTls();
-
   // Synchronization point: either act as a master thread for this object or
-  // enqueue to the list of waiting threads.
-  pthread_mutex_lock(lock_queues_download_);
-  ThreadQueues::iterator iDownloadQueue = queues_download_.find(object.id);
-  if (iDownloadQueue != queues_download_.end()) {
-    LogCvmfs(kLogCache, kLogDebug, "waiting for download of %s",
-             object.label.path.c_str());
-
-    iDownloadQueue->second->push_back(tls->pipe_wait[1]);
-    pthread_mutex_unlock(lock_queues_download_);
-    ReadPipe(tls->pipe_wait[0], &fd_return, sizeof(int));
-
+  // wait for the thread that is already downloading it.
+  if (!queues_download_.Claim(object.id, &fd_return)) {
     LogCvmfs(kLogCache, kLogDebug, "received from another thread fd %d for %s",
              fd_return, object.label.path.c_str());
-    return fd_return;
-  } else {
-    // Seems we are the first one, check again in the cache (race condition)
-    fd_return = OpenSelect(object);
-    if (fd_return >= 0) {
-      pthread_mutex_unlock(lock_queues_download_);
-      return fd_return;
+    // The other thread might not have pinned the object, e.g. the catalog
+    // prefetcher, so pinned objects are opened once more now that they are
+    // committed to the cache
+    if ((fd_return >= 0) &&
+        (object.label.IsCatalog() || object.label.IsPinned()))
+    {
+      cache_mgr_->Close(fd_return);
+      return OpenSelect(object);
     }
+    return fd_return;
+  }
 
-    // Create a new queue for this chunk
-    queues_download_[object.id] = &tls->other_pipes_waiting;
-    pthread_mutex_unlock(lock_queues_download_);
+  // Seems we are the first one, check again in the cache (race condition)
+  fd_return = OpenSelect(object);
+  if (fd_return >= 0) {
+    SignalWaitingThreads(fd_return, object.id);
+    return fd_return;
   }
 
+  ThreadLocalStorage *tls = GetTls();
+
   perf::Inc(n_downloads);
 
   // Involve the download manager
@@ -146,7 +140,7 @@ int Fetcher::Fetch(
   if (retval < 0) {
     LogCvmfs(kLogCache, kLogDebug, "could not start transaction on %s",
              object.label.path.c_str());
-    SignalWaitingThreads(retval, object.id, tls);
+    SignalWaitingThreads(retval, object.id);
     return retval;
   }
   cache_mgr_->CtrlTxn(object.label, 0, txn);
@@ -165,8 +159,7 @@ int Fetcher::Fetch(
              tls->download_job.GetPidPtr(),
              tls->download_job.GetInterruptCuePtr());
   }
-  tls->download_job.SetCompressed(
-                              object.label.zip_algorithm == zlib::kZlibDefault);
+  tls->download_job.SetCompressionAlgorithm(object.label.zip_algorithm);
   tls->download_job.SetRangeOffset(object.label.range_offset);
   tls->download_job.SetRangeSize(static_cast<int64_t>(object.label.size));
   download_mgr_->Fetch(&tls->download_job);
@@ -177,17 +170,17 @@ int Fetcher::Fetch(
     fd_return = cache_mgr_->OpenFromTxn(txn);
     if (fd_return < 0) {
       cache_mgr_->AbortTxn(txn);
-      SignalWaitingThreads(fd_return, object.id, tls);
+      SignalWaitingThreads(fd_return, object.id);
       return fd_return;
     }
 
     retval = cache_mgr_->CommitTxn(txn);
     if (retval < 0) {
       cache_mgr_->Close(fd_return);
-      SignalWaitingThreads(retval, object.id, tls);
+      SignalWaitingThreads(retval, object.id);
       return retval;
     }
-    SignalWaitingThreads(fd_return, object.id, tls);
+    SignalWaitingThreads(fd_return, object.id);
     return fd_return;
   }
 
@@ -200,7 +193,7 @@ int Fetcher::Fetch(
            download::Code2Ascii(tls->download_job.error_code()));
   cache_mgr_->AbortTxn(txn);
   backoff_throttle_->Throttle();
-  SignalWaitingThreads(-EIO, object.id, tls);
+  SignalWaitingThreads(-EIO, object.id);
   return -EIO;
 }
 
@@ -210,8 +203,7 @@ Fetcher::Fetcher(
   download::DownloadManager *download_mgr,
   BackoffThrottle *backoff_throttle,
   perf::StatisticsTemplate statistics)
-  : lock_queues_download_(NULL)
-  , lock_tls_blocks_(NULL)
+  : lock_tls_blocks_(NULL)
   , cache_mgr_(cache_mgr)
   , download_mgr_(download_mgr)
   , backoff_throttle_(backoff_throttle)
@@ -219,10 +211,6 @@ Fetcher::Fetcher(
   int retval;
   retval = pthread_key_create(&thread_local_storage_, TLSDestructor);
   assert(retval == 0);
-  lock_queues_download_ = reinterpret_cast<pthread_mutex_t *>(
-    smalloc(sizeof(pthread_mutex_t)));
-  retval = pthread_mutex_init(lock_queues_download_, NULL);
-  assert(retval == 0);
   lock_tls_blocks_ = reinterpret_cast<pthread_mutex_t *>(
     smalloc(sizeof(pthread_mutex_t)));
   retval = pthread_mutex_init(lock_tls_blocks_, NULL);
@@ -247,10 +235,6 @@ Fetcher::~Fetcher() {
   assert(retval == 0);
   free(lock_tls_blocks_);
 
-  retval = pthread_mutex_destroy(lock_queues_download_);
-  assert(retval == 0);
-  free(lock_queues_download_);
-
   retval = pthread_key_delete(thread_local_storage_);
   assert(retval == 0);
 }
@@ -269,18 +253,8 @@ int Fetcher::OpenSelect(const CacheManager::LabeledObject &object) {
 }
 
 
-void Fetcher::SignalWaitingThreads(
-  const int fd,
-  const shash::Any &id,
-  ThreadLocalStorage *tls)
-{
-  MutexLockGuard m(lock_queues_download_);
-  for (unsigned i = 0, s = tls->other_pipes_waiting.size(); i < s; ++i) {
-    int fd_dup = (fd >= 0) ? cache_mgr_->Dup(fd) : fd;
-    WritePipe(tls->other_pipes_waiting[i], &fd_dup, sizeof(int));
-  }
-  tls->other_pipes_waiting.clear();
-  queues_download_.erase(id);
+void Fetcher::SignalWaitingThreads(const int fd, const shash::Any &id) {
+  queues_download_.Finish(id, fd, cache_mgr_);
 }
 
 }  // namespace cvmfs
@@ -13,6 +13,7 @@
 
 #include "cache.h"
 #include "crypto/hash.h"
+#include "fetch_queues.h"
 #include "gtest/gtest_prod.h"
 #include "network/download.h"
 #include "network/sink.h"
@@ -109,6 +110,7 @@ class Fetcher : SingleCopy {
   friend void *TestGetTls(void *data);
   friend void *TestFetchCollapse(void *data);
   friend void *TestFetchCollapse2(void *data);
+  friend void *TestSignalWaiting(void *data);
   friend void TLSDestructor(void *data);
 
  public:
@@ -128,32 +130,13 @@ class Fetcher : SingleCopy {
   download::DownloadManager *download_mgr() { return download_mgr_; }
 
  private:
-  /**
-   * Multiple threads might want to download the same object at the same time.
-   * If that happens, only the first thread performs the download.  The other
-   * threads wait on a pipe for a notification from the first thread.
-   */
   struct ThreadLocalStorage {
-    ThreadLocalStorage() {
-      pipe_wait[0] = -1;
-      pipe_wait[1] = -1;
-      fetcher = NULL;
-    }
+    ThreadLocalStorage() : fetcher(NULL) { }
 
     /**
      * Used during cleanup to find tls_blocks_.
      */
     Fetcher *fetcher;
-    /**
-     * Wait on the reading end if another thread is already downloading the same
-     * object.
-     */
-    int pipe_wait[2];
-    /**
-     * Writer ends of all the pipes of threads that want to download the same
-     * object.
-     */
-    std::vector<int> other_pipes_waiting;
     /**
      * It is sufficient to construct the JobInfo object once per thread, not
      * on every call to Fetch().
@@ -161,18 +144,9 @@ class Fetcher : SingleCopy {
     download::JobInfo download_job;
   };
 
-  /**
-   * Maps currently downloaded chunks to the other_pipes_waiting member of the
-   * thread local storage of the downloading thread.  This way, a thread can
-   * enqueue itself to such an other_pipes_waiting list and gets informed when
-   * the download is completed.
-   */
-  typedef std::map< shash::Any, std::vector<int> * > ThreadQueues;
-
   ThreadLocalStorage *GetTls();
   void CleanupTls(ThreadLocalStorage *tls);
-  void SignalWaitingThreads(const int fd, const shash::Any &id,
-                            ThreadLocalStorage *tls);
+  void SignalWaitingThreads(const int fd, const shash::Any &id);
   int OpenSelect(const CacheManager::LabeledObject &object);
 
   /**
@@ -180,8 +154,12 @@ class Fetcher : SingleCopy {
    */
   pthread_key_t thread_local_storage_;
 
-  ThreadQueues queues_download_;
-  pthread_mutex_t *lock_queues_download_;
+  /**
+   * Multiple threads might want to download the same object at the same time.
+   * If that happens, only the first thread performs the download.  The other
+   * threads wait in the download queues for the result of the first thread.
+   */
+  DownloadQueues queues_download_;
 
   /**
    * All the threads register their thread local storage here, so that it can
@@ -0,0 +1,116 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "fetch_queues.h"
+
+#include <cassert>
+
+#include "cache.h"
+#include "util/concurrency.h"
+
+using namespace std;  // NOLINT
+
+namespace cvmfs {
+
+DownloadQueues::Inflight::Inflight() : num_waiting(0), is_finished(false) {
+  int retval = pthread_cond_init(&cond_finished, NULL);
+  assert(retval == 0);
+}
+
+
+DownloadQueues::Inflight::~Inflight() {
+  pthread_cond_destroy(&cond_finished);
+}
+
+
+DownloadQueues::DownloadQueues() {
+  for (unsigned i = 0; i < kNumShards; ++i) {
+    int retval = pthread_mutex_init(&shards_[i].lock, NULL);
+    assert(retval == 0);
+  }
+}
+
+
+DownloadQueues::~DownloadQueues() {
+  for (unsigned i = 0; i < kNumShards; ++i) {
+    assert(shards_[i].inflight.empty());
+    pthread_mutex_destroy(&shards_[i].lock);
+  }
+}
+
+
+/**
+ * Either registers the calling thread as the downloader of id and returns true,
+ * or waits for the thread that is already downloading id and returns false.
+ * In the latter case, result is set to the outcome of the download: a file
+ * descriptor owned by the caller or -errno.  The downloader must call Finish().
+ */
+bool DownloadQueues::Claim(const shash::Any &id, int *result) {
+  Shard *shard = GetShard(id);
+  MutexLockGuard guard(&shard->lock);
+
+  map<shash::Any, Inflight *>::iterator iter = shard->inflight.find(id);
+  if (iter == shard->inflight.end()) {
+    shard->inflight[id] = new Inflight();
+    return true;
+  }
+
+  Inflight *inflight = iter->second;
+  inflight->num_waiting++;
+  while (!inflight->is_finished) {
+    int retval = pthread_cond_wait(&inflight->cond_finished, &shard->lock);
+    assert(retval == 0);
+  }
+  assert(!inflight->results.empty());
+  *result = inflight->results.back();
+  inflight->results.pop_back();
+  if (--inflight->num_waiting == 0)
+    delete inflight;
+  return false;
+}
+
+
+/**
+ * Publishes the result of the download to the waiting threads and removes id
+ * from the table.  Every waiting thread receives its own duplicate of a valid
+ * file descriptor.  Without a cache manager, the result is passed on as is.
+ */
+void DownloadQueues::Finish(
+  const shash::Any &id,
+  int result,
+  CacheManager *cache_mgr)
+{
+  Shard *shard = GetShard(id);
+  MutexLockGuard guard(&shard->lock);
+
+  map<shash::Any, Inflight *>::iterator iter = shard->inflight.find(id);
+  assert(iter != shard->inflight.end());
+  Inflight *inflight = iter->second;
+  shard->inflight.erase(iter);
+
+  for (unsigned i = 0; i < inflight->num_waiting; ++i) {
+    inflight->results.push_back(
+      ((result >= 0) && (cache_mgr != NULL)) ? cache_mgr->Dup(result) : result);
+  }
+  inflight->is_finished = true;
+  if (inflight->num_waiting == 0) {
+    delete inflight;
+    return;
+  }
+  int retval = pthread_cond_broadcast(&inflight->cond_finished);
+  assert(retval == 0);
+}
+
+
+unsigned DownloadQueues::GetNumWaiting(const shash::Any &id) {
+  Shard *shard = GetShard(id);
+  MutexLockGuard guard(&shard->lock);
+  map<shash::Any, Inflight *>::const_iterator iter = shard->inflight.find(id);
+  if (iter == shard->inflight.end())
+    return 0;
+  return iter->second->num_waiting;
+}
+
+}  // namespace cvmfs
@@ -0,0 +1,75 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#ifndef CVMFS_FETCH_QUEUES_H_
+#define CVMFS_FETCH_QUEUES_H_
+
+#include <pthread.h>
+
+#include <map>
+#include <vector>
+
+#include "crypto/hash.h"
+#include "util/single_copy.h"
+
+class CacheManager;
+
+namespace cvmfs {
+
+/**
+ * Keeps track of the objects that are currently being downloaded so that
+ * concurrent requests for the same object are collapsed.  The first thread
+ * that claims an object downloads it, all the other threads block on a
+ * condition variable of the in-flight download until the downloader publishes
+ * the result.
+ *
+ * The table is sharded by the object hash, so that threads requesting
+ * different objects do not serialize on a single lock.  Waking up the waiting
+ * threads requires a single broadcast, independent of the number of waiters.
+ */
+class DownloadQueues : SingleCopy {
+ public:
+  static const unsigned kNumShards = 64;
+
+  DownloadQueues();
+  ~DownloadQueues();
+
+  bool Claim(const shash::Any &id, int *result);
+  void Finish(const shash::Any &id, int result, CacheManager *cache_mgr);
+  unsigned GetNumWaiting(const shash::Any &id);
+
+ private:
+  struct Inflight {
+    Inflight();
+    ~Inflight();
+
+    pthread_cond_t cond_finished;
+    /**
+     * Number of threads blocked on this download.  The last one to leave
+     * frees the object.
+     */
+    unsigned num_waiting;
+    bool is_finished;
+    /**
+     * One result per waiting thread, file descriptors are dup'ed by the
+     * downloader
+     */
+    std::vector<int> results;
+  };
+
+  struct Shard {
+    pthread_mutex_t lock;
+    std::map<shash::Any, Inflight *> inflight;
+  };
+
+  Shard *GetShard(const shash::Any &id) {
+    return &shards_[id.Partial32() % kNumShards];
+  }
+
+  Shard shards_[kNumShards];
+};
+
+}  // namespace cvmfs
+
+#endif  // CVMFS_FETCH_QUEUES_H_
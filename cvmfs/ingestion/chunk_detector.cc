@@ -10,6 +10,49 @@
 #include <limits>
 
 #include "ingestion/item.h"
+#include "util/exception.h"
+
+
+ChunkingAlgorithms ParseChunkingAlgorithm(const std::string &name) {
+  if ((name == "xor32") || (name == "default"))
+    return kChunkingXor32;
+  if (name == "gear")
+    return kChunkingGear;
+  return kChunkingUnknown;
+}
+
+
+std::string ChunkingAlgorithmName(const ChunkingAlgorithms algorithm) {
+  switch (algorithm) {
+    case kChunkingXor32:
+      return "xor32";
+    case kChunkingGear:
+      return "gear";
+    default:
+      return "unknown";
+  }
+}
+
+
+ChunkDetector *CreateChunkDetector(const ChunkingAlgorithms algorithm,
+                                   const uint64_t minimal_chunk_size,
+                                   const uint64_t average_chunk_size,
+                                   const uint64_t maximal_chunk_size)
+{
+  switch (algorithm) {
+    case kChunkingXor32:
+      return new Xor32Detector(minimal_chunk_size, average_chunk_size,
+                               maximal_chunk_size);
+    case kChunkingGear:
+      return new GearDetector(minimal_chunk_size, average_chunk_size,
+                              maximal_chunk_size);
+    default:
+      PANIC(kLogStderr, "unknown chunking algorithm %d", algorithm);
+  }
+}
+
+
+//------------------------------------------------------------------------------
 
 
 uint64_t ChunkDetector::FindNextCutMark(BlockItem *block) {
@@ -135,3 +178,214 @@ uint64_t Xor32Detector::DoFindNextCutMark(BlockItem *buffer) {
     return NoCut(internal_offset + offset());
   }
 }
+
+
+//------------------------------------------------------------------------------
+
+
+// Random values, generated by splitmix64.  You should never change the table,
+// since it affects the definition of cut marks.
+const uint64_t GearDetector::kGearTable[256] = {
+  0xc784ebb1bbbb0050ULL, 0x474741095a94d0b0ULL, 0x9b28e9b69b767b3bULL,
+  0xd594f6f460867fc5ULL, 0x46bb1e49793719a4ULL, 0xb24aad23c12bf88fULL,
+  0x455b1ebfe2725d74ULL, 0xc6eb9b828433c435ULL, 0xf3d32a83c14d6e7dULL,
+  0xf1093bb05b0cf7b0ULL, 0xb3f396072f4349e4ULL, 0x852f79b266aeee80ULL,
+  0x4c46074d9e771b1cULL, 0x43abfe04d7d405d9ULL, 0x954bab2fd50e1deaULL,
+  0xa025d8d044fcff58ULL, 0x363441ce15f1606eULL, 0x15ba2399a4ffdad4ULL,
+  0xee65a50656f3c6e5ULL, 0x901368d4494b15ceULL, 0xf66d26ffcf2aacfeULL,
+  0xe8c2fbb3ce39ad62ULL, 0xa5e2a074469cf6beULL, 0xa270d4f83fe3332aULL,
+  0xc34a013dec65206bULL, 0x188774419d8be227ULL, 0x81e6b6478d388bd5ULL,
+  0x41f78a24567d6d2cULL, 0x5b3ce4db777039b9ULL, 0x9b921db52794c54fULL,
+  0xcf8d124cad407fe9ULL, 0x10e8a443bca73a81ULL, 0xf4b4fcb5561117aaULL,
+  0x6d9d78394c296457ULL, 0xbabb49cbe3efc833ULL, 0x559ea22f784f513aULL,
+  0x413301a4fdd3a168ULL, 0x0bc3fddc5e973a14ULL, 0xe6fa16c75f8b5a37ULL,
+  0x94a659e95c1ef86dULL, 0xc33ed88537b625baULL, 0x17aab6415b03532eULL,
+  0xbfff13dd664e41a4ULL, 0x5c011e3cc16a4053ULL, 0xc9ee0c8a11ba9229ULL,
+  0x370bcfa93baf77f4ULL, 0x22cbbf1694e8ed25ULL, 0x4f71266ff6bc3927ULL,
+  0x513163f4e710173eULL, 0xac9fc489f02a57b4ULL, 0x772f713e59b3ccfbULL,
+  0xcdca0a38c98b80e9ULL, 0x09ec87cc2a5cad37ULL, 0xa0f9fd3f48c21eaaULL,
+  0xb1160a3ef5fd4199ULL, 0x5509c88a109084bdULL, 0x0d286d45103c6274ULL,
+  0x7e181cb8f8214816ULL, 0xf558771049e74f3bULL, 0xe34ce6e190cbb345ULL,
+  0xae288a082830c1beULL, 0xf141e2acee5b8e9eULL, 0xc0a3e970f2d27b90ULL,
+  0x02b48ce25a30642bULL, 0x9e25eeb94388d09dULL, 0x1f3cb4d01e86282aULL,
+  0x1d24738b03fade2aULL, 0x36413a1f8ad934b0ULL, 0xfe025231d84c92b1ULL,
+  0x0928d2688a777c30ULL, 0x66202c011f7595e2ULL, 0xbf95f4adfee71a23ULL,
+  0xc1b431aeaf936d02ULL, 0xa906035962675c6dULL, 0x97bf3cb5e4ef554eULL,
+  0xea58b303d5f1fc68ULL, 0xe4ebc6d1521efaeaULL, 0x0ac20356de68aa1bULL,
+  0xe04e988d59ef55c2ULL, 0x3bff0f7c018e2e24ULL, 0x5205d1ebccec1ec1ULL,
+  0x2234ab0409ef3820ULL, 0x9328237d36ba2158ULL, 0x8e0273205f57035aULL,
+  0x30ed76e1359a2f95ULL, 0x859cc28590c08e86ULL, 0xf962d590bb836d38ULL,
+  0xfd7823c324d53719ULL, 0xbe3e7e8e3121fd12ULL, 0x85529cf1628d4d3bULL,
+  0xefdb562dcfbeeff2ULL, 0x52626ae0b4c65a17ULL, 0x49cc10046008009eULL,
+  0x3d57642f6f5e01c8ULL, 0x1e3c20f0e95f9135ULL, 0x93348fcb7e477f8fULL,
+  0x8b646fecf1c71a4fULL, 0x294471d84538ee12ULL, 0x5f1a4d6ceab71909ULL,
+  0x69e542c99e4838ccULL, 0xc28b9ce3b660e821ULL, 0x0dfa3f65bf00372dULL,
+  0x28e2ed261513c6e3ULL, 0x986ea7739efc1f5bULL, 0xa813de844e63acf1ULL,
+  0xe1df6ad7324ac4ccULL, 0xfa8d0eaa17372ee9ULL, 0x555f2e28ade8018dULL,
+  0x02f567f1bc935a4dULL, 0x134ef3b8907d556dULL, 0x0c062d1bd21a97d0ULL,
+  0x2789d42af15a1250ULL, 0x4c2918007ae411d0ULL, 0xa0959b86652a010aULL,
+  0x30064a6a0710a0deULL, 0xb1b0e2cfa47ee5a9ULL, 0xcdb3e994e5c8be56ULL,
+  0x02d709b20e97fddbULL, 0x44900dd1a7dc547dULL, 0xec9e3400e910f094ULL,
+  0xc21e45ddddbf46ebULL, 0x89b05b437d943e9dULL, 0x5058845ca9b759d3ULL,
+  0x6b63caa16ebfa8deULL, 0x7dd7c0dad8826884ULL, 0xee96441eb4f166b7ULL,
+  0x380288a2e42a9f82ULL, 0x04b620d8e01798aaULL, 0xdf56e29104802618ULL,
+  0xac16a14e56b0e09aULL, 0xd4fca115a8f5b381ULL, 0xba129b04d829b7b1ULL,
+  0x8913e76a7bd174f2ULL, 0x4927e81d07d4258eULL, 0xb22131d22defecbeULL,
+  0x5aad7c7f8d15d903ULL, 0xdf6f32a3d5eadee9ULL, 0x1bb1e59ebb39602bULL,
+  0xd27a35a474d25d45ULL, 0x336dab6e01ade86dULL, 0x109746ae42c3511cULL,
+  0x7d661e29f985706bULL, 0x8ba239213dfcec5aULL, 0x846520a908392c55ULL,
+  0xff5d6f1011346488ULL, 0xb06d63f52813da51ULL, 0x8fb3fc2bad662571ULL,
+  0x2f3604c956db91c6ULL, 0xb8371ff4934af4ffULL, 0x4b2c81c892615ad0ULL,
+  0xef12e90a8c8a8ebcULL, 0x0c55d15de72605a4ULL, 0x6d0bbad8312d8facULL,
+  0x0f73f8b8cb4295dbULL, 0xeffda660956c4f8dULL, 0xe44af7028f7664a9ULL,
+  0x53968100fe59d9e6ULL, 0xacd1f1b6f9e28610ULL, 0xdb1d0d7f7c2d94d5ULL,
+  0xd8ad8ff704d33cb2ULL, 0x3ab8e9df21f6664cULL, 0x3068a6775f17a700ULL,
+  0x2d0d5c882c14b4cdULL, 0x56fd500e865a9620ULL, 0x6ac29ef8b12e73d5ULL,
+  0x5c7bd39b23297e72ULL, 0x5d7357e822b2044dULL, 0x40df1981c267bf1cULL,
+  0x828a199813fb75b1ULL, 0x537b4c1849cf8d0bULL, 0xbb9527c4380beda7ULL,
+  0xfbc82d57e665f4c2ULL, 0x4ea10b8ae4ce2084ULL, 0xb2a4bd56599e2bcfULL,
+  0x894eff3e67205b28ULL, 0xee42135620a7770dULL, 0x4028ffa101a2d41aULL,
+  0xb60d66b2d7efc13fULL, 0xc5d56b71457a3c55ULL, 0x312babd4e5e53128ULL,
+  0xda5fae925e4c234bULL, 0xe2a13dd759d12baaULL, 0x449435f20fd4805eULL,
+  0x41617b5ea0f39c16ULL, 0xba1eec9536d4fb0dULL, 0x21f525b500a25b51ULL,
+  0xd7775507d58bcfadULL, 0xb3af65a64959cd6bULL, 0xc5cd529f30082d15ULL,
+  0x023f1500a311c962ULL, 0x1076ccebecaa732cULL, 0x20c3245a8054b794ULL,
+  0x601116eb9bda7839ULL, 0x7b28a99772ce3d00ULL, 0xf6ca1492430471cfULL,
+  0x51da585aa9eadac7ULL, 0x78903a6c53d9c933ULL, 0xf4b3b794c890cc4dULL,
+  0x37e26b3bb1671fc4ULL, 0x6ed864f617f137b5ULL, 0x62afa5ed2e00419bULL,
+  0x79dfd85f6fcf5dd8ULL, 0xb25ee730d091eaedULL, 0x09d51722f57a66dbULL,
+  0xbff82197038eb412ULL, 0x3f1a2b265c5b28ccULL, 0x9f033e3e5537108eULL,
+  0x1e0042fb64ebbfb9ULL, 0xf7d67a462e8846b1ULL, 0xe29263963b63051cULL,
+  0x8009fe895d98059eULL, 0x82fd13f9cf61a01fULL, 0x70bf1f8610453d07ULL,
+  0xa3c92e152d479296ULL, 0xaf8af74a25665362ULL, 0x0d3aeec891fa580fULL,
+  0x5f3b016a70bd9806ULL, 0xdacbec682c790c17ULL, 0x70afb4e5ed7164d0ULL,
+  0x1d33b0d9a1a2a873ULL, 0xd10514f5edac56c3ULL, 0x8cf1f9243370a404ULL,
+  0x25cb276e1bd790c0ULL, 0x4c010ffb6b0a3ea7ULL, 0xfe74d21c8546052eULL,
+  0xf80848904e6f2446ULL, 0xa7bad8e8bc92ae25ULL, 0x3eafa2cf4ddfe04fULL,
+  0xa09bbb0f9efe788fULL, 0x3daacc8cb881dd60ULL, 0x31a6eb223f4e494fULL,
+  0xab5f0bc4cde5ffedULL, 0x2e55bd6983f679eaULL, 0x76a75fea4dc3fbb1ULL,
+  0x10f29b789ca5bef2ULL, 0xdfea8296084bb452ULL, 0x27588f1c919af94cULL,
+  0x3ee33192d09db34bULL, 0xc8dae6ec9cc2c1fbULL, 0xd8a6b90a4f4c0b31ULL,
+  0xb9f9b597a0957eeaULL, 0x2ef83f32e625bd2eULL, 0x5e7b6bf9014e9aaeULL,
+  0xd54e786d3d7728d2ULL, 0x95622bdd803e8b88ULL, 0x4aab4b502cfe686cULL,
+  0x541d8cc0b46e059bULL, 0x01126e589fd0f964ULL, 0xea8117446b441dfbULL,
+  0xfe04f447c46861e1ULL, 0x02bb26619e70d4cbULL, 0x7885e27ee264add9ULL,
+  0xed2a420ba755da88ULL, 0xc790c31584b4f21fULL, 0xc2d631fe9f25cc44ULL,
+  0x77b1ad7e8deab21eULL,
+};
+
+
+/**
+ * Mask with nbits bits set.  The bits are placed just below the most
+ * significant bit because the upper bits of the Gear hash depend on the
+ * largest window of input bytes.  The most significant bit stays unset so that
+ * the mask can be shifted by one in Roll().
+ */
+uint64_t GearDetector::MakeMask(const unsigned nbits) {
+  assert((nbits > 0) && (nbits < 63));
+  return ((uint64_t(1) << nbits) - 1) << (63 - nbits);
+}
+
+
+GearDetector::GearDetector(const uint64_t minimal_chunk_size,
+                           const uint64_t average_chunk_size,
+                           const uint64_t maximal_chunk_size)
+  : minimal_chunk_size_(minimal_chunk_size)
+  , average_chunk_size_(average_chunk_size)
+  , maximal_chunk_size_(maximal_chunk_size)
+  , mask_small_(0)
+  , mask_large_(0)
+  , hash_ptr_(0)
+  , hash_(0)
+{
+  assert((average_chunk_size_ == 0) || (minimal_chunk_size_ > 0));
+  if (minimal_chunk_size_ > 0) {
+    assert(minimal_chunk_size_ < average_chunk_size_);
+    assert(average_chunk_size_ < maximal_chunk_size_);
+    unsigned nbits = 0;
+    while ((uint64_t(1) << (nbits + 1)) <= average_chunk_size_)
+      nbits++;
+    assert(nbits > kNormalization);
+    mask_small_ = MakeMask(nbits + kNormalization);
+    mask_large_ = MakeMask(nbits - kNormalization);
+  }
+}
+
+
+/**
+ * Continues the Gear hash on data[*pos] to data[end - 1] and stops at the
+ * first cut mark according to mask.  Returns true if a cut mark was found, in
+ * which case *pos points to the first byte of the next chunk.
+ *
+ * Two bytes are processed per iteration: for the first byte, the hash is
+ * shifted by two and the table value by one, which yields the intermediate
+ * hash shifted by one; the shifted mask gives the same result as the regular
+ * mask on the intermediate hash.
+ */
+bool GearDetector::Roll(
+  const unsigned char *data,
+  const uint64_t end,
+  const uint64_t mask,
+  uint64_t *pos)
+{
+  const uint64_t mask_shifted = mask << 1;
+  uint64_t hash = hash_;
+  uint64_t i = *pos;
+  for (; i + 1 < end; i += 2) {
+    hash = (hash << 2) + (kGearTable[data[i]] << 1);
+    if ((hash & mask_shifted) == 0) {
+      *pos = i + 1;
+      return true;
+    }
+    hash += kGearTable[data[i + 1]];
+    if ((hash & mask) == 0) {
+      *pos = i + 2;
+      return true;
+    }
+  }
+  if (i < end) {
+    hash = (hash << 1) + kGearTable[data[i]];
+    i++;
+    if ((hash & mask) == 0) {
+      *pos = i;
+      return true;
+    }
+  }
+  hash_ = hash;
+  *pos = i;
+  return false;
+}
+
+
+uint64_t GearDetector::DoFindNextCutMark(BlockItem *buffer) {
+  assert(minimal_chunk_size_ > 0);
+  const unsigned char *data = buffer->data();
+  const uint64_t beginning = offset();
+  const uint64_t size = buffer->size();
+
+  // Cut-point skipping: the first minimal_chunk_size_ bytes of a chunk are not
+  // hashed
+  const uint64_t global_offset =
+    std::max(last_cut() + minimal_chunk_size_, hash_ptr_);
+  if (global_offset >= beginning + size)
+    return NoCut(global_offset);
+
+  uint64_t pos = global_offset - beginning;
+  const uint64_t normal_point = last_cut() + average_chunk_size_;
+  const uint64_t max_point = last_cut() + maximal_chunk_size_;
+  assert(max_point > global_offset);
+
+  if (normal_point > global_offset) {
+    const uint64_t end = std::min(normal_point - beginning, size);
+    if (Roll(data, end, mask_small_, &pos))
+      return DoCut(beginning + pos);
+  }
+  const uint64_t end = std::min(max_point - beginning, size);
+  if (Roll(data, end, mask_large_, &pos))
+    return DoCut(beginning + pos);
+
+  // Hard cut at the maximal chunk size, otherwise continue with the next buffer
+  if (beginning + pos == max_point)
+    return DoCut(max_point);
+  return NoCut(beginning + pos);
+}
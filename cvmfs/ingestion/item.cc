@@ -23,15 +23,19 @@ FileItem::FileItem(
   shash::Algorithms hash_algorithm,
   shash::Suffix hash_suffix,
   bool may_have_chunks,
-  bool has_legacy_bulk_chunk)
+  bool has_legacy_bulk_chunk,
+  ChunkingAlgorithms chunking_algorithm,
+  int compression_level)
   : source_(source)
   , compression_algorithm_(compression_algorithm)
+  , compression_level_(compression_level)
   , hash_algorithm_(hash_algorithm)
   , hash_suffix_(hash_suffix)
   , has_legacy_bulk_chunk_(has_legacy_bulk_chunk)
   , size_(kSizeUnknown)
   , may_have_chunks_(may_have_chunks)
-  , chunk_detector_(min_chunk_size, avg_chunk_size, max_chunk_size)
+  , chunk_detector_(CreateChunkDetector(chunking_algorithm, min_chunk_size,
+                                        avg_chunk_size, max_chunk_size))
   , bulk_hash_(hash_algorithm)
   , chunks_(1)
 {
@@ -94,6 +98,7 @@ zlib::Compressor *ChunkItem::GetCompressor() {
   if (!compressor_.IsValid()) {
     compressor_ =
       zlib::Compressor::Construct(file_item_->compression_algorithm());
+    compressor_->SetLevel(file_item_->compression_level());
   }
   return compressor_.weak_ref();
 }
@@ -115,6 +120,7 @@ BlockItem::BlockItem(ItemAllocator *allocator)
   , tag_(-1)
   , file_item_(NULL)
   , chunk_item_(NULL)
+  , buffer_(NULL)
   , data_(NULL)
   , capacity_(0)
   , size_(0)
@@ -127,6 +133,7 @@ BlockItem::BlockItem(int64_t tag, ItemAllocator *allocator)
   , tag_(tag)
   , file_item_(NULL)
   , chunk_item_(NULL)
+  , buffer_(NULL)
   , data_(NULL)
   , capacity_(0)
   , size_(0)
@@ -136,18 +143,25 @@ BlockItem::BlockItem(int64_t tag, ItemAllocator *allocator)
 
 
 BlockItem::~BlockItem() {
-  if (data_)
-    allocator_->Free(data_);
-  atomic_xadd64(&managed_bytes_, -static_cast<int64_t>(capacity_));
+  if (buffer_)
+    ReleaseData();
 }
 
 
 void BlockItem::Discharge() {
-  data_ = NULL;
+  buffer_ = data_ = NULL;
   size_ = capacity_ = 0;
 }
 
 
+void BlockItem::ReleaseData() {
+  unsigned buffer_size = ItemAllocator::GetBufferSize(buffer_);
+  if (allocator_->ReleaseBuffer(buffer_))
+    atomic_xadd64(&managed_bytes_, -static_cast<int64_t>(buffer_size));
+  Discharge();
+}
+
+
 void BlockItem::MakeStop() {
   assert(type_ == kBlockHollow);
   type_ = kBlockStop;
@@ -161,7 +175,7 @@ void BlockItem::MakeData(uint32_t capacity) {
 
   type_ = kBlockData;
   capacity_ = capacity;
-  data_ = reinterpret_cast<unsigned char *>(allocator_->Malloc(capacity_));
+  buffer_ = data_ = allocator_->MallocBuffer(capacity_);
   atomic_xadd64(&managed_bytes_, static_cast<int64_t>(capacity_));
 }
 
@@ -176,6 +190,7 @@ void BlockItem::MakeDataMove(BlockItem *other) {
 
   type_ = kBlockData;
   capacity_ = size_ = other->size_;
+  buffer_ = other->buffer_;
   data_ = other->data_;
   allocator_ = other->allocator_;
 
@@ -196,19 +211,39 @@ void BlockItem::MakeDataCopy(
 
   type_ = kBlockData;
   capacity_ = size_ = size;
-  data_ = reinterpret_cast<unsigned char *>(allocator_->Malloc(capacity_));
+  buffer_ = data_ = allocator_->MallocBuffer(capacity_);
   memcpy(data_, data, size);
   atomic_xadd64(&managed_bytes_, static_cast<int64_t>(capacity_));
 }
 
 
+/**
+ * Refer to a piece of one block's data without copying.  Both blocks share
+ * the buffer until the last of them is reset or deleted.
+ */
+void BlockItem::MakeDataSlice(
+  BlockItem *other,
+  uint32_t offset,
+  uint32_t size)
+{
+  assert(type_ == kBlockHollow);
+  assert(other->type_ == kBlockData);
+  assert(size > 0);
+  assert(offset + size <= other->size_);
+
+  type_ = kBlockData;
+  capacity_ = size_ = size;
+  buffer_ = other->buffer_;
+  data_ = other->data_ + offset;
+  allocator_ = other->allocator_;
+  ItemAllocator::RefBuffer(buffer_);
+}
+
+
 void BlockItem::Reset() {
   assert(type_ == kBlockData);
 
-  atomic_xadd64(&managed_bytes_, -static_cast<int64_t>(capacity_));
-  allocator_->Free(data_);
-  data_ = NULL;
-  size_ = capacity_ = 0;
+  ReleaseData();
   type_ = kBlockHollow;
 }
 
@@ -42,7 +42,9 @@ class FileItem : SingleCopy {
     shash::Algorithms hash_algorithm = shash::kSha1,
     shash::Suffix hash_suffix = shash::kSuffixNone,
     bool may_have_chunks = true,
-    bool has_legacy_bulk_chunk = false);
+    bool has_legacy_bulk_chunk = false,
+    ChunkingAlgorithms chunking_algorithm = kChunkingXor32,
+    int compression_level = 0);
   ~FileItem();
 
   static FileItem *CreateQuitBeacon() {
@@ -56,9 +58,10 @@ class FileItem : SingleCopy {
 
   std::string path() { return source_->GetPath(); }
   uint64_t size() { return size_; }
-  Xor32Detector *chunk_detector() { return &chunk_detector_; }
+  ChunkDetector *chunk_detector() { return chunk_detector_.weak_ref(); }
   shash::Any bulk_hash() { return bulk_hash_; }
   zlib::Algorithms compression_algorithm() { return compression_algorithm_; }
+  int compression_level() { return compression_level_; }
   shash::Algorithms hash_algorithm() { return hash_algorithm_; }
   shash::Suffix hash_suffix() { return hash_suffix_; }
   bool may_have_chunks() { return may_have_chunks_; }
@@ -93,6 +96,7 @@ class FileItem : SingleCopy {
 
   UniquePtr<IngestionSource> source_;
   const zlib::Algorithms compression_algorithm_;
+  const int compression_level_;
   const shash::Algorithms hash_algorithm_;
   const shash::Suffix hash_suffix_;
   const bool has_legacy_bulk_chunk_;
@@ -100,7 +104,7 @@ class FileItem : SingleCopy {
   uint64_t size_;
   bool may_have_chunks_;
 
-  Xor32Detector chunk_detector_;
+  UniquePtr<ChunkDetector> chunk_detector_;
   shash::Any bulk_hash_;
   FileChunkList chunks_;
   /**
@@ -176,6 +180,11 @@ class ChunkItem : SingleCopy {
  * followed by a stop block constitutes a Chunk.  A sequence of Chunks in turn
  * build constitute a file.
  * A block that carries data must have a non-zero-length payload.
+ *
+ * The payload lives in a reference counted buffer from the ItemAllocator.
+ * Using MakeDataSlice(), several blocks can refer to (parts of) the same
+ * buffer, so that the data of a block can be cut into chunks without copying.
+ * Blocks that share a buffer must not be written to.
  */
 class BlockItem : SingleCopy {
  public:
@@ -200,6 +209,7 @@ class BlockItem : SingleCopy {
   void MakeData(uint32_t capacity);
   void MakeDataMove(BlockItem *other);
   void MakeDataCopy(const unsigned char *data, uint32_t size);
+  void MakeDataSlice(BlockItem *other, uint32_t offset, uint32_t size);
   void SetFileItem(FileItem *item);
   void SetChunkItem(ChunkItem *item);
   // Free data and reset to hollow block
@@ -223,12 +233,14 @@ class BlockItem : SingleCopy {
 
  private:
   /**
-   * Total capacity of all BlockItem()
+   * Total size of all buffers of BlockItem()
    */
   static atomic_int64 managed_bytes_;
 
   // Forget pointer to the data
   void Discharge();
+  // Drop the reference to the buffer
+  void ReleaseData();
 
   ItemAllocator *allocator_;
   BlockType type_;
@@ -248,8 +260,10 @@ class BlockItem : SingleCopy {
   ChunkItem *chunk_item_;
 
   /**
-   * Managed by ItemAllocator
+   * Managed by ItemAllocator.  The data are located in buffer_, possibly at
+   * an offset.
    */
+  unsigned char *buffer_;
   unsigned char *data_;
   uint32_t capacity_;
   uint32_t size_;
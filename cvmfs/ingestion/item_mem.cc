@@ -15,7 +15,11 @@ atomic_int64 ItemAllocator::total_allocated_ = 0;
 
 void ItemAllocator::Free(void *ptr) {
   MutexLockGuard guard(lock_);
+  FreeUnlocked(ptr);
+}
+
 
+void ItemAllocator::FreeUnlocked(void *ptr) {
   MallocArena *M = MallocArena::GetMallocArena(ptr, kArenaSize);
   M->Free(ptr);
   unsigned N = malloc_arenas_.size();
@@ -74,3 +78,42 @@ void *ItemAllocator::Malloc(unsigned size) {
   assert(p != NULL);
   return p;
 }
+
+
+unsigned char *ItemAllocator::MallocBuffer(unsigned size) {
+  BufferHeader *header = NULL;
+  if (size <= kMaxPooledSize) {
+    MutexLockGuard guard(lock_);
+    std::map<unsigned, std::vector<BufferHeader *> >::iterator iter =
+      pool_.find(size);
+    if ((iter != pool_.end()) && !iter->second.empty()) {
+      header = iter->second.back();
+      iter->second.pop_back();
+    }
+  }
+  if (header == NULL) {
+    header = reinterpret_cast<BufferHeader *>(
+      Malloc(sizeof(BufferHeader) + size));
+    header->size = size;
+  }
+  atomic_write32(&header->refcount, 1);
+  return reinterpret_cast<unsigned char *>(header) + sizeof(BufferHeader);
+}
+
+
+bool ItemAllocator::ReleaseBuffer(unsigned char *buffer) {
+  BufferHeader *header = GetBufferHeader(buffer);
+  if (atomic_xadd32(&header->refcount, -1) > 1)
+    return false;
+
+  MutexLockGuard guard(lock_);
+  if (header->size <= kMaxPooledSize) {
+    std::vector<BufferHeader *> *free_list = &pool_[header->size];
+    if (free_list->size() < kMaxPooledBuffers) {
+      free_list->push_back(header);
+      return true;
+    }
+  }
+  FreeUnlocked(header);
+  return true;
+}
@@ -7,7 +7,10 @@
 
 #include <pthread.h>
 
+#include <stdint.h>
+
 #include <cassert>
+#include <map>
 #include <vector>
 
 #include "malloc_arena.h"
@@ -16,6 +19,12 @@
 /**
  * To avoid memory fragmentation, allocate the data buffer inside the BlockItem
  * with a separate allocator.
+ *
+ * The data of BlockItems is kept in reference counted buffers, so that blocks
+ * can share the data of another block.  Released buffers up to kMaxPooledSize
+ * are kept on a free list per size and handed out again by MallocBuffer().
+ * The pipeline uses only a few different block sizes, so that most buffers
+ * are recycled without going through the arenas.
  */
 class ItemAllocator {
  public:
@@ -25,13 +34,52 @@ class ItemAllocator {
   void *Malloc(unsigned size);
   void Free(void *ptr);
 
+  /**
+   * Returns a buffer of the given size with a reference count of 1
+   */
+  unsigned char *MallocBuffer(unsigned size);
+  static void RefBuffer(unsigned char *buffer) {
+    atomic_inc32(&GetBufferHeader(buffer)->refcount);
+  }
+  /**
+   * Drops a reference.  The last reference returns the buffer to the pool or
+   * to the arena; in this case, returns true.
+   */
+  bool ReleaseBuffer(unsigned char *buffer);
+  static unsigned GetBufferSize(unsigned char *buffer) {
+    return GetBufferHeader(buffer)->size;
+  }
+  static int32_t GetBufferRefcount(unsigned char *buffer) {
+    return atomic_read32(&GetBufferHeader(buffer)->refcount);
+  }
+
   static int64_t total_allocated() { return atomic_read64(&total_allocated_); }
 
  private:
   static const unsigned kArenaSize = 128 * 1024 * 1024;  // 128 MB
+  static const unsigned kMaxPooledSize = 64 * 1024;
+  static const unsigned kMaxPooledBuffers = 1024;
   static atomic_int64 total_allocated_;
 
+  /**
+   * Precedes the data of a buffer
+   */
+  struct BufferHeader {
+    atomic_int32 refcount;
+    uint32_t size;
+  };
+
+  static BufferHeader *GetBufferHeader(unsigned char *buffer) {
+    return reinterpret_cast<BufferHeader *>(buffer - sizeof(BufferHeader));
+  }
+
+  void FreeUnlocked(void *ptr);
+
   std::vector<MallocArena *> malloc_arenas_;
+  /**
+   * Released buffers by size
+   */
+  std::map<unsigned, std::vector<BufferHeader *> > pool_;
   /**
    * Where the last successful allocation took place.
    */
@@ -27,9 +27,11 @@ IngestionPipeline::IngestionPipeline(
   upload::AbstractUploader *uploader,
   const upload::SpoolerDefinition &spooler_definition)
   : compression_algorithm_(spooler_definition.compression_alg)
+  , compression_level_(spooler_definition.compression_level)
   , hash_algorithm_(spooler_definition.hash_algorithm)
   , generate_legacy_bulk_chunks_(spooler_definition.generate_legacy_bulk_chunks)
   , chunking_enabled_(spooler_definition.use_file_chunking)
+  , chunking_algorithm_(spooler_definition.chunking_algorithm)
   , minimal_chunk_size_(spooler_definition.min_file_chunk_size)
   , average_chunk_size_(spooler_definition.avg_file_chunk_size)
   , maximal_chunk_size_(spooler_definition.max_file_chunk_size)
@@ -50,21 +52,21 @@ IngestionPipeline::IngestionPipeline(
   tubes_register_.Activate();
 
   for (unsigned i = 0; i < nfork_base * kNforkWrite; ++i) {
-    Tube<BlockItem> *t = new Tube<BlockItem>();
+    Tube<BlockItem> *t = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_write_.TakeTube(t);
     tasks_write_.TakeConsumer(new TaskWrite(t, &tubes_register_, uploader_));
   }
   tubes_write_.Activate();
 
   for (unsigned i = 0; i < nfork_base * kNforkHash; ++i) {
-    Tube<BlockItem> *t = new Tube<BlockItem>();
+    Tube<BlockItem> *t = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_hash_.TakeTube(t);
     tasks_hash_.TakeConsumer(new TaskHash(t, &tubes_write_));
   }
   tubes_hash_.Activate();
 
   for (unsigned i = 0; i < nfork_base * kNforkCompress; ++i) {
-    Tube<BlockItem> *t = new Tube<BlockItem>();
+    Tube<BlockItem> *t = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_compress_.TakeTube(t);
     tasks_compress_.TakeConsumer(
       new TaskCompress(t, &tubes_hash_, &item_allocator_));
@@ -72,7 +74,7 @@ IngestionPipeline::IngestionPipeline(
   tubes_compress_.Activate();
 
   for (unsigned i = 0; i < nfork_base * kNforkChunk; ++i) {
-    Tube<BlockItem> *t = new Tube<BlockItem>();
+    Tube<BlockItem> *t = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_chunk_.TakeTube(t);
     tasks_chunk_.TakeConsumer(
       new TaskChunk(t, &tubes_compress_, &item_allocator_));
@@ -131,7 +133,9 @@ void IngestionPipeline::Process(
     hash_algorithm_,
     hash_suffix,
     allow_chunking && chunking_enabled_,
-    generate_legacy_bulk_chunks_);
+    generate_legacy_bulk_chunks_,
+    chunking_algorithm_,
+    compression_level_);
   tube_ctr_inflight_post_.EnqueueBack(file_item);
   tube_ctr_inflight_pre_.EnqueueBack(file_item);
   tube_input_.EnqueueBack(file_item);
@@ -196,7 +200,7 @@ ScrubbingPipeline::ScrubbingPipeline()
   unsigned nfork_base = std::max(1U, GetNumberOfCpuCores() / 8);
 
   for (unsigned i = 0; i < nfork_base * kNforkScrubbingCallback; ++i) {
-    Tube<BlockItem> *tube = new Tube<BlockItem>();
+    Tube<BlockItem> *tube = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_scrubbing_callback_.TakeTube(tube);
     TaskScrubbingCallback *task =
       new TaskScrubbingCallback(tube, &tube_counter_);
@@ -206,14 +210,14 @@ ScrubbingPipeline::ScrubbingPipeline()
   tubes_scrubbing_callback_.Activate();
 
   for (unsigned i = 0; i < nfork_base * kNforkHash; ++i) {
-    Tube<BlockItem> *t = new Tube<BlockItem>();
+    Tube<BlockItem> *t = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_hash_.TakeTube(t);
     tasks_hash_.TakeConsumer(new TaskHash(t, &tubes_scrubbing_callback_));
   }
   tubes_hash_.Activate();
 
   for (unsigned i = 0; i < nfork_base * kNforkChunk; ++i) {
-    Tube<BlockItem> *t = new Tube<BlockItem>();
+    Tube<BlockItem> *t = new Tube<BlockItem>(kBlockTubeCapacity, kTubeRing);
     tubes_chunk_.TakeTube(t);
     tasks_chunk_.TakeConsumer(
       new TaskChunk(t, &tubes_hash_, &item_allocator_));
@@ -38,6 +38,11 @@ class IngestionPipeline : public Observable<upload::SpoolerResult> {
  private:
   static const uint64_t kMaxPipelineMem;  // 1G
   static const unsigned kMaxFilesInFlight = 8000;
+  /**
+   * Capacity of the lock-free tubes between the block processing steps.  The
+   * memory of the pipeline is limited by the watermarks of the read task.
+   */
+  static const unsigned kBlockTubeCapacity = 4096;
   static const unsigned kNforkRegister = 1;
   static const unsigned kNforkWrite = 1;
   static const unsigned kNforkHash = 2;
@@ -46,9 +51,11 @@ class IngestionPipeline : public Observable<upload::SpoolerResult> {
   static const unsigned kNforkRead = 8;
 
   const zlib::Algorithms compression_algorithm_;
+  const int compression_level_;
   const shash::Algorithms hash_algorithm_;
   const bool generate_legacy_bulk_chunks_;
   const bool chunking_enabled_;
+  const ChunkingAlgorithms chunking_algorithm_;
   const size_t minimal_chunk_size_;
   const size_t average_chunk_size_;
   const size_t maximal_chunk_size_;
@@ -134,6 +141,7 @@ class ScrubbingPipeline : public Observable<ScrubbingResult> {
   static const uint64_t kMemLowWatermark = 384 * 1024 * 1024;
   static const uint64_t kMemHighWatermark = 512 * 1024 * 1024;
   static const unsigned kMaxFilesInFlight = 8000;
+  static const unsigned kBlockTubeCapacity = 4096;
   static const unsigned kNforkScrubbingCallback = 1;
   static const unsigned kNforkHash = 2;
   static const unsigned kNforkChunk = 1;
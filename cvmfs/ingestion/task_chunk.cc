@@ -18,7 +18,8 @@ atomic_int64 TaskChunk::tag_seq_ = 2 << 28;
 
 /**
  * Consumes the stream of input blocks and produces new output blocks according
- * to cut marks.  The output blocks correspond to chunks.
+ * to cut marks.  The output blocks correspond to chunks.  They refer to slices
+ * of the input blocks' data without copying.
  */
 void TaskChunk::Process(BlockItem *input_block) {
   FileItem *file_item = input_block->file_item();
@@ -80,9 +81,8 @@ void TaskChunk::Process(BlockItem *input_block) {
     case BlockItem::kBlockData:
       if (output_block_bulk) {
         if (chunk_info.next_chunk != NULL) {
-          // Reserve zero-copy for the regular chunk
-          output_block_bulk->MakeDataCopy(input_block->data(),
-                                          input_block->size());
+          // Share the data with the regular chunk
+          output_block_bulk->MakeDataSlice(input_block, 0, input_block->size());
         } else {
           // There is only the bulk chunk, zero copy
           output_block_bulk->MakeDataMove(input_block);
@@ -104,8 +104,7 @@ void TaskChunk::Process(BlockItem *input_block) {
               new BlockItem(chunk_info.output_tag_chunk, allocator_);
             block_tail->SetFileItem(file_item);
             block_tail->SetChunkItem(chunk_info.next_chunk);
-            block_tail->MakeDataCopy(input_block->data() + offset_in_block,
-                                     tail_size);
+            block_tail->MakeDataSlice(input_block, offset_in_block, tail_size);
             tubes_out_->Dispatch(block_tail);
           }
 
@@ -136,13 +135,12 @@ void TaskChunk::Process(BlockItem *input_block) {
             new BlockItem(chunk_info.output_tag_chunk, allocator_);
           block_tail->SetFileItem(file_item);
           block_tail->SetChunkItem(chunk_info.next_chunk);
-          block_tail->MakeDataCopy(input_block->data() + offset_in_block,
-                                   tail_size);
+          block_tail->MakeDataSlice(input_block, offset_in_block, tail_size);
           tubes_out_->Dispatch(block_tail);
           chunk_info.offset += tail_size;
         }
 
-        // Delete data from incoming block
+        // Drop the reference of the incoming block, the slices keep the data
         input_block->Reset();
       }
 
@@ -14,11 +14,17 @@
 
 /**
  * The data payload of the blocks is replaced by their compressed counterparts.
- * The block tags stay the same.
- * TODO(jblomer): avoid memory copy with EchoCompressor
+ * The block tags stay the same.  Blocks of uncompressed files are passed on
+ * as they are.
  */
 void TaskCompress::Process(BlockItem *input_block) {
   assert(input_block->chunk_item() != NULL);
+  if (input_block->file_item()->compression_algorithm() ==
+      zlib::kNoCompression)
+  {
+    tubes_out_->Dispatch(input_block);
+    return;
+  }
 
   zlib::Compressor *compressor = input_block->chunk_item()->GetCompressor();
   const int64_t tag = input_block->tag();
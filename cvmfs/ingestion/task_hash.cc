@@ -5,27 +5,68 @@
 #include "cvmfs_config.h"
 #include "task_hash.h"
 
+#include <cassert>
 #include <cstdlib>
 
-#include "crypto/hash.h"
 #include "util/exception.h"
 
 
 void TaskHash::Process(BlockItem *input_block) {
-  ChunkItem *chunk = input_block->chunk_item();
-  assert(chunk != NULL);
-
-  switch (input_block->type()) {
-    case BlockItem::kBlockData:
-      shash::Update(input_block->data(), input_block->size(),
-                    chunk->hash_ctx());
-      break;
-    case BlockItem::kBlockStop:
-      shash::Final(chunk->hash_ctx(), chunk->hash_ptr());
-      break;
-    default:
-      PANIC(NULL);
+  std::vector<BlockItem *> blocks;
+  blocks.push_back(input_block);
+  if (shash::GetBatchLanes() > 1) {
+    BlockItem *batch[kMaxBatch - 1];
+    unsigned num_blocks = tube_->TryPopFrontBatch(batch, kMaxBatch - 1);
+    for (unsigned i = 0; i < num_blocks; ++i) {
+      if (batch[i]->IsQuitBeacon()) {
+        // The quit beacon is the last item in the tube, so that putting it
+        // back neither reorders blocks nor blocks on a full tube
+        tube_->EnqueueBack(batch[i]);
+        assert(i == num_blocks - 1);
+        break;
+      }
+      blocks.push_back(batch[i]);
+    }
   }
 
-  tubes_out_->Dispatch(input_block);
+  for (unsigned i = 0; i < blocks.size(); ++i) {
+    BlockItem *block = blocks[i];
+    ChunkItem *chunk = block->chunk_item();
+    assert(chunk != NULL);
+
+    // Blocks of the same chunk are hashed in order
+    for (unsigned j = 0; j < pending_blocks_.size(); ++j) {
+      if (pending_blocks_[j]->chunk_item() == chunk) {
+        Flush();
+        break;
+      }
+    }
+
+    switch (block->type()) {
+      case BlockItem::kBlockData:
+        pending_blocks_.push_back(block);
+        pending_updates_.push_back(
+          shash::BatchItem(block->data(), block->size(), chunk->hash_ctx()));
+        break;
+      case BlockItem::kBlockStop:
+        Flush();
+        shash::Final(chunk->hash_ctx(), chunk->hash_ptr());
+        tubes_out_->Dispatch(block);
+        break;
+      default:
+        PANIC(NULL);
+    }
+  }
+  Flush();
+}
+
+
+void TaskHash::Flush() {
+  if (pending_blocks_.empty())
+    return;
+  shash::UpdateBatch(&pending_updates_[0], pending_updates_.size());
+  for (unsigned i = 0; i < pending_blocks_.size(); ++i)
+    tubes_out_->Dispatch(pending_blocks_[i]);
+  pending_blocks_.clear();
+  pending_updates_.clear();
 }
@@ -5,11 +5,20 @@
 #ifndef CVMFS_INGESTION_TASK_HASH_H_
 #define CVMFS_INGESTION_TASK_HASH_H_
 
+#include <vector>
+
+#include "crypto/hash.h"
 #include "ingestion/item.h"
 #include "ingestion/task.h"
 
+/**
+ * Blocks of different chunks that are waiting in the input tube are hashed
+ * together with shash::UpdateBatch(), so that SHA-1 streams share SIMD lanes.
+ */
 class TaskHash : public TubeConsumer<BlockItem> {
  public:
+  static const unsigned kMaxBatch = 16;
+
   TaskHash(Tube<BlockItem> *tube_in, TubeGroup<BlockItem> *tubes_out)
     : TubeConsumer<BlockItem>(tube_in), tubes_out_(tubes_out) { }
 
@@ -17,7 +26,14 @@ class TaskHash : public TubeConsumer<BlockItem> {
   virtual void Process(BlockItem *input_block);
 
  private:
+  void Flush();
+
   TubeGroup<BlockItem> *tubes_out_;
+  /**
+   * Data blocks of distinct chunks whose hash update is pending
+   */
+  std::vector<BlockItem *> pending_blocks_;
+  std::vector<shash::BatchItem> pending_updates_;
 };
 
 #endif  // CVMFS_INGESTION_TASK_HASH_H_
@@ -44,24 +44,25 @@ void TaskRead::Process(FileItem *item) {
       item->chunk_detector()->MightFindChunks(item->size()));
   }
 
-  unsigned char *buffer[kBlockSize];
   uint64_t tag = atomic_xadd64(&tag_seq_, 1);
   ssize_t nbytes = -1;
   unsigned cnt = 0;
   do {
-    nbytes = item->Read(buffer, kBlockSize);
+    // Read directly into the (pooled) block buffer
+    BlockItem *block_item = new BlockItem(tag, allocator_);
+    block_item->SetFileItem(item);
+    block_item->MakeData(kBlockSize);
+    nbytes = item->Read(block_item->data(), kBlockSize);
     if (nbytes < 0) {
       PANIC(kLogStderr, "failed to read %s (%d)", item->path().c_str(), errno);
     }
 
-    BlockItem *block_item = new BlockItem(tag, allocator_);
-    block_item->SetFileItem(item);
     if (nbytes == 0) {
       item->Close();
+      block_item->Reset();
       block_item->MakeStop();
     } else {
-      block_item->MakeDataCopy(reinterpret_cast<unsigned char *>(buffer),
-                               nbytes);
+      block_item->set_size(nbytes);
     }
     tubes_out_->Dispatch(block_item);
 
@@ -6,6 +6,7 @@
 #define CVMFS_INGESTION_TUBE_H_
 
 #include <pthread.h>
+#include <sched.h>
 #include <stdint.h>
 
 #include <cassert>
@@ -34,7 +35,22 @@
  *
  * Internally, uses conditional variables to block when threads try to pop from
  * the empty tube or insert into the full tube.
+ *
+ * Alternatively, a tube can be created as a bounded, lock-free ring buffer
+ * (kTubeRing).  Items are then passed through an array of sequence-numbered
+ * slots without taking a lock or allocating a link.  Threads that find the
+ * ring empty (or full) first spin and yield for a while; only then they sleep
+ * on the conditional variables, which are signaled only if there are sleeping
+ * threads.  The ring supports the FIFO operations EnqueueBack(), PopFront(),
+ * TryPopFront(), the batch versions of the pop operations, Wait(), IsEmpty(),
+ * and size().  It does not support EnqueueFront(), PopBack(), and Slice(), and
+ * EnqueueBack() returns NULL instead of a link.
  */
+enum TubeType {
+  kTubeLinked = 0,
+  kTubeRing,
+};
+
 template <class ItemT>
 class Tube : SingleCopy {
  public:
@@ -50,11 +66,23 @@ class Tube : SingleCopy {
     Link *prev_;
   };
 
-  Tube() : limit_(uint64_t(-1)), size_(0) { Init(); }
+  /**
+   * Default capacity of ring tubes
+   */
+  static const unsigned kDefaultRingCapacity = 4096;
+
+  Tube() : limit_(uint64_t(-1)), size_(0) { Init(kTubeLinked); }
   explicit Tube(uint64_t limit) : limit_(limit), size_(0) {
-    Init();
+    Init(kTubeLinked);
+  }
+  /**
+   * For ring tubes, the limit is rounded up to the next power of two.
+   */
+  Tube(uint64_t limit, TubeType type) : limit_(limit), size_(0) {
+    Init(type);
   }
   ~Tube() {
+    delete[] cells_;
     Link *cursor = head_;
     do {
       Link *prev = cursor->prev_;
@@ -72,6 +100,10 @@ class Tube : SingleCopy {
    */
   Link *EnqueueBack(ItemT *item) {
     assert(item != NULL);
+    if (cells_ != NULL) {
+      RingEnqueue(item);
+      return NULL;
+    }
     MutexLockGuard lock_guard(&lock_);
     while (size_ == limit_)
       pthread_cond_wait(&cond_capacious_, &lock_);
@@ -92,6 +124,7 @@ class Tube : SingleCopy {
    */
   Link *EnqueueFront(ItemT *item) {
     assert(item != NULL);
+    assert(cells_ == NULL);
     MutexLockGuard lock_guard(&lock_);
     while (size_ == limit_)
       pthread_cond_wait(&cond_capacious_, &lock_);
@@ -112,6 +145,7 @@ class Tube : SingleCopy {
    * element.
    */
   ItemT *Slice(Link *link) {
+    assert(cells_ == NULL);
     MutexLockGuard lock_guard(&lock_);
     return SliceUnlocked(link);
   }
@@ -121,6 +155,11 @@ class Tube : SingleCopy {
    * empty.
    */
   ItemT *PopFront() {
+    if (cells_ != NULL) {
+      ItemT *item;
+      RingDequeue(&item, 1, true);
+      return item;
+    }
     MutexLockGuard lock_guard(&lock_);
     while (size_ == 0)
       pthread_cond_wait(&cond_populated_, &lock_);
@@ -135,6 +174,10 @@ class Tube : SingleCopy {
    *     item = PopFront();
    */
   ItemT *TryPopFront() {
+    if (cells_ != NULL) {
+      ItemT *item;
+      return (RingDequeue(&item, 1, false) == 0) ? NULL : item;
+    }
     MutexLockGuard lock_guard(&lock_);
     // Note that we don't need to wait for a signal to arrive
     if (size_ == 0)
@@ -142,11 +185,44 @@ class Tube : SingleCopy {
     return SliceUnlocked(head_->prev_);
   }
 
+  /**
+   * Removes up to max_items elements from the front of the queue and stores
+   * them in FIFO order in items.  Blocks until there is at least one element.
+   * Returns the number of removed elements.
+   */
+  unsigned PopFrontBatch(ItemT **items, unsigned max_items) {
+    assert(max_items > 0);
+    if (cells_ != NULL)
+      return RingDequeue(items, max_items, true);
+    MutexLockGuard lock_guard(&lock_);
+    while (size_ == 0)
+      pthread_cond_wait(&cond_populated_, &lock_);
+    unsigned num_items = 0;
+    while ((size_ > 0) && (num_items < max_items))
+      items[num_items++] = SliceUnlocked(head_->prev_);
+    return num_items;
+  }
+
+  /**
+   * Like PopFrontBatch() but returns 0 instead of blocking on an empty tube
+   */
+  unsigned TryPopFrontBatch(ItemT **items, unsigned max_items) {
+    assert(max_items > 0);
+    if (cells_ != NULL)
+      return RingDequeue(items, max_items, false);
+    MutexLockGuard lock_guard(&lock_);
+    unsigned num_items = 0;
+    while ((size_ > 0) && (num_items < max_items))
+      items[num_items++] = SliceUnlocked(head_->prev_);
+    return num_items;
+  }
+
   /**
    * Remove and return the last element from the queue.  Block if tube is
    * empty.
    */
   ItemT *PopBack() {
+    assert(cells_ == NULL);
     MutexLockGuard lock_guard(&lock_);
     while (size_ == 0)
       pthread_cond_wait(&cond_populated_, &lock_);
@@ -158,22 +234,69 @@ class Tube : SingleCopy {
    */
   void Wait() {
     MutexLockGuard lock_guard(&lock_);
+    if (cells_ != NULL) {
+      RingSleepUnlocked(&num_sleeping_idle_);
+      while (RingSize() > 0)
+        pthread_cond_wait(&cond_empty_, &lock_);
+      __atomic_sub_fetch(&num_sleeping_idle_, 1, __ATOMIC_SEQ_CST);
+      return;
+    }
     while (size_ > 0)
       pthread_cond_wait(&cond_empty_, &lock_);
   }
 
   bool IsEmpty() {
+    if (cells_ != NULL)
+      return RingSize() == 0;
     MutexLockGuard lock_guard(&lock_);
     return size_ == 0;
   }
 
   uint64_t size() {
+    if (cells_ != NULL)
+      return RingSize();
     MutexLockGuard lock_guard(&lock_);
     return size_;
   }
 
  private:
-  void Init() {
+  /**
+   * Number of busy-waiting and of yielding rounds before a thread sleeps on an
+   * empty or full ring
+   */
+  static const unsigned kSpinRounds = 128;
+  static const unsigned kYieldRounds = 16;
+
+  /**
+   * A ring slot.  The sequence number tells whether the slot is free for the
+   * producer at enqueue position seq or filled for the consumer at dequeue
+   * position seq - 1.
+   */
+  struct Cell {
+    uint64_t seq;
+    ItemT *item;
+  };
+
+  void Init(TubeType type) {
+    cells_ = NULL;
+    mask_ = 0;
+    enqueue_pos_ = dequeue_pos_ = 0;
+    num_sleeping_consumers_ = num_sleeping_producers_ = 0;
+    num_sleeping_idle_ = 0;
+    if (type == kTubeRing) {
+      assert(limit_ > 0);
+      uint64_t capacity = 2;
+      while (capacity < limit_)
+        capacity <<= 1;
+      limit_ = capacity;
+      mask_ = capacity - 1;
+      cells_ = new Cell[capacity];
+      for (uint64_t i = 0; i < capacity; ++i) {
+        cells_[i].seq = i;
+        cells_[i].item = NULL;
+      }
+    }
+
     Link *sentinel = new Link(NULL);
     head_ = sentinel;
     head_->next_ = head_->prev_ = sentinel;
@@ -205,6 +328,154 @@ class Tube : SingleCopy {
     return item;
   }
 
+  /**
+   * Spins for the first rounds, then yields the CPU.  Returns false if the
+   * caller should go to sleep.
+   */
+  static bool Backoff(unsigned *round) {
+    if (*round < kSpinRounds) {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_ia32_pause();
+#else
+      __asm__ __volatile__("" : : : "memory");
+#endif
+    } else if (*round < kSpinRounds + kYieldRounds) {
+      sched_yield();
+    } else {
+      return false;
+    }
+    (*round)++;
+    return true;
+  }
+
+  uint64_t RingSize() {
+    // The dequeue position never overtakes the enqueue position
+    uint64_t dequeue_pos = __atomic_load_n(&dequeue_pos_, __ATOMIC_SEQ_CST);
+    return __atomic_load_n(&enqueue_pos_, __ATOMIC_SEQ_CST) - dequeue_pos;
+  }
+
+  bool RingTryEnqueue(ItemT *item) {
+    uint64_t pos = __atomic_load_n(&enqueue_pos_, __ATOMIC_RELAXED);
+    Cell *cell;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      uint64_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+      int64_t diff = static_cast<int64_t>(seq - pos);
+      if (diff == 0) {
+        if (__atomic_compare_exchange_n(&enqueue_pos_, &pos, pos + 1, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+          break;
+        }
+      } else if (diff < 0) {
+        // The slot still holds the item from the previous round
+        return false;
+      } else {
+        pos = __atomic_load_n(&enqueue_pos_, __ATOMIC_RELAXED);
+      }
+    }
+    cell->item = item;
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  /**
+   * Claims up to max_items consecutive filled slots with a single compare and
+   * swap of the dequeue position.
+   */
+  unsigned RingTryDequeue(ItemT **items, unsigned max_items) {
+    uint64_t pos = __atomic_load_n(&dequeue_pos_, __ATOMIC_RELAXED);
+    unsigned num_items;
+    while (true) {
+      num_items = 0;
+      while (num_items < max_items) {
+        Cell *cell = &cells_[(pos + num_items) & mask_];
+        uint64_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        if (seq != pos + num_items + 1)
+          break;
+        num_items++;
+      }
+      if (num_items == 0) {
+        uint64_t seq =
+          __atomic_load_n(&cells_[pos & mask_].seq, __ATOMIC_ACQUIRE);
+        if (static_cast<int64_t>(seq - (pos + 1)) < 0)
+          return 0;
+        // Another consumer took the slot, try again at the new position
+        pos = __atomic_load_n(&dequeue_pos_, __ATOMIC_RELAXED);
+        continue;
+      }
+      if (__atomic_compare_exchange_n(&dequeue_pos_, &pos, pos + num_items,
+                                      true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      {
+        break;
+      }
+    }
+    for (unsigned i = 0; i < num_items; ++i) {
+      Cell *cell = &cells_[(pos + i) & mask_];
+      items[i] = cell->item;
+      __atomic_store_n(&cell->seq, pos + i + mask_ + 1, __ATOMIC_RELEASE);
+    }
+    return num_items;
+  }
+
+  /**
+   * Registers the calling thread as a sleeper; must be called with lock_ held
+   * before the sleep condition is checked for the last time.  Together with
+   * the fence in RingWake(), either the sleeper sees the new state or the
+   * waking thread sees the sleeper.
+   */
+  void RingSleepUnlocked(int32_t *num_sleeping) {
+    __atomic_add_fetch(num_sleeping, 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  }
+
+  void RingWake(int32_t *num_sleeping, pthread_cond_t *cond, bool broadcast) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(num_sleeping, __ATOMIC_SEQ_CST) == 0)
+      return;
+    MutexLockGuard lock_guard(&lock_);
+    int retval = broadcast ? pthread_cond_broadcast(cond)
+                           : pthread_cond_signal(cond);
+    assert(retval == 0);
+  }
+
+  void RingEnqueue(ItemT *item) {
+    unsigned round = 0;
+    while (!RingTryEnqueue(item)) {
+      if (Backoff(&round))
+        continue;
+      MutexLockGuard lock_guard(&lock_);
+      RingSleepUnlocked(&num_sleeping_producers_);
+      while (!RingTryEnqueue(item))
+        pthread_cond_wait(&cond_capacious_, &lock_);
+      __atomic_sub_fetch(&num_sleeping_producers_, 1, __ATOMIC_SEQ_CST);
+      break;
+    }
+    RingWake(&num_sleeping_consumers_, &cond_populated_, false);
+  }
+
+  unsigned RingDequeue(ItemT **items, unsigned max_items, bool block) {
+    unsigned num_items;
+    unsigned round = 0;
+    while ((num_items = RingTryDequeue(items, max_items)) == 0) {
+      if (!block)
+        return 0;
+      if (Backoff(&round))
+        continue;
+      MutexLockGuard lock_guard(&lock_);
+      RingSleepUnlocked(&num_sleeping_consumers_);
+      while ((num_items = RingTryDequeue(items, max_items)) == 0)
+        pthread_cond_wait(&cond_populated_, &lock_);
+      __atomic_sub_fetch(&num_sleeping_consumers_, 1, __ATOMIC_SEQ_CST);
+      break;
+    }
+    // Several producers might wait for the slots freed by a batch
+    RingWake(&num_sleeping_producers_, &cond_capacious_, true);
+    if (RingSize() == 0)
+      RingWake(&num_sleeping_idle_, &cond_empty_, true);
+    return num_items;
+  }
+
 
   /**
    * Adding new item blocks as long as limit_ == size_
@@ -234,6 +505,25 @@ class Tube : SingleCopy {
    * Signals if the queue runs empty
    */
   pthread_cond_t cond_empty_;
+
+  /**
+   * The slots of a ring tube; NULL for linked tubes.  The enqueue and dequeue
+   * positions grow monotonically and are kept on separate cache lines.
+   */
+  Cell *cells_;
+  uint64_t mask_;
+  char padding_enqueue_[64];
+  uint64_t enqueue_pos_;
+  char padding_dequeue_[64];
+  uint64_t dequeue_pos_;
+  char padding_sleeping_[64];
+  /**
+   * Number of threads sleeping on cond_populated_, cond_capacious_, and
+   * cond_empty_ of a ring tube
+   */
+  int32_t num_sleeping_consumers_;
+  int32_t num_sleeping_producers_;
+  int32_t num_sleeping_idle_;
 };
 
 
@@ -266,7 +556,8 @@ class TubeGroup : SingleCopy {
   }
 
   /**
-   * Like Tube::EnqueueBack(), but pick a tube according to ItemT::tag()
+   * Like Tube::EnqueueBack(), but pick a tube according to ItemT::tag().
+   * Returns NULL for ring tubes.
    */
   typename Tube<ItemT>::Link *Dispatch(ItemT *item) {
     assert(is_active_);
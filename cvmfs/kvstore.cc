@@ -16,6 +16,8 @@
 #include "util/async.h"
 #include "util/concurrency.h"
 #include "util/logging.h"
+#include "util/platform.h"
+#include "util/string.h"
 
 using namespace std;  // NOLINT
 
@@ -36,22 +38,45 @@ MemoryKvStore::MemoryKvStore(
   unsigned int cache_entries,
   MemoryAllocator alloc,
   unsigned alloc_size,
-  perf::StatisticsTemplate statistics)
+  perf::StatisticsTemplate statistics,
+  unsigned num_nodes,
+  bool huge_pages)
   : allocator_(alloc)
   , used_bytes_(0)
   , entry_count_(0)
   , max_entries_(cache_entries)
   , entries_(cache_entries, shash::Any(), hasher_any,
              perf::StatisticsTemplate("lru", statistics))
-  , heap_(NULL)
   , counters_(statistics)
 {
   int retval = pthread_rwlock_init(&rwlock_, NULL);
   assert(retval == 0);
   switch (alloc) {
     case kMallocHeap:
-      heap_ = new MallocHeap(alloc_size,
-          this->MakeCallback(&MemoryKvStore::OnBlockMove, this));
+      if (num_nodes == 0)
+        num_nodes = 1;
+      if (num_nodes > kMaxNodes) {
+        LogCvmfs(kLogKvStore, kLogDebug | kLogSyslogWarn,
+                 "limiting memory heaps to %u of %u NUMA nodes",
+                 kMaxNodes, num_nodes);
+        num_nodes = kMaxNodes;
+      }
+      for (unsigned i = 0; i < num_nodes; ++i) {
+        MallocHeap *heap = new MallocHeap(alloc_size,
+            this->MakeCallback(&MemoryKvStore::OnBlockMove, this));
+        if ((num_nodes > 1) && !heap->BindToNode(i)) {
+          LogCvmfs(kLogKvStore, kLogDebug | kLogSyslogWarn,
+                   "failed to bind heap to NUMA node %u", i);
+        }
+        if (huge_pages && !heap->AdviseHugePages()) {
+          LogCvmfs(kLogKvStore, kLogDebug | kLogSyslogWarn,
+                   "huge pages not available for the memory heap");
+        }
+        heaps_.push_back(heap);
+        sz_nodes_.push_back(statistics.RegisterTemplated(
+          "sz_node" + StringifyInt(i),
+          "Bytes stored on NUMA node " + StringifyInt(i)));
+      }
       break;
     default:
       break;
@@ -60,7 +85,8 @@ MemoryKvStore::MemoryKvStore(
 
 
 MemoryKvStore::~MemoryKvStore() {
-  delete heap_;
+  for (unsigned i = 0; i < heaps_.size(); ++i)
+    delete heaps_[i];
   pthread_rwlock_destroy(&rwlock_);
 }
 
@@ -76,6 +102,12 @@ void MemoryKvStore::OnBlockMove(const MallocHeap::BlockPtr &ptr) {
   LogCvmfs(kLogKvStore, kLogDebug, "compaction moved %s to %p",
            a.id.ToString().c_str(), ptr.pointer);
   assert(a.version == 0);
+  if (a.is_replica) {
+    ReplicaMap::iterator i = replicas_.find(a.id);
+    assert(i != replicas_.end());
+    i->second[a.node] = static_cast<char *>(ptr.pointer) + sizeof(a);
+    return;
+  }
   const bool update_lru = false;
   ok = entries_.Lookup(a.id, &buf, update_lru);
   assert(ok);
@@ -93,6 +125,63 @@ bool MemoryKvStore::Contains(const shash::Any &id) {
 }
 
 
+void MemoryKvStore::UpdateNodeCounter(unsigned node) {
+  sz_nodes_[node]->Set(heaps_[node]->stored_bytes());
+}
+
+
+void *MemoryKvStore::AllocOnNode(
+  unsigned node,
+  const AllocHeader &header,
+  size_t size)
+{
+  AllocHeader a(header);
+  a.node = node;
+  void *block = heaps_[node]->Allocate(size + sizeof(a), &a, sizeof(a));
+  if (!block) return NULL;
+  UpdateNodeCounter(node);
+  return static_cast<char *>(block) + sizeof(a);
+}
+
+
+void MemoryKvStore::FreeOnNode(void *address) {
+  AllocHeader a;
+  void *block = static_cast<char *>(address) - sizeof(a);
+  memcpy(&a, block, sizeof(a));
+  heaps_[a.node]->MarkFree(block);
+  UpdateNodeCounter(a.node);
+}
+
+
+/**
+ * Copies the primary object to all other nodes.  Returns the number of
+ * additional bytes.
+ */
+size_t MemoryKvStore::CreateReplicas(const MemoryBuffer &mem) {
+  AllocHeader primary;
+  memcpy(&primary, static_cast<char *>(mem.address) - sizeof(primary),
+         sizeof(primary));
+  AllocHeader a;
+  a.id = mem.id;
+  a.is_replica = true;
+  vector<void *> addresses(heaps_.size(), NULL);
+  size_t nbytes = 0;
+  for (unsigned i = 0; i < heaps_.size(); ++i) {
+    if (i == primary.node) continue;
+    addresses[i] = AllocOnNode(i, a, mem.size);
+    if (!addresses[i]) {
+      LogCvmfs(kLogKvStore, kLogDebug, "no space for replica of %s on node %u",
+               mem.id.ToString().c_str(), i);
+      continue;
+    }
+    memcpy(addresses[i], mem.address, mem.size);
+    nbytes += mem.size;
+  }
+  replicas_[mem.id] = addresses;
+  return nbytes;
+}
+
+
 int MemoryKvStore::DoMalloc(MemoryBuffer *buf) {
   MemoryBuffer tmp;
   AllocHeader a;
@@ -107,14 +196,19 @@ int MemoryKvStore::DoMalloc(MemoryBuffer *buf) {
         tmp.address = malloc(tmp.size);
         if (!tmp.address) return -errno;
         break;
-      case kMallocHeap:
-        assert(heap_);
+      case kMallocHeap: {
+        assert(!heaps_.empty());
         a.id = tmp.id;
-        tmp.address =
-          heap_->Allocate(tmp.size + sizeof(a), &a, sizeof(a));
+        // Prefer the local node, fall back to the other nodes if it is full
+        const unsigned local_node =
+          (heaps_.size() == 1) ? 0 : platform_getnode() % heaps_.size();
+        for (unsigned i = 0; (i < heaps_.size()) && !tmp.address; ++i) {
+          tmp.address =
+            AllocOnNode((local_node + i) % heaps_.size(), a, tmp.size);
+        }
         if (!tmp.address) return -ENOMEM;
-        tmp.address = static_cast<char *>(tmp.address) + sizeof(a);
         break;
+      }
       default:
         abort();
     }
@@ -125,18 +219,31 @@ int MemoryKvStore::DoMalloc(MemoryBuffer *buf) {
 }
 
 
-void MemoryKvStore::DoFree(MemoryBuffer *buf) {
-  AllocHeader a;
-
+/**
+ * Returns the number of freed bytes, including the node replicas.
+ */
+size_t MemoryKvStore::DoFree(MemoryBuffer *buf) {
   assert(buf);
-  if (!buf->address) return;
+  if (!buf->address) return buf->size;
   switch (allocator_) {
     case kMallocLibc:
       free(buf->address);
-      return;
-    case kMallocHeap:
-      heap_->MarkFree(static_cast<char *>(buf->address) - sizeof(a));
-      return;
+      return buf->size;
+    case kMallocHeap: {
+      FreeOnNode(buf->address);
+      ReplicaMap::iterator i = replicas_.find(buf->id);
+      if (i == replicas_.end())
+        return buf->size;
+      size_t nbytes = 0;
+      for (unsigned node = 0; node < i->second.size(); ++node) {
+        if (!i->second[node]) continue;
+        FreeOnNode(i->second[node]);
+        nbytes += buf->size;
+      }
+      replicas_.erase(i);
+      perf::Xadd(counters_.sz_replicas, -static_cast<int64_t>(nbytes));
+      return buf->size + nbytes;
+    }
     default:
       abort();
   }
@@ -146,15 +253,20 @@ void MemoryKvStore::DoFree(MemoryBuffer *buf) {
 bool MemoryKvStore::CompactMemory() {
   double utilization;
   switch (allocator_) {
-    case kMallocHeap:
-      utilization = heap_->utilization();
-      LogCvmfs(kLogKvStore, kLogDebug, "compact requested (%f)", utilization);
-      if (utilization < kCompactThreshold) {
-        LogCvmfs(kLogKvStore, kLogDebug, "compacting heap");
-        heap_->Compact();
-        if (heap_->utilization() > utilization) return true;
+    case kMallocHeap: {
+      bool result = false;
+      for (unsigned i = 0; i < heaps_.size(); ++i) {
+        utilization = heaps_[i]->utilization();
+        LogCvmfs(kLogKvStore, kLogDebug, "compact requested (%f) on node %u",
+                 utilization, i);
+        if (utilization < kCompactThreshold) {
+          LogCvmfs(kLogKvStore, kLogDebug, "compacting heap");
+          heaps_[i]->Compact();
+          if (heaps_[i]->utilization() > utilization) result = true;
+        }
       }
-      return false;
+      return result;
+    }
     default:
       // the others can't do any compact, so just ignore
       LogCvmfs(kLogKvStore, kLogDebug, "compact requested");
@@ -251,10 +363,19 @@ int64_t MemoryKvStore::Read(
              offset, mem.size, id.ToString().c_str());
     return 0;
   }
+  void *address = mem.address;
+  if (IsReplicated(mem.object_flags) && (heaps_.size() > 1)) {
+    ReplicaMap::const_iterator i = replicas_.find(id);
+    const unsigned node = platform_getnode() % heaps_.size();
+    if ((i != replicas_.end()) && i->second[node]) {
+      address = i->second[node];
+      perf::Inc(counters_.n_read_replica);
+    }
+  }
   uint64_t copy_size = std::min(mem.size - offset, size);
   // LogCvmfs(kLogKvStore, kLogDebug, "copy %u B from offset %u of %s",
   //          copy_size, offset, id.ToString().c_str());
-  memcpy(buf, static_cast<char *>(mem.address) + offset, copy_size);
+  memcpy(buf, static_cast<char *>(address) + offset, copy_size);
   perf::Xadd(counters_.sz_read, copy_size);
   return copy_size;
 }
@@ -285,9 +406,7 @@ int MemoryKvStore::DoCommit(const MemoryBuffer &buf) {
   LogCvmfs(kLogKvStore, kLogDebug, "commit %s", buf.id.ToString().c_str());
   if (entries_.Lookup(buf.id, &mem)) {
     LogCvmfs(kLogKvStore, kLogDebug, "commit overwrites existing entry");
-    size_t old_size = mem.size;
-    DoFree(&mem);
-    used_bytes_ -= old_size;
+    used_bytes_ -= DoFree(&mem);
     counters_.sz_size->Set(used_bytes_);
     --entry_count_;
   } else {
@@ -312,6 +431,11 @@ int MemoryKvStore::DoCommit(const MemoryBuffer &buf) {
   entries_.Insert(buf.id, mem);
   ++entry_count_;
   used_bytes_ += mem.size;
+  if (IsReplicated(mem.object_flags) && (mem.size > 0)) {
+    const size_t nbytes = CreateReplicas(mem);
+    used_bytes_ += nbytes;
+    perf::Xadd(counters_.sz_replicas, nbytes);
+  }
   counters_.sz_size->Set(used_bytes_);
   perf::Xadd(counters_.sz_committed, mem.size);
   return 0;
@@ -339,10 +463,9 @@ bool MemoryKvStore::DoDelete(const shash::Any &id) {
   }
   assert(entry_count_ > 0);
   --entry_count_;
-  used_bytes_ -= buf.size;
+  used_bytes_ -= DoFree(&buf);
   counters_.sz_size->Set(used_bytes_);
   perf::Xadd(counters_.sz_deleted, buf.size);
-  DoFree(&buf);
   entries_.Forget(id);
   LogCvmfs(kLogKvStore, kLogDebug, "deleted %s", id.ToString().c_str());
   return true;
@@ -373,10 +496,9 @@ bool MemoryKvStore::ShrinkTo(size_t size) {
     assert(entry_count_ > 0);
     --entry_count_;
     entries_.FilterDelete();
-    used_bytes_ -= buf.size;
+    used_bytes_ -= DoFree(&buf);
     perf::Xadd(counters_.sz_shrunk, buf.size);
     counters_.sz_size->Set(used_bytes_);
-    DoFree(&buf);
     LogCvmfs(kLogKvStore, kLogDebug, "delete %s", key.ToString().c_str());
   }
   entries_.FilterEnd();
@@ -8,6 +8,7 @@
 #include <pthread.h>
 #include <unistd.h>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -24,11 +25,13 @@ using namespace std;  // NOLINT
 /**
  * All objects in memory are prepended by an AllocHeader that allows the
  * Key-Value store to find the pointer when the heap memory manager compacts
- * the allocations.
+ * the allocations.  The node is the index of the heap that holds the object.
  */
 struct AllocHeader {
-  AllocHeader() : version(0), id() { }
+  AllocHeader() : version(0), node(0), is_replica(false), id() { }
   uint8_t version;
+  uint8_t node;
+  bool is_replica;
   shash::Any id;
 };
 
@@ -62,6 +65,12 @@ struct MemoryBuffer {
  * mid-operation, and decrement the reference count when done. The store
  * can attempt to reduce its size by removing the least recently used
  * entries without any outstanding references.
+ *
+ * With the heap allocator and more than one NUMA node, there is a MallocHeap
+ * per node.  New objects are placed on the node of the committing thread.
+ * Catalogs and pinned objects are read over and over by all threads, so they
+ * get an additional replica on every other node and reads are served from the
+ * replica on the reader's node.  Replicas count towards the used bytes.
  */
 class MemoryKvStore : SingleCopy, public Callbackable<MallocHeap::BlockPtr> {
  public:
@@ -70,6 +79,12 @@ class MemoryKvStore : SingleCopy, public Callbackable<MallocHeap::BlockPtr> {
     kMallocHeap,
   };
 
+  /**
+   * More nodes are folded onto the first kMaxNodes heaps.  Heaps for higher
+   * node numbers could not be bound to their node anyway.
+   */
+  static const unsigned kMaxNodes = 64;
+
   struct Counters {
     perf::Counter *sz_size;
     perf::Counter *n_getsize;
@@ -84,6 +99,8 @@ class MemoryKvStore : SingleCopy, public Callbackable<MallocHeap::BlockPtr> {
     perf::Counter *sz_committed;
     perf::Counter *sz_deleted;
     perf::Counter *sz_shrunk;
+    perf::Counter *sz_replicas;
+    perf::Counter *n_read_replica;
 
     explicit Counters(perf::StatisticsTemplate statistics) {
       sz_size = statistics.RegisterTemplated("sz_size", "Total size");
@@ -107,14 +124,24 @@ class MemoryKvStore : SingleCopy, public Callbackable<MallocHeap::BlockPtr> {
         "Bytes committed");
       sz_deleted = statistics.RegisterTemplated("sz_deleted", "Bytes deleted");
       sz_shrunk = statistics.RegisterTemplated("sz_shrunk", "Bytes shrunk");
+      sz_replicas = statistics.RegisterTemplated("sz_replicas",
+        "Bytes used by NUMA node replicas");
+      n_read_replica = statistics.RegisterTemplated("n_read_replica",
+        "Number of reads served from a NUMA node replica");
     }
   };
 
+  /**
+   * The NUMA placement and the huge page backing only apply to the heap
+   * allocator.  Every node heap has alloc_size bytes of (virtual) capacity.
+   */
   MemoryKvStore(
     unsigned int cache_entries,
     MemoryAllocator alloc,
     unsigned alloc_size,
-    perf::StatisticsTemplate statistics);
+    perf::StatisticsTemplate statistics,
+    unsigned num_nodes = 1,
+    bool huge_pages = false);
 
   ~MemoryKvStore();
 
@@ -199,13 +226,38 @@ class MemoryKvStore : SingleCopy, public Callbackable<MallocHeap::BlockPtr> {
    */
   size_t GetUsed() { return used_bytes_; }
 
+  /**
+   * The number of bytes that committing the buffer would add, including the
+   * node replicas
+   */
+  size_t GetFootprint(const MemoryBuffer &buf) {
+    return IsReplicated(buf.object_flags) ? buf.size * heaps_.size()
+                                          : buf.size;
+  }
+
  private:
   // Compact memory once utilization falls below the threshold
   static const double kCompactThreshold;  // = 0.8
 
+  /**
+   * Node replica addresses of an object, indexed by node.  NULL for the node
+   * of the primary copy and for nodes without space.
+   */
+  typedef std::map<shash::Any, std::vector<void *> > ReplicaMap;
+
+  bool IsReplicated(int object_flags) {
+    return (heaps_.size() > 1) &&
+           (object_flags &
+            (CacheManager::kLabelCatalog | CacheManager::kLabelPinned));
+  }
+  void *AllocOnNode(unsigned node, const AllocHeader &header, size_t size);
+  void FreeOnNode(void *address);
+  void UpdateNodeCounter(unsigned node);
+  size_t CreateReplicas(const MemoryBuffer &mem);
+
   bool DoDelete(const shash::Any &id);
   int DoMalloc(MemoryBuffer *buf);
-  void DoFree(MemoryBuffer *buf);
+  size_t DoFree(MemoryBuffer *buf);
   int DoCommit(const MemoryBuffer &buf);
   void OnBlockMove(const MallocHeap::BlockPtr &ptr);
   bool CompactMemory();
@@ -215,9 +267,17 @@ class MemoryKvStore : SingleCopy, public Callbackable<MallocHeap::BlockPtr> {
   unsigned int entry_count_;
   unsigned int max_entries_;
   lru::LruCache<shash::Any, MemoryBuffer> entries_;
-  MallocHeap *heap_;
+  /**
+   * One heap per NUMA node, or a single heap
+   */
+  std::vector<MallocHeap *> heaps_;
+  ReplicaMap replicas_;
   pthread_rwlock_t rwlock_;
   Counters counters_;
+  /**
+   * Bytes stored per node heap
+   */
+  std::vector<perf::Counter *> sz_nodes_;
 };
 
 #endif  // CVMFS_KVSTORE_H_
@@ -22,6 +22,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <string>
+#include <vector>
 
 #include "libcvmfs_int.h"
 #include "statistics.h"
@@ -576,3 +577,70 @@ uint64_t cvmfs_get_revision(LibContext *ctx) {
   assert(ctx != NULL);
   return ctx->GetRevision();
 }
+
+
+/**
+ * Expands the paths of a prefetch batch in the worker threads, like
+ * cvmfs_open() does.
+ */
+static int expand_prefetch_path(
+  LibContext *ctx,
+  const char *path,
+  string *expanded_path)
+{
+  int rc = expand_path(0, ctx, path, expanded_path);
+  if (rc < 0)
+    return (errno != 0) ? -errno : -EIO;
+  return 0;
+}
+
+
+LibPrefetchBatch *cvmfs_prefetch_submit(
+  LibContext *ctx,
+  const char * const *paths,
+  size_t npaths,
+  unsigned nthreads,
+  cvmfs_prefetch_callback callback,
+  void *user_data)
+{
+  assert(ctx != NULL);
+  if ((npaths > 0) && (paths == NULL)) {
+    errno = EINVAL;
+    return NULL;
+  }
+  vector<string> path_list;
+  for (size_t i = 0; i < npaths; ++i) {
+    if (paths[i] == NULL) {
+      errno = EINVAL;
+      return NULL;
+    }
+    path_list.push_back(paths[i]);
+  }
+
+  LibPrefetchBatch *batch = new LibPrefetchBatch(
+    ctx, path_list, expand_prefetch_path, callback, user_data);
+  int retval = batch->Spawn(nthreads);
+  if (retval != 0) {
+    delete batch;
+    errno = -retval;
+    return NULL;
+  }
+  return batch;
+}
+
+
+size_t cvmfs_prefetch_pending(LibPrefetchBatch *batch) {
+  assert(batch != NULL);
+  return batch->GetNumPending();
+}
+
+
+size_t cvmfs_prefetch_wait(LibPrefetchBatch *batch) {
+  assert(batch != NULL);
+  return batch->Wait();
+}
+
+
+void cvmfs_prefetch_free(LibPrefetchBatch *batch) {
+  delete batch;
+}
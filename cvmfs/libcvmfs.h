@@ -44,7 +44,9 @@
 //     * Add cvmfs_get_revision()
 // 31: CernVM-FS 2.11
 //     * Move from static libcvmfs.a to shared libcvmfs_client.so
-#define LIBCVMFS_REVISION 31
+// 32: CernVM-FS 2.12
+//     * Add asynchronous batch prefetch (cvmfs_prefetch_*)
+#define LIBCVMFS_REVISION 32
 
 #include <stdint.h>
 #include <sys/stat.h>
@@ -66,9 +68,11 @@ extern "C" {
 // Map C++ classes to their C interface names
 typedef class LibContext cvmfs_context;
 typedef class SimpleOptionsParser cvmfs_option_map;
+typedef class LibPrefetchBatch cvmfs_prefetch_batch;
 #else
 typedef struct LibContext cvmfs_context;
 typedef struct OptionsManager cvmfs_option_map;
+typedef struct LibPrefetchBatch cvmfs_prefetch_batch;
 #endif
 
 /**
@@ -540,6 +544,64 @@ void cvmfs_list_free(char **buf);
  */
 uint64_t cvmfs_get_revision(cvmfs_context *ctx);
 
+/**
+ * Called once for every path of a prefetch batch.  The callback is called
+ * concurrently from the worker threads of the batch.
+ *
+ * @param[in] path, the path as given to cvmfs_prefetch_submit()
+ * @param[in] retval, 0 on success, -errno on failure
+ * @param[in] user_data, the pointer given to cvmfs_prefetch_submit()
+ */
+typedef void (*cvmfs_prefetch_callback)(const char *path,
+                                        int retval,
+                                        void *user_data);
+
+/**
+ * Asynchronously fetch a list of files into the cache.  The paths are
+ * processed by nthreads worker threads that resolve the catalogs and download
+ * the files (or all their chunks) concurrently.  For directories and symlinks
+ * only the catalogs are loaded.  The function returns immediately; completion
+ * can be polled with cvmfs_prefetch_pending(), awaited with
+ * cvmfs_prefetch_wait(), or tracked by the optional callback.
+ *
+ * The handle must be released with cvmfs_prefetch_free().  The context must
+ * not be detached while the batch is running.
+ *
+ * @param[in] paths, array of npaths paths (e.g. /dir/file, not
+ *            /cvmfs/repo/dir/file), copied by the function
+ * @param[in] nthreads, number of worker threads, 0 for the default (8)
+ * @param[in] callback, may be NULL
+ * \return handle to the batch, NULL on failure (sets errno).  If the worker
+ *         threads cannot be started (EAGAIN), the callback may already have
+ *         been called for some of the paths.
+ */
+cvmfs_prefetch_batch *cvmfs_prefetch_submit(
+  cvmfs_context *ctx,
+  const char * const *paths,
+  size_t npaths,
+  unsigned nthreads,
+  cvmfs_prefetch_callback callback,
+  void *user_data);
+
+/**
+ * Number of paths of the batch that are not yet processed.
+ */
+size_t cvmfs_prefetch_pending(cvmfs_prefetch_batch *batch);
+
+/**
+ * Blocks until all the paths of the batch are processed.  Can be called from
+ * several threads.
+ *
+ * \return the number of paths that failed
+ */
+size_t cvmfs_prefetch_wait(cvmfs_prefetch_batch *batch);
+
+/**
+ * Waits for the batch to finish and releases its resources.  Must not be
+ * called while other threads still use the batch handle.
+ */
+void cvmfs_prefetch_free(cvmfs_prefetch_batch *batch);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,7 @@
 #include "util/atomic.h"
 #include "util/logging.h"
 #include "util/murmur.hxx"
+#include "util/mutex.h"
 #include "util/posix.h"
 #include "util/smalloc.h"
 #include "util/string.h"
@@ -619,6 +620,76 @@ int LibContext::Open(const char *c_path) {
 }
 
 
+/**
+ * Makes sure that a regular file, or all of its chunks, are in the cache.  For
+ * other file types, only the catalogs are loaded.  Used by LibPrefetchBatch.
+ */
+int LibContext::Prefetch(const char *c_path) {
+  LogCvmfs(kLogCvmfs, kLogDebug, "prefetch path: %s", c_path);
+  ClientCtxGuard ctxg(geteuid(), getegid(), getpid(), &default_interrupt_cue_);
+
+  catalog::DirectoryEntry dirent;
+  PathString path;
+  path.Assign(c_path, strlen(c_path));
+  if (!GetDirentForPath(path, &dirent))
+    return -ENOENT;
+  if (!dirent.IsRegular())
+    return 0;
+
+  cvmfs::Fetcher *this_fetcher = dirent.IsExternalFile()
+    ? mount_point_->external_fetcher()
+    : mount_point_->fetcher();
+  CacheManager::Label label;
+  label.path = std::string(path.GetChars(), path.GetLength());
+  label.zip_algorithm = dirent.compression_algorithm();
+  if (dirent.IsExternalFile())
+    label.flags |= CacheManager::kLabelExternal;
+
+  if (!dirent.IsChunkedFile()) {
+    label.size = dirent.size();
+    int fd = this_fetcher->Fetch(
+      CacheManager::LabeledObject(dirent.checksum(), label));
+    if (fd < 0) {
+      LogCvmfs(kLogCvmfs, kLogDebug | kLogSyslogErr,
+               "failed to prefetch path: %s, CAS key %s, error code %d",
+               c_path, dirent.checksum().ToString().c_str(), fd);
+      file_system()->io_error_info()->AddIoError();
+      return fd;
+    }
+    file_system()->cache_mgr()->Close(fd);
+    return 0;
+  }
+
+  FileChunkList chunks;
+  if (!mount_point_->catalog_mgr()->ListFileChunks(
+        path, dirent.hash_algorithm(), &chunks) ||
+      chunks.IsEmpty())
+  {
+    LogCvmfs(kLogCvmfs, kLogDebug | kLogSyslogErr, "file %s is marked as "
+             "'chunked', but no chunks found.", path.c_str());
+    file_system()->io_error_info()->AddIoError();
+    return -EIO;
+  }
+  label.flags |= CacheManager::kLabelChunked;
+  for (unsigned i = 0; i < chunks.size(); ++i) {
+    label.size = chunks.AtPtr(i)->size();
+    if (dirent.IsExternalFile())
+      label.range_offset = chunks.AtPtr(i)->offset();
+    int fd = this_fetcher->Fetch(CacheManager::LabeledObject(
+      chunks.AtPtr(i)->content_hash(), label));
+    if (fd < 0) {
+      LogCvmfs(kLogCvmfs, kLogDebug | kLogSyslogErr,
+               "failed to prefetch chunk %u of %s, error code %d",
+               i, c_path, fd);
+      file_system()->io_error_info()->AddIoError();
+      return fd;
+    }
+    file_system()->cache_mgr()->Close(fd);
+  }
+  return 0;
+}
+
+
 int64_t LibContext::Pread(
   int fd,
   void *buf,
@@ -746,3 +817,109 @@ int LibContext::Remount() {
 uint64_t LibContext::GetRevision() {
   return mount_point_->catalog_mgr()->GetRevision();
 }
+
+
+//------------------------------------------------------------------------------
+
+
+LibPrefetchBatch::LibPrefetchBatch(
+  LibContext *ctx,
+  const std::vector<std::string> &paths,
+  PathExpander path_expander,
+  Callback callback,
+  void *user_data)
+  : ctx_(ctx)
+  , paths_(paths)
+  , path_expander_(path_expander)
+  , callback_(callback)
+  , user_data_(user_data)
+{
+  atomic_init32(&next_path_);
+  atomic_init32(&num_pending_);
+  atomic_init32(&num_failed_);
+  atomic_write32(&num_pending_, paths_.size());
+  int retval = pthread_mutex_init(&lock_workers_, NULL);
+  assert(retval == 0);
+}
+
+
+LibPrefetchBatch::~LibPrefetchBatch() {
+  Wait();
+  pthread_mutex_destroy(&lock_workers_);
+}
+
+
+/**
+ * Starts the worker threads.  Returns 0 on success or -errno if a thread
+ * cannot be created.  In the latter case, the workers that are already running
+ * stop after their current path and are joined.
+ */
+int LibPrefetchBatch::Spawn(unsigned num_threads) {
+  assert(workers_.empty());
+  if (num_threads == 0)
+    num_threads = kDefaultNumThreads;
+  num_threads = std::min(num_threads, static_cast<unsigned>(paths_.size()));
+  workers_.resize(num_threads);
+  for (unsigned i = 0; i < num_threads; ++i) {
+    int retval = pthread_create(&workers_[i], NULL, MainWorker, this);
+    if (retval != 0) {
+      LogCvmfs(kLogCvmfs, kLogDebug | kLogSyslogErr,
+               "failed to start prefetch worker (%d)", retval);
+      atomic_write32(&next_path_, paths_.size());
+      workers_.resize(i);
+      Wait();
+      return -retval;
+    }
+  }
+  return 0;
+}
+
+
+/**
+ * Number of paths that are not yet processed.  Can be used to poll for the
+ * completion of the batch.
+ */
+unsigned LibPrefetchBatch::GetNumPending() {
+  return atomic_read32(&num_pending_);
+}
+
+
+/**
+ * Blocks until all paths are processed.  Returns the number of failed paths.
+ * Concurrent callers block until the first one has joined the workers.
+ */
+unsigned LibPrefetchBatch::Wait() {
+  MutexLockGuard guard(&lock_workers_);
+  for (unsigned i = 0; i < workers_.size(); ++i)
+    pthread_join(workers_[i], NULL);
+  workers_.clear();
+  return atomic_read32(&num_failed_);
+}
+
+
+void *LibPrefetchBatch::MainWorker(void *data) {
+  LibPrefetchBatch *batch = reinterpret_cast<LibPrefetchBatch *>(data);
+  while (true) {
+    const int32_t idx = atomic_xadd32(&batch->next_path_, 1);
+    if (idx >= static_cast<int32_t>(batch->paths_.size()))
+      break;
+    batch->ProcessPath(batch->paths_[idx]);
+  }
+  return NULL;
+}
+
+
+void LibPrefetchBatch::ProcessPath(const std::string &path) {
+  int retval = 0;
+  std::string expanded_path = path;
+  if (path_expander_ != NULL)
+    retval = path_expander_(ctx_, path.c_str(), &expanded_path);
+  if (retval == 0)
+    retval = ctx_->Prefetch(expanded_path.c_str());
+
+  if (retval != 0)
+    atomic_inc32(&num_failed_);
+  if (callback_ != NULL)
+    callback_(path.c_str(), retval, user_data_);
+  atomic_dec32(&num_pending_);
+}
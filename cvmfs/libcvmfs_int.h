@@ -28,6 +28,8 @@
 #include "lru.h"
 #include "mountpoint.h"
 #include "options.h"
+#include "util/atomic.h"
+#include "util/single_copy.h"
 
 
 class CacheManager;
@@ -106,6 +108,7 @@ class LibContext : SingleCopy {
                         size_t *buflen);
 
   int Open(const char *c_path);
+  int Prefetch(const char *c_path);
   int64_t Pread(int fd, void *buf, uint64_t size, uint64_t off);
   int Close(int fd);
 
@@ -157,4 +160,62 @@ class LibContext : SingleCopy {
   InterruptCue default_interrupt_cue_;
 };
 
+
+
+/**
+ * Fetches a list of paths into the cache in the background.  A number of
+ * worker threads take the paths one by one, so that nested catalogs are loaded
+ * and objects are downloaded concurrently.  Concurrent requests for the same
+ * object are collapsed by the Fetcher.
+ *
+ * For every path, the callback is called from the worker thread that processed
+ * it with 0 on success or -errno.  Regular files (or all of their chunks) are
+ * stored in the cache; for other file types, only the catalogs are loaded.
+ */
+class LibPrefetchBatch : SingleCopy {
+ public:
+  typedef void (*Callback)(const char *path, int retval, void *user_data);
+  /**
+   * Turns a user-provided path into a path that can be looked up in the
+   * catalogs; returns 0 on success or -errno.
+   */
+  typedef int (*PathExpander)(LibContext *ctx,
+                              const char *path,
+                              std::string *expanded_path);
+
+  static const unsigned kDefaultNumThreads = 8;
+
+  LibPrefetchBatch(LibContext *ctx,
+                   const std::vector<std::string> &paths,
+                   PathExpander path_expander,
+                   Callback callback,
+                   void *user_data);
+  ~LibPrefetchBatch();
+  int Spawn(unsigned num_threads);
+  unsigned GetNumPending();
+  unsigned Wait();
+
+ private:
+  static void *MainWorker(void *data);
+  void ProcessPath(const std::string &path);
+
+  LibContext *ctx_;
+  std::vector<std::string> paths_;
+  PathExpander path_expander_;
+  Callback callback_;
+  void *user_data_;
+  /**
+   * Protects joining and clearing the workers, so that Wait() can be called
+   * from several threads
+   */
+  pthread_mutex_t lock_workers_;
+  std::vector<pthread_t> workers_;
+  /**
+   * Index of the next path to be processed by a worker
+   */
+  atomic_int32 next_path_;
+  atomic_int32 num_pending_;
+  atomic_int32 num_failed_;
+};
+
 #endif  // CVMFS_LIBCVMFS_INT_H_
@@ -79,8 +79,9 @@ struct Counters {
     sz_size = statistics.RegisterTemplated("sz_size", "Total size");
     num_collisions = 0;
     max_collisions = 0;
-    n_hit = statistics.RegisterTemplated("n_hit", "Number of hits");
-    n_miss = statistics.RegisterTemplated("n_miss", "Number of misses");
+    // Hits and misses are counted on every lookup by all the FUSE threads
+    n_hit = statistics.RegisterShardedTemplated("n_hit", "Number of hits");
+    n_miss = statistics.RegisterShardedTemplated("n_miss", "Number of misses");
     n_insert = statistics.RegisterTemplated("n_insert", "Number of inserts");
     n_insert_negative = statistics.RegisterTemplated("n_insert_negative",
         "Number of negative inserts");
@@ -104,6 +105,8 @@ struct Counters {
  */
 template<class Key, class Value>
 class LruCache : SingleCopy {
+  template<class K, class V> friend class PartitionedLruCache;
+
  private:
   // Forward declarations of private internal data structures
   template<class T> class ListEntry;
@@ -517,19 +520,25 @@ class LruCache : SingleCopy {
     allocator_(cache_size),
     lru_list_(&allocator_)
   {
-    assert(cache_size > 0);
-
-    counters_.sz_size->Set(cache_size_);
-    filter_entry_ = NULL;
-    // cache_ = Cache(cache_size_);
-    cache_.Init(cache_size_, empty_key, hasher);
-    perf::Xadd(counters_.sz_allocated, allocator_.bytes_allocated() +
-                  cache_.bytes_allocated());
+    Init(empty_key, hasher);
+  }
 
-#ifdef LRU_CACHE_THREAD_SAFE
-    int retval = pthread_mutex_init(&lock_, NULL);
-    assert(retval == 0);
-#endif
+  /**
+   * Creates a cache that shares the counters with other caches, used for the
+   * partitions of a PartitionedLruCache.
+   */
+  LruCache(const unsigned   cache_size,
+           const Key       &empty_key,
+           uint32_t (*hasher)(const Key &key),
+           const Counters  &counters) :
+    counters_(counters),
+    pause_(false),
+    cache_gauge_(0),
+    cache_size_(cache_size),
+    allocator_(cache_size),
+    lru_list_(&allocator_)
+  {
+    Init(empty_key, hasher);
   }
 
   static double GetEntrySize() {
@@ -697,9 +706,7 @@ class LruCache : SingleCopy {
   virtual void Drop() {
     this->Lock();
 
-    cache_gauge_ = 0;
-    lru_list_.clear();
-    cache_.Clear();
+    DoDrop();
     perf::Inc(counters_.n_drop);
     counters_.sz_allocated->Set(0);
     perf::Xadd(counters_.sz_allocated, allocator_.bytes_allocated() +
@@ -796,6 +803,31 @@ class LruCache : SingleCopy {
   Counters counters_;
 
  private:
+  void Init(const Key &empty_key, uint32_t (*hasher)(const Key &key)) {
+    assert(cache_size_ > 0);
+
+    counters_.sz_size->Set(cache_size_);
+    filter_entry_ = NULL;
+    // cache_ = Cache(cache_size_);
+    cache_.Init(cache_size_, empty_key, hasher);
+    perf::Xadd(counters_.sz_allocated, allocator_.bytes_allocated() +
+                  cache_.bytes_allocated());
+
+#ifdef LRU_CACHE_THREAD_SAFE
+    int retval = pthread_mutex_init(&lock_, NULL);
+    assert(retval == 0);
+#endif
+  }
+
+  /**
+   * Removes all the entries, the cache must be locked.
+   */
+  void DoDrop() {
+    cache_gauge_ = 0;
+    lru_list_.clear();
+    cache_.Clear();
+  }
+
   /**
    *  this just performs a lookup in the cache
    *  WITHOUT changing the LRU order
@@ -871,6 +903,187 @@ class LruCache : SingleCopy {
 #endif
 };  // class LruCache
 
+
+/**
+ * An LruCache that is split into independent partitions.  Keys are assigned
+ * to a partition by their hash and every partition has its own lock and LRU
+ * list, so that concurrent lookups of different keys rarely contend on the
+ * same lock.  The replacement is least-recently-used within a partition.
+ *
+ * The interface is the same as the one of LruCache.  All partitions share
+ * the counters.  The filter operations iterate through the partitions one by
+ * one; only the partition currently being iterated is locked.
+ */
+template<class Key, class Value>
+class PartitionedLruCache : SingleCopy {
+ public:
+  static const unsigned kDefaultNumPartitions = 16;
+  /**
+   * Partitions must hold at least two blocks of the memory allocator
+   */
+  static const unsigned kMinPartitionSize = 128;
+
+  /**
+   * The partition size is rounded down to a multiple of 64.  Small caches get
+   * fewer partitions, down to a single partition.
+   */
+  PartitionedLruCache(const unsigned   cache_size,
+                      const Key       &empty_key,
+                      uint32_t (*hasher)(const Key &key),
+                      perf::StatisticsTemplate statistics,
+                      const unsigned   num_partitions = kDefaultNumPartitions)
+    : counters_(statistics)
+    , hasher_(hasher)
+    , num_partitions_(num_partitions)
+    , filter_partition_(0)
+  {
+    assert(cache_size > 0);
+    assert(num_partitions > 0);
+    if (cache_size / num_partitions_ < kMinPartitionSize)
+      num_partitions_ = std::max(1U, cache_size / kMinPartitionSize);
+    unsigned partition_size = cache_size;
+    if (num_partitions_ > 1)
+      partition_size = (cache_size / num_partitions_) & ~63U;
+
+    partitions_ = new LruCache<Key, Value> *[num_partitions_];
+    for (unsigned i = 0; i < num_partitions_; ++i) {
+      partitions_[i] =
+        new LruCache<Key, Value>(partition_size, empty_key, hasher, counters_);
+    }
+    cache_size_ = partition_size * num_partitions_;
+    counters_.sz_size->Set(cache_size_);
+  }
+
+  static double GetEntrySize() {
+    return LruCache<Key, Value>::GetEntrySize();
+  }
+
+  virtual ~PartitionedLruCache() {
+    for (unsigned i = 0; i < num_partitions_; ++i)
+      delete partitions_[i];
+    delete[] partitions_;
+  }
+
+  virtual bool Insert(const Key &key, const Value &value) {
+    return GetPartition(key)->Insert(key, value);
+  }
+
+  virtual void Update(const Key &key) {
+    GetPartition(key)->Update(key);
+  }
+
+  virtual bool UpdateValue(const Key &key, const Value &value) {
+    return GetPartition(key)->UpdateValue(key, value);
+  }
+
+  virtual bool Lookup(const Key &key, Value *value, bool update_lru = true) {
+    return GetPartition(key)->Lookup(key, value, update_lru);
+  }
+
+  virtual bool Forget(const Key &key) {
+    return GetPartition(key)->Forget(key);
+  }
+
+  virtual void Drop() {
+    for (unsigned i = 0; i < num_partitions_; ++i) {
+      partitions_[i]->Lock();
+      partitions_[i]->DoDrop();
+      partitions_[i]->Unlock();
+    }
+    perf::Inc(counters_.n_drop);
+  }
+
+  void Pause() {
+    for (unsigned i = 0; i < num_partitions_; ++i)
+      partitions_[i]->Pause();
+  }
+
+  void Resume() {
+    for (unsigned i = 0; i < num_partitions_; ++i)
+      partitions_[i]->Resume();
+  }
+
+  /**
+   * Full if any of the partitions is full
+   */
+  bool IsFull() {
+    for (unsigned i = 0; i < num_partitions_; ++i) {
+      if (partitions_[i]->IsFull())
+        return true;
+    }
+    return false;
+  }
+
+  bool IsEmpty() {
+    for (unsigned i = 0; i < num_partitions_; ++i) {
+      if (!partitions_[i]->IsEmpty())
+        return false;
+    }
+    return true;
+  }
+
+  Counters counters() {
+    Counters result = counters_;
+    result.num_collisions = 0;
+    result.max_collisions = 0;
+    for (unsigned i = 0; i < num_partitions_; ++i) {
+      Counters c = partitions_[i]->counters();
+      result.num_collisions += c.num_collisions;
+      result.max_collisions = std::max(result.max_collisions, c.max_collisions);
+    }
+    return result;
+  }
+
+  virtual void FilterBegin() {
+    filter_partition_ = 0;
+    partitions_[0]->FilterBegin();
+  }
+
+  virtual void FilterGet(Key *key, Value *value) {
+    assert(filter_partition_ < num_partitions_);
+    partitions_[filter_partition_]->FilterGet(key, value);
+  }
+
+  virtual bool FilterNext() {
+    assert(filter_partition_ < num_partitions_);
+    while (!partitions_[filter_partition_]->FilterNext()) {
+      partitions_[filter_partition_]->FilterEnd();
+      if (++filter_partition_ == num_partitions_)
+        return false;
+      partitions_[filter_partition_]->FilterBegin();
+    }
+    return true;
+  }
+
+  virtual void FilterDelete() {
+    assert(filter_partition_ < num_partitions_);
+    partitions_[filter_partition_]->FilterDelete();
+  }
+
+  virtual void FilterEnd() {
+    if (filter_partition_ < num_partitions_)
+      partitions_[filter_partition_]->FilterEnd();
+    filter_partition_ = 0;
+  }
+
+  unsigned num_partitions() const { return num_partitions_; }
+  unsigned cache_size() const { return cache_size_; }
+
+ protected:
+  Counters counters_;
+
+ private:
+  LruCache<Key, Value> *GetPartition(const Key &key) {
+    return partitions_[hasher_(key) % num_partitions_];
+  }
+
+  uint32_t (*hasher_)(const Key &key);
+  unsigned num_partitions_;
+  unsigned cache_size_;
+  LruCache<Key, Value> **partitions_;
+  unsigned filter_partition_;
+};  // class PartitionedLruCache
+
 }  // namespace lru
 
 #endif  // CVMFS_LRU_H_
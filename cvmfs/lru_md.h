@@ -1,7 +1,9 @@
 /**
  * This file is part of the CernVM File System.
  *
- * Provides the LRU sub classes used for the file system client meta-data cache
+ * Provides the LRU sub classes used for the file system client meta-data cache.
+ * The caches are partitioned so that the FUSE threads do not serialize on a
+ * single cache lock.
  */
 
 #ifndef CVMFS_LRU_MD_H_
@@ -38,11 +40,12 @@ static inline uint32_t hasher_inode(const fuse_ino_t &inode) {
 // uint32_t hasher_inode(const fuse_ino_t &inode);
 
 
-class InodeCache : public LruCache<fuse_ino_t, catalog::DirectoryEntry>
+class InodeCache :
+  public PartitionedLruCache<fuse_ino_t, catalog::DirectoryEntry>
 {
  public:
   explicit InodeCache(unsigned int cache_size, perf::Statistics *statistics) :
-    LruCache<fuse_ino_t, catalog::DirectoryEntry>(
+    PartitionedLruCache<fuse_ino_t, catalog::DirectoryEntry>(
       cache_size, fuse_ino_t(-1), hasher_inode,
       perf::StatisticsTemplate("inode_cache", statistics))
   {
@@ -52,7 +55,8 @@ class InodeCache : public LruCache<fuse_ino_t, catalog::DirectoryEntry>
     LogCvmfs(kLogLru, kLogDebug, "insert inode --> dirent: %u -> '%s'",
              inode, dirent.name().c_str());
     const bool result =
-      LruCache<fuse_ino_t, catalog::DirectoryEntry>::Insert(inode, dirent);
+      PartitionedLruCache<fuse_ino_t, catalog::DirectoryEntry>::Insert(
+        inode, dirent);
     return result;
   }
 
@@ -60,7 +64,8 @@ class InodeCache : public LruCache<fuse_ino_t, catalog::DirectoryEntry>
               bool update_lru = true)
   {
     const bool result =
-      LruCache<fuse_ino_t, catalog::DirectoryEntry>::Lookup(inode, dirent);
+      PartitionedLruCache<fuse_ino_t, catalog::DirectoryEntry>::Lookup(
+        inode, dirent);
     LogCvmfs(kLogLru, kLogDebug, "lookup inode --> dirent: %u (%s)",
              inode, result ? "hit" : "miss");
     return result;
@@ -68,15 +73,16 @@ class InodeCache : public LruCache<fuse_ino_t, catalog::DirectoryEntry>
 
   void Drop() {
     LogCvmfs(kLogLru, kLogDebug, "dropping inode cache");
-    LruCache<fuse_ino_t, catalog::DirectoryEntry>::Drop();
+    PartitionedLruCache<fuse_ino_t, catalog::DirectoryEntry>::Drop();
   }
 };  // InodeCache
 
 
-class PathCache : public LruCache<fuse_ino_t, PathString> {
+class PathCache : public PartitionedLruCache<fuse_ino_t, PathString> {
  public:
   explicit PathCache(unsigned int cache_size, perf::Statistics *statistics) :
-    LruCache<fuse_ino_t, PathString>(cache_size, fuse_ino_t(-1), hasher_inode,
+    PartitionedLruCache<fuse_ino_t, PathString>(
+      cache_size, fuse_ino_t(-1), hasher_inode,
       perf::StatisticsTemplate("path_cache", statistics))
   {
   }
@@ -85,7 +91,7 @@ class PathCache : public LruCache<fuse_ino_t, PathString> {
     LogCvmfs(kLogLru, kLogDebug, "insert inode --> path %u -> '%s'",
              inode, path.c_str());
     const bool result =
-      LruCache<fuse_ino_t, PathString>::Insert(inode, path);
+      PartitionedLruCache<fuse_ino_t, PathString>::Insert(inode, path);
     return result;
   }
 
@@ -93,7 +99,7 @@ class PathCache : public LruCache<fuse_ino_t, PathString> {
               bool update_lru = true)
   {
     const bool found =
-      LruCache<fuse_ino_t, PathString>::Lookup(inode, path);
+      PartitionedLruCache<fuse_ino_t, PathString>::Lookup(inode, path);
     LogCvmfs(kLogLru, kLogDebug, "lookup inode --> path: %u (%s)",
              inode, found ? "hit" : "miss");
     return found;
@@ -101,17 +107,17 @@ class PathCache : public LruCache<fuse_ino_t, PathString> {
 
   void Drop() {
     LogCvmfs(kLogLru, kLogDebug, "dropping path cache");
-    LruCache<fuse_ino_t, PathString>::Drop();
+    PartitionedLruCache<fuse_ino_t, PathString>::Drop();
   }
 };  // PathCache
 
 
 class Md5PathCache :
-  public LruCache<shash::Md5, catalog::DirectoryEntry>
+  public PartitionedLruCache<shash::Md5, catalog::DirectoryEntry>
 {
  public:
   explicit Md5PathCache(unsigned int cache_size, perf::Statistics *statistics) :
-    LruCache<shash::Md5, catalog::DirectoryEntry>(
+    PartitionedLruCache<shash::Md5, catalog::DirectoryEntry>(
       cache_size, shash::Md5(shash::AsciiPtr("!")), hasher_md5,
       perf::StatisticsTemplate("md5_path_cache", statistics))
   {
@@ -122,7 +128,8 @@ class Md5PathCache :
     LogCvmfs(kLogLru, kLogDebug, "insert md5 --> dirent: %s -> '%s'",
              hash.ToString().c_str(), dirent.name().c_str());
     const bool result =
-      LruCache<shash::Md5, catalog::DirectoryEntry>::Insert(hash, dirent);
+      PartitionedLruCache<shash::Md5, catalog::DirectoryEntry>::Insert(
+        hash, dirent);
     return result;
   }
 
@@ -137,7 +144,8 @@ class Md5PathCache :
               bool update_lru = true)
   {
     const bool result =
-      LruCache<shash::Md5, catalog::DirectoryEntry>::Lookup(hash, dirent);
+      PartitionedLruCache<shash::Md5, catalog::DirectoryEntry>::Lookup(
+        hash, dirent);
     LogCvmfs(kLogLru, kLogDebug, "lookup md5 --> dirent: %s (%s)",
              hash.ToString().c_str(), result ? "hit" : "miss");
     return result;
@@ -146,12 +154,13 @@ class Md5PathCache :
   bool Forget(const shash::Md5 &hash) {
     LogCvmfs(kLogLru, kLogDebug, "forget md5: %s",
              hash.ToString().c_str());
-    return LruCache<shash::Md5, catalog::DirectoryEntry>::Forget(hash);
+    return PartitionedLruCache<shash::Md5, catalog::DirectoryEntry>::Forget(
+      hash);
   }
 
   void Drop() {
     LogCvmfs(kLogLru, kLogDebug, "dropping md5path cache");
-    LruCache<shash::Md5, catalog::DirectoryEntry>::Drop();
+    PartitionedLruCache<shash::Md5, catalog::DirectoryEntry>::Drop();
   }
 
  private:
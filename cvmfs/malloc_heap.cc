@@ -5,6 +5,12 @@
 #include "cvmfs_config.h"
 #include "malloc_heap.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
 #include <cassert>
 #include <cstring>
 #include <new>
@@ -103,6 +109,31 @@ void MallocHeap::MarkFree(void *block) {
 }
 
 
+bool MallocHeap::BindToNode(unsigned node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // MPOL_PREFERRED from <numaif.h>, which is part of libnuma
+  const int kMpolPreferred = 1;
+  const unsigned kMaxNode = 8 * sizeof(unsigned long);  // NOLINT
+  if (node >= kMaxNode)
+    return false;
+  unsigned long nodemask = 1UL << node;  // NOLINT
+  return syscall(SYS_mbind, heap_, capacity_, kMpolPreferred, &nodemask,
+                 kMaxNode, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+
+bool MallocHeap::AdviseHugePages() {
+#ifdef MADV_HUGEPAGE
+  return madvise(heap_, capacity_, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+
 uint64_t MallocHeap::GetSize(void *block) {
   Tag *tag = reinterpret_cast<Tag *>(block) - 1;
   assert(tag->size > 0);
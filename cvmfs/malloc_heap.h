@@ -66,6 +66,15 @@ class MallocHeap {
   }
   bool HasSpaceFor(uint64_t nbytes);
 
+  /**
+   * Memory placement hints, to be given before the heap is used.  Pages of the
+   * heap are only faulted in when blocks are allocated, so the hints apply to
+   * all of the heap.  Both return false if the hint cannot be applied, in which
+   * case the heap works as before.
+   */
+  bool BindToNode(unsigned node);
+  bool AdviseHugePages();
+
  private:
   /**
    * Minimum number of bytes of the heap.
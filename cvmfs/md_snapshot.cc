@@ -0,0 +1,459 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "md_snapshot.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "catalog.h"
+#include "catalog_mgr_client.h"
+#include "lru_md.h"
+#include "util/exception.h"
+#include "util/logging.h"
+#include "util/mmap_file.h"
+#include "util/mutex.h"
+#include "util/posix.h"
+
+using namespace std;  // NOLINT
+
+namespace catalog {
+
+const char MetadataSnapshot::kMagic[8] =
+  {'C', 'V', 'M', 'F', 'S', 'M', 'D', 'S'};
+
+namespace {
+
+/**
+ * Sorts the attached catalogs by their first inode for the binary search
+ */
+bool CompareFirstInode(const MetadataSnapshot::CatalogInodes &a,
+                       const MetadataSnapshot::CatalogInodes &b)
+{
+  return a.first_inode < b.first_inode;
+}
+
+}  // anonymous namespace
+
+
+MetadataSnapshot::MetadataSnapshot(
+  const string &path,
+  const unsigned interval_sec,
+  lru::Md5PathCache *md5path_cache,
+  perf::StatisticsTemplate statistics)
+  : path_(path)
+  , interval_sec_(interval_sec)
+  , md5path_cache_(md5path_cache)
+  , catalog_mgr_(NULL)
+  , mmap_(NULL)
+  , catalogs_(NULL)
+  , entries_(NULL)
+  , strings_(NULL)
+  , num_pending_(0)
+  , counters_(statistics)
+{
+  pipe_terminate_[0] = pipe_terminate_[1] = -1;
+  int retval = pthread_mutex_init(&lock_, NULL);
+  assert(retval == 0);
+}
+
+
+MetadataSnapshot::~MetadataSnapshot() {
+  if (pipe_terminate_[1] >= 0) {
+    char t = 'T';
+    WritePipe(pipe_terminate_[1], &t, 1);
+    pthread_join(thread_writer_, NULL);
+    ClosePipe(pipe_terminate_);
+  }
+  Unmap();
+  pthread_mutex_destroy(&lock_);
+}
+
+
+void MetadataSnapshot::Spawn(ClientCatalogManager *catalog_mgr) {
+  assert(pipe_terminate_[0] == -1);
+  catalog_mgr_ = catalog_mgr;
+  MakePipe(pipe_terminate_);
+  int retval = pthread_create(&thread_writer_, NULL, MainWriter, this);
+  if (retval != 0)
+    PANIC(kLogStderr, "failed to create metadata snapshot thread (%d)", retval);
+}
+
+
+void *MetadataSnapshot::MainWriter(void *data) {
+  MetadataSnapshot *snapshot = static_cast<MetadataSnapshot *>(data);
+  LogCvmfs(kLogCvmfs, kLogDebug, "starting metadata snapshot writer (%us)",
+           snapshot->interval_sec_);
+
+  struct pollfd watch_term;
+  watch_term.fd = snapshot->pipe_terminate_[0];
+  watch_term.events = POLLIN | POLLPRI;
+  const int timeout_ms = snapshot->interval_sec_ * 1000;
+  bool terminate = false;
+  while (!terminate) {
+    watch_term.revents = 0;
+    int retval = poll(&watch_term, 1, timeout_ms);
+    if (retval < 0) {
+      if (errno == EINTR)
+        continue;
+      PANIC(kLogSyslogErr | kLogDebug,
+            "Error: metadata snapshot writer failure (%d)", errno);
+    }
+    if (retval > 0) {
+      char c;
+      ReadPipe(snapshot->pipe_terminate_[0], &c, 1);
+      assert(c == 'T');
+      terminate = true;
+    }
+
+    vector<CatalogInodes> catalogs;
+    snapshot->catalog_mgr_->ListCatalogInodes(&catalogs);
+    snapshot->Write(catalogs);
+  }
+
+  LogCvmfs(kLogCvmfs, kLogDebug, "stopping metadata snapshot writer");
+  return NULL;
+}
+
+
+bool MetadataSnapshot::Load() {
+  MutexLockGuard guard(&lock_);
+  assert(mmap_ == NULL);
+  if (!FileExists(path_))
+    return false;
+
+  mmap_ = new MemoryMappedFile(path_);
+  if (!mmap_->Map() || !Validate()) {
+    LogCvmfs(kLogCvmfs, kLogDebug | kLogSyslogWarn,
+             "ignoring invalid metadata snapshot %s", path_.c_str());
+    delete mmap_;
+    mmap_ = NULL;
+    return false;
+  }
+
+  const Header *header = reinterpret_cast<const Header *>(mmap_->buffer());
+  num_pending_ = header->num_catalogs;
+  restored_.assign(header->num_catalogs, false);
+  LogCvmfs(kLogCvmfs, kLogDebug,
+           "loaded metadata snapshot %s (%u catalogs, %" PRIu64 " entries)",
+           path_.c_str(), header->num_catalogs, header->num_entries);
+  if (num_pending_ == 0)
+    Unmap();
+  return true;
+}
+
+
+/**
+ * Checks that the tables and the string references stay within the file.
+ * Must be called with lock_ held.
+ */
+bool MetadataSnapshot::Validate() {
+  const size_t size = mmap_->size();
+  if (size < sizeof(Header))
+    return false;
+  const Header *header = reinterpret_cast<const Header *>(mmap_->buffer());
+  if ((memcmp(header->magic, kMagic, sizeof(kMagic)) != 0) ||
+      (header->version != kVersion))
+  {
+    return false;
+  }
+  // Prevent overflows in the size calculation
+  if ((header->num_catalogs > size) || (header->num_entries > size) ||
+      (header->size_strings > size))
+  {
+    return false;
+  }
+  if (sizeof(Header) + header->num_catalogs * sizeof(CatalogRecord) +
+      header->num_entries * sizeof(EntryRecord) + header->size_strings != size)
+  {
+    return false;
+  }
+
+  catalogs_ = reinterpret_cast<const CatalogRecord *>(
+    mmap_->buffer() + sizeof(Header));
+  entries_ = reinterpret_cast<const EntryRecord *>(
+    catalogs_ + header->num_catalogs);
+  strings_ = reinterpret_cast<const char *>(entries_ + header->num_entries);
+
+  for (unsigned i = 0; i < header->num_catalogs; ++i) {
+    if ((catalogs_[i].first_entry > header->num_entries) ||
+        (catalogs_[i].num_entries >
+         header->num_entries - catalogs_[i].first_entry))
+    {
+      return false;
+    }
+  }
+  for (uint64_t i = 0; i < header->num_entries; ++i) {
+    const uint64_t length = static_cast<uint64_t>(entries_[i].name_length) +
+                            entries_[i].symlink_length;
+    if ((entries_[i].name_offset > header->size_strings) ||
+        (length > header->size_strings - entries_[i].name_offset))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/**
+ * Must be called with lock_ held or from the destructor.
+ */
+void MetadataSnapshot::Unmap() {
+  delete mmap_;
+  mmap_ = NULL;
+  catalogs_ = NULL;
+  entries_ = NULL;
+  strings_ = NULL;
+  num_pending_ = 0;
+  restored_.clear();
+}
+
+
+unsigned MetadataSnapshot::Restore(
+  const shash::Any &catalog_hash,
+  const inode_t first_inode,
+  const uint64_t num_inodes)
+{
+  MutexLockGuard guard(&lock_);
+  if (mmap_ == NULL)
+    return 0;
+
+  const Header *header = reinterpret_cast<const Header *>(mmap_->buffer());
+  unsigned result = 0;
+  for (unsigned i = 0; i < header->num_catalogs; ++i) {
+    if (restored_[i])
+      continue;
+    const CatalogRecord &catalog = catalogs_[i];
+    if ((catalog.algorithm != catalog_hash.algorithm) ||
+        (catalog.suffix != catalog_hash.suffix) ||
+        (memcmp(catalog.digest, catalog_hash.digest,
+                catalog_hash.GetDigestSize()) != 0))
+    {
+      continue;
+    }
+
+    for (uint64_t j = 0; j < catalog.num_entries; ++j) {
+      const EntryRecord &record = entries_[catalog.first_entry + j];
+      DirectoryEntry dirent;
+      if ((record.row_id >= num_inodes) ||
+          !DecodeEntry(record, first_inode + record.row_id, &dirent))
+      {
+        continue;
+      }
+      shash::Md5 md5path;
+      memcpy(md5path.digest, record.md5path, sizeof(record.md5path));
+      md5path_cache_->Insert(md5path, dirent);
+      result++;
+    }
+    restored_[i] = true;
+    num_pending_--;
+    break;
+  }
+  perf::Xadd(counters_.n_restored, result);
+  if (result > 0) {
+    LogCvmfs(kLogCvmfs, kLogDebug, "restored %u entries of catalog %s",
+             result, catalog_hash.ToString().c_str());
+  }
+  if (num_pending_ == 0)
+    Unmap();
+  return result;
+}
+
+
+void MetadataSnapshot::OnMount(const Catalog *catalog) {
+  if (catalog->inode_range().IsDummy())
+    return;
+  Restore(catalog->hash(), catalog->GetMangledInode(0, 0),
+          catalog->inode_range().size);
+}
+
+
+bool MetadataSnapshot::DecodeEntry(
+  const EntryRecord &record,
+  const inode_t inode,
+  DirectoryEntry *dirent)
+{
+  if ((record.checksum_algorithm > shash::kAny) ||
+      (record.compression > zlib::kLz4))
+  {
+    return false;
+  }
+  dirent->inode_ = inode;
+  dirent->name_.Assign(strings_ + record.name_offset, record.name_length);
+  dirent->symlink_.Assign(strings_ + record.name_offset + record.name_length,
+                          record.symlink_length);
+  dirent->mode_ = record.mode;
+  dirent->uid_ = record.uid;
+  dirent->gid_ = record.gid;
+  dirent->size_ = record.size;
+  dirent->mtime_ = record.mtime;
+  dirent->linkcount_ = record.linkcount;
+  dirent->has_xattrs_ = record.flags & kFlagXattrs;
+  dirent->is_external_file_ = record.flags & kFlagExternal;
+  dirent->is_direct_io_ = record.flags & kFlagDirectIo;
+  dirent->compression_algorithm_ =
+    static_cast<zlib::Algorithms>(record.compression);
+  dirent->checksum_ = shash::Any(
+    static_cast<shash::Algorithms>(record.checksum_algorithm),
+    static_cast<shash::Suffix>(record.checksum_suffix));
+  memcpy(dirent->checksum_.digest, record.checksum,
+         sizeof(dirent->checksum_.digest));
+  dirent->is_nested_catalog_root_ = record.flags & kFlagNestedRoot;
+  dirent->is_nested_catalog_mountpoint_ =
+    record.flags & kFlagNestedMountpoint;
+  dirent->is_bind_mountpoint_ = record.flags & kFlagBindMountpoint;
+  dirent->is_chunked_file_ = record.flags & kFlagChunked;
+  dirent->is_hidden_ = record.flags & kFlagHidden;
+  return true;
+}
+
+
+void MetadataSnapshot::EncodeEntry(
+  const shash::Md5 &md5path,
+  const DirectoryEntry &dirent,
+  const uint64_t row_id,
+  string *strings,
+  EntryRecord *record)
+{
+  memset(record, 0, sizeof(*record));
+  memcpy(record->md5path, md5path.digest, sizeof(record->md5path));
+  record->row_id = row_id;
+  record->size = dirent.size_;
+  record->mtime = dirent.mtime_;
+  record->mode = dirent.mode_;
+  record->uid = dirent.uid_;
+  record->gid = dirent.gid_;
+  record->linkcount = dirent.linkcount_;
+  record->flags =
+    (dirent.has_xattrs_ ? kFlagXattrs : 0) |
+    (dirent.is_external_file_ ? kFlagExternal : 0) |
+    (dirent.is_direct_io_ ? kFlagDirectIo : 0) |
+    (dirent.is_nested_catalog_root_ ? kFlagNestedRoot : 0) |
+    (dirent.is_nested_catalog_mountpoint_ ? kFlagNestedMountpoint : 0) |
+    (dirent.is_bind_mountpoint_ ? kFlagBindMountpoint : 0) |
+    (dirent.is_chunked_file_ ? kFlagChunked : 0) |
+    (dirent.is_hidden_ ? kFlagHidden : 0);
+  record->name_offset = strings->size();
+  record->name_length = dirent.name_.GetLength();
+  record->symlink_length = dirent.symlink_.GetLength();
+  strings->append(dirent.name_.GetChars(), dirent.name_.GetLength());
+  strings->append(dirent.symlink_.GetChars(), dirent.symlink_.GetLength());
+  record->compression = dirent.compression_algorithm_;
+  record->checksum_algorithm = dirent.checksum_.algorithm;
+  record->checksum_suffix = dirent.checksum_.suffix;
+  memcpy(record->checksum, dirent.checksum_.digest, sizeof(record->checksum));
+}
+
+
+bool MetadataSnapshot::Write(const vector<CatalogInodes> &catalogs) {
+  vector<CatalogInodes> sorted(catalogs);
+  sort(sorted.begin(), sorted.end(), CompareFirstInode);
+
+  // Collect the entries per catalog.  The cache partitions are only locked
+  // while the entries are copied.
+  vector<pair<shash::Md5, DirectoryEntry> > cached;
+  md5path_cache_->FilterBegin();
+  while (md5path_cache_->FilterNext()) {
+    shash::Md5 md5path;
+    DirectoryEntry dirent;
+    md5path_cache_->FilterGet(&md5path, &dirent);
+    cached.push_back(make_pair(md5path, dirent));
+  }
+  md5path_cache_->FilterEnd();
+
+  vector<vector<unsigned> > groups(sorted.size());
+  unsigned num_skipped = 0;
+  for (unsigned i = 0; i < cached.size(); ++i) {
+    const DirectoryEntry &dirent = cached[i].second;
+    if (dirent.IsNegative() || (dirent.hardlink_group() > 0)) {
+      num_skipped++;
+      continue;
+    }
+    const inode_t inode = dirent.inode();
+    vector<CatalogInodes>::const_iterator iter = upper_bound(
+      sorted.begin(), sorted.end(), CatalogInodes(shash::Any(), inode, 0),
+      CompareFirstInode);
+    if ((iter == sorted.begin()) ||
+        (inode - (iter - 1)->first_inode >= (iter - 1)->num_inodes))
+    {
+      // Entry from an earlier catalog generation
+      num_skipped++;
+      continue;
+    }
+    groups[iter - 1 - sorted.begin()].push_back(i);
+  }
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  vector<CatalogRecord> catalog_records;
+  vector<EntryRecord> entry_records;
+  string strings;
+  for (unsigned i = 0; i < sorted.size(); ++i) {
+    if (groups[i].empty())
+      continue;
+    CatalogRecord catalog;
+    memset(&catalog, 0, sizeof(catalog));
+    memcpy(catalog.digest, sorted[i].hash.digest, sizeof(catalog.digest));
+    catalog.algorithm = sorted[i].hash.algorithm;
+    catalog.suffix = sorted[i].hash.suffix;
+    catalog.first_entry = entry_records.size();
+    catalog.num_entries = groups[i].size();
+    catalog_records.push_back(catalog);
+    for (unsigned j = 0; j < groups[i].size(); ++j) {
+      const pair<shash::Md5, DirectoryEntry> &entry = cached[groups[i][j]];
+      EntryRecord record;
+      EncodeEntry(entry.first, entry.second,
+                  entry.second.inode() - sorted[i].first_inode,
+                  &strings, &record);
+      entry_records.push_back(record);
+    }
+  }
+  header.num_catalogs = catalog_records.size();
+  header.num_entries = entry_records.size();
+  header.size_strings = strings.size();
+
+  string buffer(reinterpret_cast<const char *>(&header), sizeof(header));
+  if (!catalog_records.empty()) {
+    buffer.append(reinterpret_cast<const char *>(&catalog_records[0]),
+                  catalog_records.size() * sizeof(CatalogRecord));
+  }
+  if (!entry_records.empty()) {
+    buffer.append(reinterpret_cast<const char *>(&entry_records[0]),
+                  entry_records.size() * sizeof(EntryRecord));
+  }
+  buffer.append(strings);
+
+  // Replace the snapshot atomically
+  const string tmp_path = path_ + ".tmp";
+  if (!SafeWriteToFile(buffer, tmp_path, 0600) ||
+      (rename(tmp_path.c_str(), path_.c_str()) != 0))
+  {
+    LogCvmfs(kLogCvmfs, kLogDebug, "failed to write metadata snapshot %s (%d)",
+             path_.c_str(), errno);
+    unlink(tmp_path.c_str());
+    return false;
+  }
+
+  perf::Xadd(counters_.n_written, entry_records.size());
+  perf::Xadd(counters_.n_skipped, num_skipped);
+  perf::Inc(counters_.n_writes);
+  LogCvmfs(kLogCvmfs, kLogDebug,
+           "wrote metadata snapshot %s (%u catalogs, %u entries)",
+           path_.c_str(), header.num_catalogs,
+           static_cast<unsigned>(header.num_entries));
+  return true;
+}
+
+}  // namespace catalog
@@ -0,0 +1,214 @@
+/**
+ * This file is part of the CernVM File System.
+ *
+ * Warm start of the meta-data caches.  On a freshly booted node, every lookup
+ * first goes to the catalogs until the Md5PathCache is populated again.  The
+ * MetadataSnapshot periodically writes the positive entries of the
+ * Md5PathCache into a file in the cache directory and loads it on the next
+ * mount.  Entries are grouped by the catalog they stem from.  When a catalog
+ * with the same content hash is attached, its group is inserted into the
+ * Md5PathCache, so that outdated entries are never used.
+ *
+ * Inodes are assigned at runtime and depend on the order in which catalogs are
+ * attached.  Therefore, entries are stored with their row id in the catalog
+ * and get their inode from the catalog's current inode range on restore.  For
+ * the same reason, the inode-keyed InodeCache and PathCache are not persisted;
+ * the kernel does not know any inode after a reboot and it learns about them
+ * only through lookups by path.
+ *
+ * The snapshot file has a fixed-size header, followed by the catalog table,
+ * the entry table, and the string area with names and symlinks.  The tables
+ * consist of fixed-size records, so that the file can be used from its memory
+ * mapping without parsing.
+ */
+
+#ifndef CVMFS_MD_SNAPSHOT_H_
+#define CVMFS_MD_SNAPSHOT_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "crypto/hash.h"
+#include "directory_entry.h"
+#include "statistics.h"
+#include "util/single_copy.h"
+
+class MemoryMappedFile;
+namespace lru {
+class Md5PathCache;
+}
+
+namespace catalog {
+
+class Catalog;
+class ClientCatalogManager;
+
+struct MetadataSnapshotCounters {
+  perf::Counter *n_restored;
+  perf::Counter *n_written;
+  perf::Counter *n_skipped;
+  perf::Counter *n_writes;
+
+  explicit MetadataSnapshotCounters(perf::StatisticsTemplate statistics) {
+    n_restored = statistics.RegisterTemplated("n_restored",
+        "Number of md5path cache entries restored from the snapshot");
+    n_written = statistics.RegisterTemplated("n_written",
+        "Number of md5path cache entries written to the snapshot");
+    n_skipped = statistics.RegisterTemplated("n_skipped",
+        "Number of md5path cache entries not suitable for the snapshot");
+    n_writes = statistics.RegisterTemplated("n_writes",
+        "Number of snapshots written");
+  }
+};  // MetadataSnapshotCounters
+
+
+class MetadataSnapshot : SingleCopy {
+  friend class T_MetadataSnapshot;
+
+ public:
+  static const unsigned kVersion = 1;
+  static const unsigned kDefaultIntervalSec = 300;
+
+  /**
+   * The first inode and the number of inodes of an attached catalog
+   */
+  struct CatalogInodes {
+    CatalogInodes() : first_inode(0), num_inodes(0) { }
+    CatalogInodes(const shash::Any &h, inode_t f, uint64_t n)
+      : hash(h), first_inode(f), num_inodes(n) { }
+    shash::Any hash;
+    inode_t first_inode;
+    uint64_t num_inodes;
+  };
+
+  MetadataSnapshot(const std::string &path,
+                   const unsigned interval_sec,
+                   lru::Md5PathCache *md5path_cache,
+                   perf::StatisticsTemplate statistics);
+  ~MetadataSnapshot();
+
+  /**
+   * Maps the snapshot file, if there is a valid one.
+   */
+  bool Load();
+  /**
+   * Writes a new snapshot every interval_sec seconds and, finally, when the
+   * object is destructed.
+   */
+  void Spawn(ClientCatalogManager *catalog_mgr);
+
+  /**
+   * Inserts the entries of the catalog with the given hash into the md5path
+   * cache, with inodes in [first_inode, first_inode + num_inodes).  Every
+   * group is restored at most once.  Returns the number of restored entries.
+   */
+  unsigned Restore(const shash::Any &catalog_hash,
+                   const inode_t first_inode,
+                   const uint64_t num_inodes);
+  /**
+   * Called by the catalog manager with the write lock held after a catalog
+   * has been attached.
+   */
+  void OnMount(const Catalog *catalog);
+  /**
+   * Assigns the md5path cache entries to the given catalogs by their inode and
+   * writes the snapshot file.  Entries that do not belong to any of the
+   * catalogs, negative entries, and hard links are skipped.
+   */
+  bool Write(const std::vector<CatalogInodes> &catalogs);
+
+  std::string path() const { return path_; }
+
+ private:
+  static const char kMagic[8];
+  /**
+   * Entry flags
+   */
+  static const uint32_t kFlagXattrs = 0x01;
+  static const uint32_t kFlagExternal = 0x02;
+  static const uint32_t kFlagDirectIo = 0x04;
+  static const uint32_t kFlagNestedRoot = 0x08;
+  static const uint32_t kFlagNestedMountpoint = 0x10;
+  static const uint32_t kFlagBindMountpoint = 0x20;
+  static const uint32_t kFlagChunked = 0x40;
+  static const uint32_t kFlagHidden = 0x80;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_catalogs;
+    uint64_t num_entries;
+    uint64_t size_strings;
+  };
+
+  struct CatalogRecord {
+    unsigned char digest[shash::kMaxDigestSize];
+    uint8_t algorithm;
+    char suffix;
+    uint16_t reserved;
+    uint32_t num_entries;
+    uint64_t first_entry;
+  };
+
+  struct EntryRecord {
+    unsigned char md5path[16];
+    uint64_t row_id;
+    uint64_t size;
+    int64_t mtime;
+    uint32_t mode;
+    uint32_t uid;
+    uint32_t gid;
+    uint32_t linkcount;
+    uint32_t flags;
+    uint32_t name_length;
+    uint64_t name_offset;
+    uint32_t symlink_length;
+    uint8_t compression;
+    uint8_t checksum_algorithm;
+    char checksum_suffix;
+    uint8_t reserved;
+    unsigned char checksum[shash::kMaxDigestSize];
+  };
+
+  static void *MainWriter(void *data);
+  static void EncodeEntry(const shash::Md5 &md5path,
+                          const DirectoryEntry &dirent,
+                          const uint64_t row_id,
+                          std::string *strings,
+                          EntryRecord *record);
+  bool DecodeEntry(const EntryRecord &record, const inode_t inode,
+                   DirectoryEntry *dirent);
+  bool Validate();
+  void Unmap();
+
+  std::string path_;
+  unsigned interval_sec_;
+  lru::Md5PathCache *md5path_cache_;
+  ClientCatalogManager *catalog_mgr_;
+
+  /**
+   * Valid snapshot file or NULL
+   */
+  MemoryMappedFile *mmap_;
+  const CatalogRecord *catalogs_;
+  const EntryRecord *entries_;
+  const char *strings_;
+  /**
+   * The number of catalog groups that have not yet been restored
+   */
+  unsigned num_pending_;
+  std::vector<bool> restored_;
+  pthread_mutex_t lock_;
+
+  int pipe_terminate_[2];
+  pthread_t thread_writer_;
+
+  MetadataSnapshotCounters counters_;
+};
+
+}  // namespace catalog
+
+#endif  // CVMFS_MD_SNAPSHOT_H_
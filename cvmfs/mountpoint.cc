@@ -38,6 +38,8 @@
 #include "cache_tiered.h"
 #include "catalog.h"
 #include "catalog_mgr_client.h"
+#include "catalog_prefetch.h"
+#include "chunk_prefetch.h"
 #include "clientctx.h"
 #include "crypto/signature.h"
 #include "duplex_sqlite3.h"
@@ -51,6 +53,7 @@
 #include "lru_md.h"
 #include "manifest.h"
 #include "manifest_fetch.h"
+#include "md_snapshot.h"
 #include "network/download.h"
 #include "nfs_maps.h"
 #ifdef CVMFS_NFS_SUPPORT
@@ -148,6 +151,14 @@ bool FileSystem::CheckPosixCacheSettings(
     }
   }
 
+  QuotaPolicy::Type quota_policy;
+  if (!QuotaPolicy::ParseType(settings.quota_policy, &quota_policy)) {
+    boot_error_ = "Failure: unknown cache replacement policy '" +
+                  settings.quota_policy + "' (use 'lru' or 'slru')";
+    boot_status_ = loader::kFailOptions;
+    return false;
+  }
+
   if (settings.cache_base_defined && settings.cache_dir_defined) {
     boot_error_ =
       "'CVMFS_CACHE_BASE' and 'CVMFS_CACHE_DIR' are mutually exclusive";
@@ -218,33 +229,36 @@ void FileSystem::CreateStatistics() {
   statistics_->Register("linkstring.n_instances", "Number of instances");
   statistics_->Register("linkstring.n_overflows", "Number of overflows");
 
-  // Callback counters
-  n_fs_open_ = statistics_->Register("cvmfs.n_fs_open",
-                                     "Overall number of file open operations");
-  n_fs_dir_open_ = statistics_->Register("cvmfs.n_fs_dir_open",
-                   "Overall number of directory open operations");
-  n_fs_lookup_ = statistics_->Register("cvmfs.n_fs_lookup",
-                                       "Number of lookups");
-  n_fs_lookup_negative_ = statistics_->Register("cvmfs.n_fs_lookup_negative",
-                                                "Number of negative lookups");
-  n_fs_stat_ = statistics_->Register("cvmfs.n_fs_stat", "Number of stats");
+  // Callback counters, the ones on the hot path are sharded
+  n_fs_open_ = statistics_->RegisterSharded("cvmfs.n_fs_open",
+    "Overall number of file open operations");
+  n_fs_dir_open_ = statistics_->RegisterSharded("cvmfs.n_fs_dir_open",
+    "Overall number of directory open operations");
+  n_fs_lookup_ = statistics_->RegisterSharded("cvmfs.n_fs_lookup",
+                                              "Number of lookups");
+  n_fs_lookup_negative_ = statistics_->RegisterSharded(
+    "cvmfs.n_fs_lookup_negative", "Number of negative lookups");
+  n_fs_stat_ = statistics_->RegisterSharded("cvmfs.n_fs_stat",
+                                            "Number of stats");
   n_fs_stat_stale_ = statistics_->Register("cvmfs.n_fs_stat_stale",
     "Number of stats for stale (open, meanwhile changed) regular files");
-  n_fs_statfs_ = statistics_->Register("cvmfs.n_fs_statfs",
-                                       "Overall number of statsfs calls");
+  n_fs_statfs_ = statistics_->RegisterSharded("cvmfs.n_fs_statfs",
+    "Overall number of statsfs calls");
   n_fs_statfs_cached_ = statistics_->Register("cvmfs.n_fs_statfs_cached",
                 "Number of statsfs calls that accessed the cached statfs info");
-  n_fs_read_ = statistics_->Register("cvmfs.n_fs_read", "Number of files read");
-  n_fs_readlink_ = statistics_->Register("cvmfs.n_fs_readlink",
-                                         "Number of links read");
-  n_fs_forget_ = statistics_->Register("cvmfs.n_fs_forget",
-                                       "Number of inode forgets");
+  n_fs_read_ = statistics_->RegisterSharded("cvmfs.n_fs_read",
+                                            "Number of files read");
+  n_fs_readlink_ = statistics_->RegisterSharded("cvmfs.n_fs_readlink",
+                                                "Number of links read");
+  n_fs_forget_ = statistics_->RegisterSharded("cvmfs.n_fs_forget",
+                                              "Number of inode forgets");
   n_fs_inode_replace_ = statistics_->Register("cvmfs.n_fs_inode_replace",
     "Number of stale inodes that got replaced by an up-to-date version");
+  // The previous value returned by Xadd() is used, no sharding
   no_open_files_ = statistics_->Register("cvmfs.no_open_files",
                                          "Number of currently opened files");
-  no_open_dirs_ = statistics_->Register("cvmfs.no_open_dirs",
-                  "Number of currently opened directories");
+  no_open_dirs_ = statistics_->RegisterSharded("cvmfs.no_open_dirs",
+    "Number of currently opened directories");
   io_error_info_.SetCounter(statistics_->Register("cvmfs.n_io_error",
                                                   "Number of I/O errors"));
   n_eio_total_ =  statistics_->Register("eio.total",
@@ -303,6 +317,12 @@ FileSystem::PosixCacheSettings FileSystem::DeterminePosixCacheSettings(
   {
     settings.do_refcount = true;
   }
+  if (options_mgr_->GetValue(MkCacheParm("CVMFS_CACHE_IO_URING", instance),
+                             &optarg)
+      && options_mgr_->IsOn(optarg))
+  {
+    settings.use_io_uring = true;
+  }
 
   if (options_mgr_->GetValue(MkCacheParm("CVMFS_CACHE_SHARED", instance),
                              &optarg)
@@ -326,6 +346,11 @@ FileSystem::PosixCacheSettings FileSystem::DeterminePosixCacheSettings(
   }
   if (settings.quota_limit > 0)
     settings.is_managed = true;
+  if (options_mgr_->GetValue(MkCacheParm("CVMFS_CACHE_QUOTA_POLICY", instance),
+                             &optarg))
+  {
+    settings.quota_policy = optarg;
+  }
 
   settings.cache_path = kDefaultCacheBase;
   if (options_mgr_->GetValue(MkCacheParm("CVMFS_CACHE_BASE", instance),
@@ -698,7 +723,8 @@ CacheManager *FileSystem::SetupPosixCacheMgr(const string &instance) {
     settings.is_alien,
     settings.avoid_rename ? PosixCacheManager::kRenameLink
                           : PosixCacheManager::kRenameNormal,
-    settings.do_refcount));
+    settings.do_refcount,
+    settings.use_io_uring));
   if (!cache_mgr.IsValid()) {
     boot_error_ = "Failed to setup posix cache '" + instance + "' in " +
                   settings.cache_path + ": " + strerror(errno);
@@ -752,13 +778,29 @@ CacheManager *FileSystem::SetupRamCacheMgr(const string &instance) {
       return NULL;
     }
   }
+  unsigned num_nodes = 1;
+  if (options_mgr_->GetValue(MkCacheParm("CVMFS_CACHE_NUMA", instance),
+                             &optarg) &&
+      options_mgr_->IsOn(optarg))
+  {
+    num_nodes = platform_numa_nodes();
+  }
+  bool huge_pages = false;
+  if (options_mgr_->GetValue(MkCacheParm("CVMFS_CACHE_HUGEPAGES", instance),
+                             &optarg) &&
+      options_mgr_->IsOn(optarg))
+  {
+    huge_pages = true;
+  }
   sz_cache_bytes = RoundUp8(std::max(static_cast<uint64_t>(40 * 1024 * 1024),
                                      sz_cache_bytes));
   RamCacheManager *cache_mgr = new RamCacheManager(
         sz_cache_bytes,
         nfiles,
         alloc,
-        perf::StatisticsTemplate("cache." + instance, statistics_));
+        perf::StatisticsTemplate("cache." + instance, statistics_),
+        num_nodes,
+        huge_pages);
   if (cache_mgr == NULL) {
     boot_error_ = "failed to create ram cache manager for " + instance;
     boot_status_ = loader::kFailCacheDir;
@@ -992,6 +1034,10 @@ bool FileSystem::SetupPosixQuotaMgr(
 ) {
   assert(settings.quota_limit >= 0);
   int64_t quota_threshold = settings.quota_limit / 2;
+  QuotaPolicy::Type quota_policy;
+  bool retval_policy =
+    QuotaPolicy::ParseType(settings.quota_policy, &quota_policy);
+  assert(retval_policy);
   string cache_workspace = settings.cache_path;
   if (settings.cache_path != settings.workspace) {
     LogCvmfs(kLogQuota, kLogDebug | kLogSyslog,
@@ -1007,7 +1053,8 @@ bool FileSystem::SetupPosixQuotaMgr(
                   cache_workspace,
                   settings.quota_limit,
                   quota_threshold,
-                  foreground_);
+                  foreground_,
+                  quota_policy);
     if (quota_mgr == NULL) {
       boot_error_ = "Failed to initialize shared lru cache";
       boot_status_ = loader::kFailQuota;
@@ -1018,7 +1065,8 @@ bool FileSystem::SetupPosixQuotaMgr(
                   cache_workspace,
                   settings.quota_limit,
                   quota_threshold,
-                  found_previous_crash_);
+                  found_previous_crash_,
+                  quota_policy);
     if (quota_mgr == NULL) {
       boot_error_ = "Failed to initialize lru cache";
       boot_status_ = loader::kFailQuota;
@@ -1564,6 +1612,28 @@ void MountPoint::CreateFetchers() {
     external_download_mgr_,
     backoff_throttle_,
     perf::StatisticsTemplate("fetch-external", statistics_));
+
+  string optarg;
+  unsigned readahead_chunks = 0;
+  if (options_mgr_->GetValue("CVMFS_CHUNK_READAHEAD", &optarg))
+    readahead_chunks = String2Uint64(optarg);
+  if (readahead_chunks > 0) {
+    unsigned num_threads = cvmfs::ChunkPrefetcher::kDefaultNumThreads;
+    if (options_mgr_->GetValue("CVMFS_CHUNK_READAHEAD_THREADS", &optarg))
+      num_threads = String2Uint64(optarg);
+    chunk_prefetcher_ = new cvmfs::ChunkPrefetcher(
+      readahead_chunks, num_threads,
+      perf::StatisticsTemplate("chunk_readahead", statistics_));
+  }
+
+  unsigned catalog_prefetch_budget = 0;
+  if (options_mgr_->GetValue("CVMFS_CATALOG_PREFETCH", &optarg))
+    catalog_prefetch_budget = String2Uint64(optarg);
+  if (catalog_prefetch_budget > 0) {
+    catalog_prefetcher_ = new catalog::CatalogPrefetcher(
+      catalog_prefetch_budget, fqrn_, fetcher_,
+      perf::StatisticsTemplate("catalog_prefetch", statistics_));
+  }
 }
 
 
@@ -1644,6 +1714,23 @@ void MountPoint::CreateStatistics() {
     "overall number of open calls where the file's page cache gets flushed");
   statistics_->Register("page_cache_tracker.n_open_cached",
     "overall number of open calls where the file's page cache is reused");
+
+  statistics_->Register("quota.n_cleanup",
+                        "overall number of cache cleanups");
+  statistics_->Register("quota.n_cleanup_early",
+    "overall number of cache cleanups started at the high watermark");
+  statistics_->Register("quota.n_evict",
+                        "overall number of files evicted from the cache");
+  statistics_->Register("quota.sz_evict",
+                        "overall number of bytes evicted from the cache");
+  statistics_->Register("quota.n_stall",
+                        "overall number of inserts that waited for a cleanup");
+  statistics_->Register("quota.stall_time_ms",
+                        "overall time inserts waited for a cleanup");
+  statistics_->Register("quota.n_unlink",
+                        "overall number of unlinked cache files");
+  statistics_->Register("quota.n_unlink_pending",
+                        "number of evicted cache files not yet unlinked");
 }
 
 
@@ -1679,6 +1766,20 @@ void MountPoint::CreateTables() {
   page_cache_tracker_ = new glue::PageCacheTracker();
   if (file_system_->IsNfsSource())
     page_cache_tracker_->Disable();
+
+  // In NFS mode, inodes are taken from the NFS maps
+  if (options_mgr_->GetValue("CVMFS_METADATA_SNAPSHOT", &optarg) &&
+      options_mgr_->IsOn(optarg) && !file_system_->IsNfsSource())
+  {
+    unsigned interval_sec = catalog::MetadataSnapshot::kDefaultIntervalSec;
+    if (options_mgr_->GetValue("CVMFS_METADATA_SNAPSHOT_INTERVAL", &optarg))
+      interval_sec = std::max(String2Uint64(optarg), uint64_t(1));
+    md_snapshot_ = new catalog::MetadataSnapshot(
+      file_system_->workspace() + "/mdsnapshot." + fqrn_, interval_sec,
+      md5path_cache_, perf::StatisticsTemplate("md_snapshot", statistics_));
+    md_snapshot_->Load();
+    catalog_mgr_->SetMetadataSnapshot(md_snapshot_);
+  }
 }
 
 /**
@@ -1867,6 +1968,8 @@ MountPoint::MountPoint(
   , external_download_mgr_(NULL)
   , fetcher_(NULL)
   , external_fetcher_(NULL)
+  , chunk_prefetcher_(NULL)
+  , catalog_prefetcher_(NULL)
   , inode_annotation_(NULL)
   , catalog_mgr_(NULL)
   , chunk_tables_(NULL)
@@ -1874,6 +1977,7 @@ MountPoint::MountPoint(
   , inode_cache_(NULL)
   , path_cache_(NULL)
   , md5path_cache_(NULL)
+  , md_snapshot_(NULL)
   , tracer_(NULL)
   , inode_tracker_(NULL)
   , dentry_tracker_(NULL)
@@ -1899,6 +2003,8 @@ MountPoint::MountPoint(
 MountPoint::~MountPoint() {
   pthread_mutex_destroy(&lock_max_ttl_);
 
+  // Writes the final snapshot from the caches and the catalogs
+  delete md_snapshot_;
   delete page_cache_tracker_;
   delete dentry_tracker_;
   delete inode_tracker_;
@@ -1909,7 +2015,9 @@ MountPoint::~MountPoint() {
   delete simple_chunk_tables_;
   delete chunk_tables_;
 
+  delete chunk_prefetcher_;
   delete catalog_mgr_;
+  delete catalog_prefetcher_;
   delete inode_annotation_;
   delete external_fetcher_;
   delete fetcher_;
@@ -2220,6 +2328,10 @@ void MountPoint::SetupHttpTuning() {
     download_mgr_->SetProxyGroupResetDelay(String2Uint64(optarg));
   if (options_mgr_->GetValue("CVMFS_HOST_RESET_AFTER", &optarg))
     download_mgr_->SetHostResetDelay(String2Uint64(optarg));
+  if (options_mgr_->GetValue("CVMFS_DOWNLOAD_THREADS", &optarg))
+    download_mgr_->SetNumEventLoops(String2Uint64(optarg));
+  if (options_mgr_->GetValue("CVMFS_DECOMPRESS_THREADS", &optarg))
+    download_mgr_->SetNumDecompressWorkers(String2Uint64(optarg));
 
   if (options_mgr_->GetValue("CVMFS_FOLLOW_REDIRECTS", &optarg) &&
       options_mgr_->IsOn(optarg))
@@ -31,11 +31,14 @@ class AuthzSessionManager;
 class BackoffThrottle;
 class CacheManager;
 namespace catalog {
+class CatalogPrefetcher;
 class ClientCatalogManager;
 class InodeAnnotation;
+class MetadataSnapshot;
 }
 struct ChunkTables;
 namespace cvmfs {
+class ChunkPrefetcher;
 class Fetcher;
 class Uuid;
 }
@@ -264,7 +267,8 @@ class FileSystem : SingleCopy, public BootFactory {
     PosixCacheSettings() :
       is_shared(false), is_alien(false), is_managed(false),
       avoid_rename(false), cache_base_defined(false), cache_dir_defined(false),
-      quota_limit(0), do_refcount(false)
+      quota_limit(0), quota_policy("lru"), do_refcount(false),
+      use_io_uring(false)
       { }
     bool is_shared;
     bool is_alien;
@@ -277,7 +281,15 @@ class FileSystem : SingleCopy, public BootFactory {
      * cache when the limit is exceeded.
      */
     int64_t quota_limit;
+    /**
+     * Name of the cache replacement policy, see QuotaPolicy
+     */
+    std::string quota_policy;
     bool do_refcount;
+    /**
+     * Commit and read-ahead through io_uring if supported by the kernel
+     */
+    bool use_io_uring;
     std::string cache_path;
     /**
      * Different from cache_path only if CVMFS_WORKSPACE or
@@ -499,7 +511,11 @@ class MountPoint : SingleCopy, public BootFactory {
   AuthzSessionManager *authz_session_mgr() { return authz_session_mgr_; }
   BackoffThrottle *backoff_throttle() { return backoff_throttle_; }
   catalog::ClientCatalogManager *catalog_mgr() { return catalog_mgr_; }
+  catalog::CatalogPrefetcher *catalog_prefetcher() {
+    return catalog_prefetcher_;
+  }
   ChunkTables *chunk_tables() { return chunk_tables_; }
+  cvmfs::ChunkPrefetcher *chunk_prefetcher() { return chunk_prefetcher_; }
   download::DownloadManager *download_mgr() { return download_mgr_; }
   download::DownloadManager *external_download_mgr() {
     return external_download_mgr_;
@@ -525,6 +541,7 @@ class MountPoint : SingleCopy, public BootFactory {
   lru::InodeCache *inode_cache() { return inode_cache_; }
   double kcache_timeout_sec() { return kcache_timeout_sec_; }
   lru::Md5PathCache *md5path_cache() { return md5path_cache_; }
+  catalog::MetadataSnapshot *md_snapshot() { return md_snapshot_; }
   std::string membership_req() { return membership_req_; }
   glue::DentryTracker *dentry_tracker() { return dentry_tracker_; }
   glue::PageCacheTracker *page_cache_tracker() { return page_cache_tracker_; }
@@ -641,6 +658,14 @@ class MountPoint : SingleCopy, public BootFactory {
   download::DownloadManager *external_download_mgr_;
   cvmfs::Fetcher *fetcher_;
   cvmfs::Fetcher *external_fetcher_;
+  /**
+   * Read-ahead for chunked files, NULL if disabled
+   */
+  cvmfs::ChunkPrefetcher *chunk_prefetcher_;
+  /**
+   * Prefetch of nested catalogs, NULL if disabled
+   */
+  catalog::CatalogPrefetcher *catalog_prefetcher_;
   catalog::InodeAnnotation *inode_annotation_;
   catalog::ClientCatalogManager *catalog_mgr_;
   ChunkTables *chunk_tables_;
@@ -648,6 +673,10 @@ class MountPoint : SingleCopy, public BootFactory {
   lru::InodeCache *inode_cache_;
   lru::PathCache *path_cache_;
   lru::Md5PathCache *md5path_cache_;
+  /**
+   * Persists the md5path cache for the next mount, NULL if disabled
+   */
+  catalog::MetadataSnapshot *md_snapshot_;
   Tracer *tracer_;
   glue::InodeTracker *inode_tracker_;
   glue::DentryTracker *dentry_tracker_;
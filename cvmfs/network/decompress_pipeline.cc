@@ -0,0 +1,308 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "network/decompress_pipeline.h"
+
+#include <errno.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#include "compression.h"
+#include "network/jobinfo.h"
+#include "network/sink.h"
+#include "util/exception.h"
+#include "util/logging.h"
+#include "util/mutex.h"
+#include "util/platform.h"
+#include "util/smalloc.h"
+#include "util/string.h"
+
+using namespace std;  // NOLINT
+
+namespace download {
+
+DecompressJob::DecompressJob(DecompressPipeline *pipeline)
+  : pipeline_(pipeline)
+  , sink_(NULL)
+  , decompressor_(NULL)
+  , do_hash_(false)
+  , can_pause_(false)
+  , offloaded_(false)
+  , paused_(false)
+  , inline_bytes_(0)
+  , open_chunk_(NULL)
+  , hash_pos_(0)
+  , inflate_pos_(0)
+  , hash_busy_(false)
+  , inflate_busy_(false)
+  , error_code_(kFailOk)
+{
+  int retval = pthread_mutex_init(&lock_, NULL);
+  assert(retval == 0);
+  retval = pthread_cond_init(&cond_progress_, NULL);
+  assert(retval == 0);
+}
+
+
+DecompressJob::~DecompressJob() {
+  // The event loop calls Finish() before it releases the job
+  assert(chunks_.empty() && !hash_busy_ && !inflate_busy_);
+  if (open_chunk_ != NULL) {
+    free(open_chunk_->data);
+    delete open_chunk_;
+  }
+  pthread_cond_destroy(&cond_progress_);
+  pthread_mutex_destroy(&lock_);
+}
+
+
+bool DecompressJob::TakesOver(JobInfo *info, size_t nbytes) {
+  if (offloaded_)
+    return true;
+  if (inline_bytes_ < DecompressPipeline::kThreshold) {
+    inline_bytes_ += nbytes;
+    return false;
+  }
+
+  // The hash context and the decompressor are prepared anew on every retry
+  sink_ = info->sink();
+  decompressor_ = info->compressed() ? info->decompressor() : NULL;
+  do_hash_ = (info->expected_hash() != NULL);
+  hash_context_ = info->hash_context();
+  url_ = *info->url();
+  // curl refuses to pause transfers that do not use the network
+  can_pause_ = !HasPrefix(url_, "file://", true);
+  offloaded_ = true;
+  perf::Inc(pipeline_->counters_.n_jobs);
+  LogCvmfs(kLogDownload, kLogDebug, "offloading decompression of %s",
+           url_.c_str());
+  return true;
+}
+
+
+DecompressJob::PushResult DecompressJob::Push(const void *buf, size_t nbytes) {
+  {
+    MutexLockGuard guard(&lock_);
+    if (error_code_ != kFailOk)
+      return kPushFailed;
+    if (chunks_.size() >= DecompressPipeline::kMaxChunks) {
+      perf::Inc(pipeline_->counters_.n_stalls);
+      if (can_pause_) {
+        paused_ = true;
+        return kPushFull;
+      }
+      while ((chunks_.size() >= DecompressPipeline::kMaxChunks) &&
+             (error_code_ == kFailOk))
+      {
+        pthread_cond_wait(&cond_progress_, &lock_);
+      }
+      if (error_code_ != kFailOk)
+        return kPushFailed;
+    }
+  }
+
+  const unsigned char *pos = static_cast<const unsigned char *>(buf);
+  while (nbytes > 0) {
+    if (open_chunk_ == NULL) {
+      open_chunk_ = new Chunk();
+      open_chunk_->data = static_cast<unsigned char *>(
+        smalloc(DecompressPipeline::kChunkSize));
+    }
+    const size_t n =
+      std::min(nbytes, DecompressPipeline::kChunkSize - open_chunk_->size);
+    memcpy(open_chunk_->data + open_chunk_->size, pos, n);
+    open_chunk_->size += n;
+    pos += n;
+    nbytes -= n;
+    if (open_chunk_->size == DecompressPipeline::kChunkSize) {
+      Enqueue(open_chunk_);
+      open_chunk_ = NULL;
+    }
+  }
+  return kPushOk;
+}
+
+
+void DecompressJob::Enqueue(Chunk *chunk) {
+  MutexLockGuard guard(&lock_);
+  chunks_.push_back(chunk);
+  if (do_hash_ && !hash_busy_) {
+    hash_busy_ = true;
+    pipeline_->Schedule(this, kStageHash);
+  }
+  if (!inflate_busy_) {
+    inflate_busy_ = true;
+    pipeline_->Schedule(this, kStageInflate);
+  }
+}
+
+
+Failures DecompressJob::Finish() {
+  if (!offloaded_) {
+    inline_bytes_ = 0;
+    return kFailOk;
+  }
+
+  const uint64_t start = platform_monotonic_time_ns();
+  if ((open_chunk_ != NULL) && (open_chunk_->size > 0)) {
+    Enqueue(open_chunk_);
+    open_chunk_ = NULL;
+  }
+  Failures result;
+  {
+    MutexLockGuard guard(&lock_);
+    while (hash_busy_ || inflate_busy_)
+      pthread_cond_wait(&cond_progress_, &lock_);
+    assert(chunks_.empty());
+    result = error_code_;
+    error_code_ = kFailOk;
+  }
+  perf::Xadd(pipeline_->counters_.sz_drain_time,
+             (platform_monotonic_time_ns() - start) / 1000);
+
+  offloaded_ = false;
+  paused_ = false;
+  inline_bytes_ = 0;
+  return result;
+}
+
+
+bool DecompressJob::CanResume() {
+  MutexLockGuard guard(&lock_);
+  return (chunks_.size() < DecompressPipeline::kMaxChunks) ||
+         (error_code_ != kFailOk);
+}
+
+
+Failures DecompressJob::error_code() {
+  MutexLockGuard guard(&lock_);
+  return error_code_;
+}
+
+
+/**
+ * Processes the chunks that are queued for the given stage in order until
+ * there are no more.  Only one worker at a time works on a stage of a job.
+ */
+void DecompressJob::ProcessStage(const Stage stage) {
+  unsigned *pos = (stage == kStageHash) ? &hash_pos_ : &inflate_pos_;
+  bool *busy = (stage == kStageHash) ? &hash_busy_ : &inflate_busy_;
+  perf::Counter *timer = (stage == kStageHash)
+                         ? pipeline_->counters_.sz_hash_time
+                         : pipeline_->counters_.sz_inflate_time;
+
+  pthread_mutex_lock(&lock_);
+  while (*pos < chunks_.size()) {
+    Chunk *chunk = chunks_[*pos];
+    // After an error, the remaining chunks are only retired
+    const bool skip = (error_code_ != kFailOk);
+    Failures result = kFailOk;
+    pthread_mutex_unlock(&lock_);
+
+    const uint64_t start = platform_monotonic_time_ns();
+    if (skip) {
+      // Nothing to do
+    } else if (stage == kStageHash) {
+      shash::Update(chunk->data, chunk->size, hash_context_);
+    } else if (decompressor_ != NULL) {
+      zlib::StreamStates retval =
+        decompressor_->Inflate(chunk->data, chunk->size, sink_);
+      if (retval == zlib::kStreamDataError) {
+        LogCvmfs(kLogDownload, kLogSyslogErr, "failed to decompress %s",
+                 url_.c_str());
+        result = kFailBadData;
+      } else if (retval == zlib::kStreamIOError) {
+        LogCvmfs(kLogDownload, kLogSyslogErr,
+                 "decompressing %s, local IO error", url_.c_str());
+        result = kFailLocalIO;
+      }
+    } else {
+      int64_t written = sink_->Write(chunk->data, chunk->size);
+      if ((written < 0) || (static_cast<uint64_t>(written) != chunk->size)) {
+        LogCvmfs(kLogDownload, kLogDebug,
+                 "Failed to perform write of %zu bytes to sink %s with "
+                 "errno %d", chunk->size, sink_->Describe().c_str(), written);
+      }
+    }
+    perf::Xadd(timer, (platform_monotonic_time_ns() - start) / 1000);
+
+    pthread_mutex_lock(&lock_);
+    if ((result != kFailOk) && (error_code_ == kFailOk))
+      error_code_ = result;
+    (*pos)++;
+    Retire();
+  }
+  *busy = false;
+  pthread_cond_broadcast(&cond_progress_);
+  pthread_mutex_unlock(&lock_);
+}
+
+
+/**
+ * Frees the chunks at the front that are done by both stages.  Must be called
+ * with lock_ held.
+ */
+void DecompressJob::Retire() {
+  while (!chunks_.empty() && (inflate_pos_ > 0) &&
+         (!do_hash_ || (hash_pos_ > 0)))
+  {
+    Chunk *chunk = chunks_.front();
+    chunks_.pop_front();
+    free(chunk->data);
+    delete chunk;
+    inflate_pos_--;
+    if (do_hash_)
+      hash_pos_--;
+    pthread_cond_broadcast(&cond_progress_);
+  }
+}
+
+
+//------------------------------------------------------------------------------
+
+
+DecompressPipeline::DecompressPipeline(
+  const unsigned num_workers,
+  perf::StatisticsTemplate statistics)
+  : tasks_(kMaxTasks, 1)
+  , counters_(statistics)
+{
+  assert((num_workers > 0) && (num_workers <= kMaxWorkers));
+  threads_.resize(num_workers);
+  for (unsigned i = 0; i < num_workers; ++i) {
+    int retval = pthread_create(&threads_[i], NULL, MainWorker, this);
+    if (retval != 0)
+      PANIC(kLogStderr, "failed to create decompression worker (%d)", retval);
+  }
+  LogCvmfs(kLogDownload, kLogDebug, "spawned %u decompression workers",
+           num_workers);
+}
+
+
+DecompressPipeline::~DecompressPipeline() {
+  for (unsigned i = 0; i < threads_.size(); ++i)
+    tasks_.Enqueue(Task());
+  for (unsigned i = 0; i < threads_.size(); ++i) {
+    int retval = pthread_join(threads_[i], NULL);
+    assert(retval == 0);
+  }
+}
+
+
+void *DecompressPipeline::MainWorker(void *data) {
+  DecompressPipeline *pipeline = static_cast<DecompressPipeline *>(data);
+  while (true) {
+    Task task = pipeline->tasks_.Dequeue();
+    if (task.job == NULL)
+      break;
+    task.job->ProcessStage(task.stage);
+  }
+  return NULL;
+}
+
+}  // namespace download
@@ -0,0 +1,208 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#ifndef CVMFS_NETWORK_DECOMPRESS_PIPELINE_H_
+#define CVMFS_NETWORK_DECOMPRESS_PIPELINE_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "crypto/hash.h"
+#include "network/network_errors.h"
+#include "statistics.h"
+#include "util/concurrency.h"
+#include "util/single_copy.h"
+
+namespace cvmfs {
+class Sink;
+}
+namespace zlib {
+class Decompressor;
+}
+
+namespace download {
+
+class DecompressPipeline;
+class JobInfo;
+
+/**
+ * The part of a download that is processed by the DecompressPipeline.  A
+ * DecompressJob is attached to a JobInfo for the duration of a Fetch() in an
+ * event loop.  Its public methods are used by the download I/O thread only.
+ */
+class DecompressJob : SingleCopy {
+  friend class DecompressPipeline;
+
+ public:
+  enum PushResult {
+    kPushOk = 0,
+    kPushFull,    ///< Too many chunks in flight, pause the transfer
+    kPushFailed,  ///< A worker failed, error_code() has the reason
+  };
+
+  ~DecompressJob();
+
+  /**
+   * Decides if the data received next goes through the workers.  That is the
+   * case once the transfer has more than DecompressPipeline::kThreshold bytes.
+   * Before, the data is processed inline as before.
+   */
+  bool TakesOver(JobInfo *info, size_t nbytes);
+  /**
+   * Copies the data into the current chunk and hands full chunks to the
+   * workers.  Nothing is copied unless the result is kPushOk.  Transfers that
+   * curl cannot pause (file://) wait for the workers instead of returning
+   * kPushFull.
+   */
+  PushResult Push(const void *buf, size_t nbytes);
+  /**
+   * Waits for the workers to process the remaining data.  Afterwards, the hash
+   * context and the sink are complete and the job is ready for a retry.
+   */
+  Failures Finish();
+
+  /**
+   * Set when Push() returned kPushFull.  The event loop resumes the transfer
+   * once there is space again.
+   */
+  bool IsPaused() const { return paused_; }
+  bool CanResume();
+  void Resume() { paused_ = false; }
+
+  bool offloaded() const { return offloaded_; }
+  Failures error_code();
+
+ private:
+  struct Chunk {
+    Chunk() : data(NULL), size(0) { }
+    unsigned char *data;
+    size_t size;
+  };
+
+  enum Stage {
+    kStageHash = 0,
+    kStageInflate,
+  };
+
+  explicit DecompressJob(DecompressPipeline *pipeline);
+  void Enqueue(Chunk *chunk);
+  void ProcessStage(const Stage stage);
+  void Retire();
+
+  DecompressPipeline *pipeline_;
+
+  // Copied from the JobInfo when the job is offloaded
+  cvmfs::Sink *sink_;
+  zlib::Decompressor *decompressor_;
+  shash::ContextPtr hash_context_;
+  bool do_hash_;
+  bool can_pause_;
+  std::string url_;
+
+  // Only used by the download I/O thread
+  bool offloaded_;
+  bool paused_;
+  uint64_t inline_bytes_;
+  Chunk *open_chunk_;
+
+  /**
+   * Protects the members below, which are shared with the workers.  The
+   * positions count the chunks from the front of chunks_ that are processed
+   * by the hash and the inflate stage, respectively.  A chunk is freed once
+   * both stages are done with it.
+   */
+  pthread_mutex_t lock_;
+  pthread_cond_t cond_progress_;
+  std::deque<Chunk *> chunks_;
+  unsigned hash_pos_;
+  unsigned inflate_pos_;
+  bool hash_busy_;
+  bool inflate_busy_;
+  Failures error_code_;
+};
+
+
+/**
+ * Moves hashing and decompression of large downloads off the download I/O
+ * threads.  Once a transfer received more than kThreshold bytes, the curl data
+ * callback only copies the data into chunks of kChunkSize bytes and hands them
+ * to a pool of worker threads.  For every job, one worker at a time hashes the
+ * chunks and, concurrently, another worker decompresses them into the sink,
+ * both in order.  Different jobs are processed in parallel.
+ *
+ * There are at most kMaxChunks chunks in flight per job.  If the limit is
+ * reached, the transfer is paused and the event loop resumes it once the
+ * workers caught up, so that other transfers of the event loop keep going and
+ * memory stays bounded.
+ */
+class DecompressPipeline : SingleCopy {
+  friend class DecompressJob;
+
+ public:
+  static const unsigned kThreshold = 1024 * 1024;
+  static const unsigned kChunkSize = 256 * 1024;
+  static const unsigned kMaxChunks = 8;
+  static const unsigned kMaxWorkers = 64;
+
+  struct Counters {
+    perf::Counter *n_jobs;
+    perf::Counter *n_stalls;
+    perf::Counter *sz_hash_time;
+    perf::Counter *sz_inflate_time;
+    perf::Counter *sz_drain_time;
+
+    explicit Counters(perf::StatisticsTemplate statistics) {
+      n_jobs = statistics.RegisterTemplated("n_jobs",
+        "Number of downloads processed by the decompression workers");
+      n_stalls = statistics.RegisterTemplated("n_stalls",
+        "Number of times a transfer was paused for the decompression workers");
+      sz_hash_time = statistics.RegisterTemplated("sz_hash_time",
+        "Time spent hashing by the decompression workers (microseconds)");
+      sz_inflate_time = statistics.RegisterTemplated("sz_inflate_time",
+        "Time spent decompressing and writing by the decompression workers "
+        "(microseconds)");
+      sz_drain_time = statistics.RegisterTemplated("sz_drain_time",
+        "Time the I/O threads waited for the decompression workers "
+        "(microseconds)");
+    }
+  };
+
+  DecompressPipeline(const unsigned num_workers,
+                     perf::StatisticsTemplate statistics);
+  ~DecompressPipeline();
+
+  DecompressJob *CreateJob() { return new DecompressJob(this); }
+  unsigned num_workers() const { return threads_.size(); }
+
+ private:
+  /**
+   * Every job has at most one queued task per stage
+   */
+  static const unsigned kMaxTasks = 4096;
+
+  struct Task {
+    Task() : job(NULL), stage(DecompressJob::kStageHash) { }
+    Task(DecompressJob *j, DecompressJob::Stage s) : job(j), stage(s) { }
+    DecompressJob *job;  ///< NULL terminates the worker
+    DecompressJob::Stage stage;
+  };
+
+  static void *MainWorker(void *data);
+  void Schedule(DecompressJob *job, const DecompressJob::Stage stage) {
+    tasks_.Enqueue(Task(job, stage));
+  }
+
+  FifoChannel<Task> tasks_;
+  std::vector<pthread_t> threads_;
+  Counters counters_;
+};
+
+}  // namespace download
+
+#endif  // CVMFS_NETWORK_DECOMPRESS_PIPELINE_H_
@@ -250,15 +250,38 @@ static size_t CallbackCurlData(void *ptr, size_t size, size_t nmemb,
   if (num_bytes == 0)
     return 0;
 
+  if (info->compressed() && (info->decompressor() == NULL)) {
+    LogCvmfs(kLogDownload, kLogSyslogErr,
+             "unsupported compression algorithm %s for %s",
+             zlib::AlgorithmName(info->compression_alg()).c_str(),
+             info->url()->c_str());
+    info->SetErrorCode(kFailBadData);
+    return 0;
+  }
+
+  DecompressJob *decompress_job = info->decompress_job();
+  if ((decompress_job != NULL) &&
+      decompress_job->TakesOver(info, num_bytes))
+  {
+    switch (decompress_job->Push(ptr, num_bytes)) {
+      case DecompressJob::kPushOk:
+        return num_bytes;
+      case DecompressJob::kPushFull:
+        return CURL_WRITEFUNC_PAUSE;
+      default:
+        info->SetErrorCode(decompress_job->error_code());
+        return 0;
+    }
+  }
+
   if (info->expected_hash()) {
     shash::Update(reinterpret_cast<unsigned char *>(ptr),
                   num_bytes, info->hash_context());
   }
 
   if (info->compressed()) {
-    zlib::StreamStates retval =
-      zlib::DecompressZStream2Sink(ptr, static_cast<int64_t>(num_bytes),
-                                   info->GetZstreamPtr(), info->sink());
+    zlib::StreamStates retval = info->decompressor()->Inflate(
+      ptr, static_cast<int64_t>(num_bytes), info->sink());
     if (retval == zlib::kStreamDataError) {
       LogCvmfs(kLogDownload, kLogSyslogErr, "failed to decompress %s",
                 info->url()->c_str());
@@ -441,65 +464,65 @@ int DownloadManager::CallbackCurlSocket(CURL * /* easy */,
 {
   // LogCvmfs(kLogDownload, kLogDebug, "CallbackCurlSocket called with easy "
   //          "handle %p, socket %d, action %d", easy, s, action);
-  DownloadManager *download_mgr = static_cast<DownloadManager *>(userp);
+  EventLoop *loop = static_cast<EventLoop *>(userp);
   if (action == CURL_POLL_NONE)
     return 0;
 
-  // Find s in watch_fds_
+  // Find s in watch_fds
   unsigned index;
 
   // TODO(heretherebedragons) why start at index = 0 and not 2?
   // fd[0] and fd[1] are fixed?
-  for (index = 0; index < download_mgr->watch_fds_inuse_; ++index) {
-    if (download_mgr->watch_fds_[index].fd == s)
+  for (index = 0; index < loop->watch_fds_inuse; ++index) {
+    if (loop->watch_fds[index].fd == s)
       break;
   }
   // Or create newly
-  if (index == download_mgr->watch_fds_inuse_) {
+  if (index == loop->watch_fds_inuse) {
     // Extend array if necessary
-    if (download_mgr->watch_fds_inuse_ == download_mgr->watch_fds_size_)
+    if (loop->watch_fds_inuse == loop->watch_fds_size)
     {
-      assert(download_mgr->watch_fds_size_ > 0);
-      download_mgr->watch_fds_size_ *= 2;
-      download_mgr->watch_fds_ = static_cast<struct pollfd *>(
-        srealloc(download_mgr->watch_fds_,
-                 download_mgr->watch_fds_size_ * sizeof(struct pollfd)));
+      assert(loop->watch_fds_size > 0);
+      loop->watch_fds_size *= 2;
+      loop->watch_fds = static_cast<struct pollfd *>(
+        srealloc(loop->watch_fds,
+                 loop->watch_fds_size * sizeof(struct pollfd)));
     }
-    download_mgr->watch_fds_[download_mgr->watch_fds_inuse_].fd = s;
-    download_mgr->watch_fds_[download_mgr->watch_fds_inuse_].events = 0;
-    download_mgr->watch_fds_[download_mgr->watch_fds_inuse_].revents = 0;
-    download_mgr->watch_fds_inuse_++;
+    loop->watch_fds[loop->watch_fds_inuse].fd = s;
+    loop->watch_fds[loop->watch_fds_inuse].events = 0;
+    loop->watch_fds[loop->watch_fds_inuse].revents = 0;
+    loop->watch_fds_inuse++;
   }
 
   switch (action) {
     case CURL_POLL_IN:
-      download_mgr->watch_fds_[index].events = POLLIN | POLLPRI;
+      loop->watch_fds[index].events = POLLIN | POLLPRI;
       break;
     case CURL_POLL_OUT:
-      download_mgr->watch_fds_[index].events = POLLOUT | POLLWRBAND;
+      loop->watch_fds[index].events = POLLOUT | POLLWRBAND;
       break;
     case CURL_POLL_INOUT:
-      download_mgr->watch_fds_[index].events =
+      loop->watch_fds[index].events =
         POLLIN | POLLPRI | POLLOUT | POLLWRBAND;
       break;
     case CURL_POLL_REMOVE:
-      if (index < download_mgr->watch_fds_inuse_-1) {
-        download_mgr->watch_fds_[index] =
-          download_mgr->watch_fds_[download_mgr->watch_fds_inuse_-1];
+      if (index < loop->watch_fds_inuse-1) {
+        loop->watch_fds[index] =
+          loop->watch_fds[loop->watch_fds_inuse-1];
       }
-      download_mgr->watch_fds_inuse_--;
+      loop->watch_fds_inuse--;
       // Shrink array if necessary
-      if ((download_mgr->watch_fds_inuse_ > download_mgr->watch_fds_max_) &&
-          (download_mgr->watch_fds_inuse_ < download_mgr->watch_fds_size_/2))
+      if ((loop->watch_fds_inuse > loop->watch_fds_max) &&
+          (loop->watch_fds_inuse < loop->watch_fds_size/2))
       {
-        download_mgr->watch_fds_size_ /= 2;
-        // LogCvmfs(kLogDownload, kLogDebug, "shrinking watch_fds_ (%d)",
-        //          watch_fds_size_);
-        download_mgr->watch_fds_ = static_cast<struct pollfd *>(
-          srealloc(download_mgr->watch_fds_,
-                   download_mgr->watch_fds_size_*sizeof(struct pollfd)));
-        // LogCvmfs(kLogDownload, kLogDebug, "shrinking watch_fds_ done",
-        //          watch_fds_size_);
+        loop->watch_fds_size /= 2;
+        // LogCvmfs(kLogDownload, kLogDebug, "shrinking watch_fds (%d)",
+        //          watch_fds_size);
+        loop->watch_fds = static_cast<struct pollfd *>(
+          srealloc(loop->watch_fds,
+                   loop->watch_fds_size*sizeof(struct pollfd)));
+        // LogCvmfs(kLogDownload, kLogDebug, "shrinking watch_fds done",
+        //          watch_fds_size);
       }
       break;
     default:
@@ -511,27 +534,29 @@ int DownloadManager::CallbackCurlSocket(CURL * /* easy */,
 
 
 /**
- * Worker thread event loop.  Waits on new JobInfo structs on a pipe.
+ * Worker thread event loop.  Waits on new JobInfo structs on a pipe.  There is
+ * one such thread per EventLoop.
  */
 void *DownloadManager::MainDownload(void *data) {
-  LogCvmfs(kLogDownload, kLogDebug, "download I/O thread started");
-  DownloadManager *download_mgr = static_cast<DownloadManager *>(data);
+  EventLoop *loop = static_cast<EventLoop *>(data);
+  DownloadManager *download_mgr = loop->download_mgr;
+  LogCvmfs(kLogDownload, kLogDebug, "download I/O thread %u started",
+           loop->id);
 
   const int kIdxPipeTerminate = 0;
   const int kIdxPipeJobs = 1;
 
-  download_mgr->watch_fds_ =
+  loop->watch_fds =
     static_cast<struct pollfd *>(smalloc(2 * sizeof(struct pollfd)));
-  download_mgr->watch_fds_size_ = 2;
-  download_mgr->watch_fds_[kIdxPipeTerminate].fd =
+  loop->watch_fds_size = 2;
+  loop->watch_fds[kIdxPipeTerminate].fd =
                                      download_mgr->pipe_terminate_->GetReadFd();
-  download_mgr->watch_fds_[kIdxPipeTerminate].events = POLLIN | POLLPRI;
-  download_mgr->watch_fds_[kIdxPipeTerminate].revents = 0;
-  download_mgr->watch_fds_[kIdxPipeJobs].fd =
-                                          download_mgr->pipe_jobs_->GetReadFd();
-  download_mgr->watch_fds_[kIdxPipeJobs].events = POLLIN | POLLPRI;
-  download_mgr->watch_fds_[kIdxPipeJobs].revents = 0;
-  download_mgr->watch_fds_inuse_ = 2;
+  loop->watch_fds[kIdxPipeTerminate].events = POLLIN | POLLPRI;
+  loop->watch_fds[kIdxPipeTerminate].revents = 0;
+  loop->watch_fds[kIdxPipeJobs].fd = loop->pipe_jobs->GetReadFd();
+  loop->watch_fds[kIdxPipeJobs].events = POLLIN | POLLPRI;
+  loop->watch_fds[kIdxPipeJobs].revents = 0;
+  loop->watch_fds_inuse = 2;
 
   int still_running = 0;
   struct timeval timeval_start, timeval_stop;
@@ -556,37 +581,41 @@ void *DownloadManager::MainDownload(void *data) {
         1000 * DiffTimeSeconds(timeval_start, timeval_stop));
       perf::Xadd(download_mgr->counters_->sz_transfer_time, delta);
     }
-    int retval = poll(download_mgr->watch_fds_, download_mgr->watch_fds_inuse_,
-                      timeout);
+    int retval = poll(loop->watch_fds, loop->watch_fds_inuse, timeout);
     if (retval < 0) {
       continue;
     }
 
     // Handle timeout
     if (retval == 0) {
-      curl_multi_socket_action(download_mgr->curl_multi_,
+      curl_multi_socket_action(loop->curl_multi,
                                CURL_SOCKET_TIMEOUT,
                                0,
                                &still_running);
     }
 
     // Terminate I/O thread
-    if (download_mgr->watch_fds_[kIdxPipeTerminate].revents)
+    if (loop->watch_fds[kIdxPipeTerminate].revents)
       break;
 
     // New job arrives
-    if (download_mgr->watch_fds_[kIdxPipeJobs].revents) {
-      download_mgr->watch_fds_[kIdxPipeJobs].revents = 0;
+    if (loop->watch_fds[kIdxPipeJobs].revents) {
+      loop->watch_fds[kIdxPipeJobs].revents = 0;
       JobInfo *info;
-      download_mgr->pipe_jobs_->Read<JobInfo*>(&info);
+      loop->pipe_jobs->Read<JobInfo*>(&info);
       if (!still_running) {
         gettimeofday(&timeval_start, NULL);
       }
-      CURL *handle = download_mgr->AcquireCurlHandle();
-      download_mgr->InitializeRequest(info, handle);
+      CURL *handle = download_mgr->AcquireCurlHandle(loop);
+      if ((download_mgr->decompress_pipeline_ != NULL) &&
+          (info->sink() != NULL))
+      {
+        info->SetDecompressJob(download_mgr->decompress_pipeline_->CreateJob());
+      }
+      download_mgr->InitializeRequest(loop, info, handle);
       download_mgr->SetUrlOptions(info);
-      curl_multi_add_handle(download_mgr->curl_multi_, handle);
-      curl_multi_socket_action(download_mgr->curl_multi_,
+      curl_multi_add_handle(loop->curl_multi, handle);
+      curl_multi_socket_action(loop->curl_multi,
                                CURL_SOCKET_TIMEOUT,
                                0,
                                &still_running);
@@ -594,56 +623,65 @@ void *DownloadManager::MainDownload(void *data) {
 
     // Activity on curl sockets
     // Within this loop the curl_multi_socket_action() may cause socket(s)
-    // to be removed from watch_fds_. If a socket is removed it is replaced
+    // to be removed from watch_fds. If a socket is removed it is replaced
     // by the socket at the end of the array and the inuse count is decreased.
     // Therefore loop over the array in reverse order.
-    for (int64_t i = download_mgr->watch_fds_inuse_-1; i >= 2; --i) {
-      if (i >= download_mgr->watch_fds_inuse_) {
+    for (int64_t i = loop->watch_fds_inuse-1; i >= 2; --i) {
+      if (i >= loop->watch_fds_inuse) {
         continue;
       }
-      if (download_mgr->watch_fds_[i].revents) {
+      if (loop->watch_fds[i].revents) {
         int ev_bitmask = 0;
-        if (download_mgr->watch_fds_[i].revents & (POLLIN | POLLPRI))
+        if (loop->watch_fds[i].revents & (POLLIN | POLLPRI))
           ev_bitmask |= CURL_CSELECT_IN;
-        if (download_mgr->watch_fds_[i].revents & (POLLOUT | POLLWRBAND))
+        if (loop->watch_fds[i].revents & (POLLOUT | POLLWRBAND))
           ev_bitmask |= CURL_CSELECT_OUT;
-        if (download_mgr->watch_fds_[i].revents &
+        if (loop->watch_fds[i].revents &
             (POLLERR | POLLHUP | POLLNVAL))
         {
           ev_bitmask |= CURL_CSELECT_ERR;
         }
-        download_mgr->watch_fds_[i].revents = 0;
+        loop->watch_fds[i].revents = 0;
 
-        curl_multi_socket_action(download_mgr->curl_multi_,
-                                 download_mgr->watch_fds_[i].fd,
+        curl_multi_socket_action(loop->curl_multi,
+                                 loop->watch_fds[i].fd,
                                  ev_bitmask,
                                  &still_running);
       }
     }
 
+    if (download_mgr->decompress_pipeline_ != NULL)
+      download_mgr->ResumeTransfers(loop);
+
     // Check if transfers are completed
     CURLMsg *curl_msg;
     int msgs_in_queue;
-    while ((curl_msg = curl_multi_info_read(download_mgr->curl_multi_,
+    while ((curl_msg = curl_multi_info_read(loop->curl_multi,
                                             &msgs_in_queue)))
     {
       if (curl_msg->msg == CURLMSG_DONE) {
         perf::Inc(download_mgr->counters_->n_requests);
+        if (loop->counters != NULL)
+          perf::Inc(loop->counters->n_requests);
         JobInfo *info;
         CURL *easy_handle = curl_msg->easy_handle;
         int curl_error = curl_msg->data.result;
         curl_easy_getinfo(easy_handle, CURLINFO_PRIVATE, &info);
 
-        curl_multi_remove_handle(download_mgr->curl_multi_, easy_handle);
-        if (download_mgr->VerifyAndFinalize(curl_error, info)) {
-          curl_multi_add_handle(download_mgr->curl_multi_, easy_handle);
-          curl_multi_socket_action(download_mgr->curl_multi_,
+        curl_multi_remove_handle(loop->curl_multi, easy_handle);
+        if (info->decompress_job() != NULL)
+          curl_error = download_mgr->FinishDecompression(info, curl_error);
+        if (download_mgr->VerifyAndFinalize(loop, curl_error, info)) {
+          curl_multi_add_handle(loop->curl_multi, easy_handle);
+          curl_multi_socket_action(loop->curl_multi,
                                    CURL_SOCKET_TIMEOUT,
                                    0,
                                    &still_running);
         } else {
           // Return easy handle into pool and write result back
-          download_mgr->ReleaseCurlHandle(easy_handle);
+          download_mgr->ReleaseCurlHandle(loop, easy_handle);
+          delete info->decompress_job();
+          info->SetDecompressJob(NULL);
 
           info->GetPipeJobResultWeakRef()->
                                   Write<download::Failures>(info->error_code());
@@ -652,16 +690,18 @@ void *DownloadManager::MainDownload(void *data) {
     }
   }
 
-  for (set<CURL *>::iterator i = download_mgr->pool_handles_inuse_->begin(),
-       iEnd = download_mgr->pool_handles_inuse_->end(); i != iEnd; ++i)
+  for (set<CURL *>::iterator i = loop->pool_handles_inuse.begin(),
+       iEnd = loop->pool_handles_inuse.end(); i != iEnd; ++i)
   {
-    curl_multi_remove_handle(download_mgr->curl_multi_, *i);
+    curl_multi_remove_handle(loop->curl_multi, *i);
     curl_easy_cleanup(*i);
   }
-  download_mgr->pool_handles_inuse_->clear();
-  free(download_mgr->watch_fds_);
+  loop->pool_handles_inuse.clear();
+  free(loop->watch_fds);
+  loop->watch_fds = NULL;
 
-  LogCvmfs(kLogDownload, kLogDebug, "download I/O thread terminated");
+  LogCvmfs(kLogDownload, kLogDebug, "download I/O thread %u terminated",
+           loop->id);
   return NULL;
 }
 
@@ -816,10 +856,10 @@ string DownloadManager::ProxyInfo::Print() {
  * Gets an idle CURL handle from the pool. Creates a new one and adds it to
  * the pool if necessary.
  */
-CURL *DownloadManager::AcquireCurlHandle() {
+CURL *DownloadManager::AcquireCurlHandle(EventLoop *loop) {
   CURL *handle;
 
-  if (pool_handles_idle_->empty()) {
+  if (loop->pool_handles_idle.empty()) {
     // Create a new handle
     handle = curl_easy_init();
     assert(handle != NULL);
@@ -829,27 +869,27 @@ CURL *DownloadManager::AcquireCurlHandle() {
     curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, CallbackCurlHeader);
     curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, CallbackCurlData);
   } else {
-    handle = *(pool_handles_idle_->begin());
-    pool_handles_idle_->erase(pool_handles_idle_->begin());
+    handle = *(loop->pool_handles_idle.begin());
+    loop->pool_handles_idle.erase(loop->pool_handles_idle.begin());
   }
 
-  pool_handles_inuse_->insert(handle);
+  loop->pool_handles_inuse.insert(handle);
 
   return handle;
 }
 
 
-void DownloadManager::ReleaseCurlHandle(CURL *handle) {
-  set<CURL *>::iterator elem = pool_handles_inuse_->find(handle);
-  assert(elem != pool_handles_inuse_->end());
+void DownloadManager::ReleaseCurlHandle(EventLoop *loop, CURL *handle) {
+  set<CURL *>::iterator elem = loop->pool_handles_inuse.find(handle);
+  assert(elem != loop->pool_handles_inuse.end());
 
-  if (pool_handles_idle_->size() > pool_max_handles_) {
+  if (loop->pool_handles_idle.size() > pool_max_handles_) {
     curl_easy_cleanup(*elem);
   } else {
-    pool_handles_idle_->insert(*elem);
+    loop->pool_handles_idle.insert(*elem);
   }
 
-  pool_handles_inuse_->erase(elem);
+  loop->pool_handles_inuse.erase(elem);
 }
 
 
@@ -857,7 +897,11 @@ void DownloadManager::ReleaseCurlHandle(CURL *handle) {
  * HTTP request options: set the URL and other options such as timeout and
  * proxy.
  */
-void DownloadManager::InitializeRequest(JobInfo *info, CURL *handle) {
+void DownloadManager::InitializeRequest(EventLoop *loop,
+                                        JobInfo *info,
+                                        CURL *handle)
+{
+  HeaderLists *header_lists = loop->header_lists;
   // Initialize internal download state
   info->SetCurlHandle(handle);
   info->SetErrorCode(kFailOk);
@@ -867,31 +911,32 @@ void DownloadManager::InitializeRequest(JobInfo *info, CURL *handle) {
   info->SetNumUsedHosts(1);
   info->SetNumRetries(0);
   info->SetBackoffMs(0);
-  info->SetHeaders(header_lists_->DuplicateList(default_headers_));
+  info->SetHeaders(header_lists->DuplicateList(loop->default_headers));
   if (info->info_header()) {
-    header_lists_->AppendHeader(info->headers(), info->info_header());
+    header_lists->AppendHeader(info->headers(), info->info_header());
   }
   if (enable_http_tracing_) {
     for (unsigned int i = 0; i < http_tracing_headers_.size(); i++) {
-      header_lists_->AppendHeader(info->headers(),
-                                  (http_tracing_headers_)[i].c_str());
+      header_lists->AppendHeader(info->headers(),
+                                 (http_tracing_headers_)[i].c_str());
     }
 
-    header_lists_->AppendHeader(info->headers(), info->tracing_header_pid());
-    header_lists_->AppendHeader(info->headers(), info->tracing_header_gid());
-    header_lists_->AppendHeader(info->headers(), info->tracing_header_uid());
+    header_lists->AppendHeader(info->headers(), info->tracing_header_pid());
+    header_lists->AppendHeader(info->headers(), info->tracing_header_gid());
+    header_lists->AppendHeader(info->headers(), info->tracing_header_uid());
 
     LogCvmfs(kLogDownload, kLogDebug, "CURL Header for URL: %s is:\n %s",
-           info->url()->c_str(), header_lists_->Print(info->headers()).c_str());
+             info->url()->c_str(),
+             header_lists->Print(info->headers()).c_str());
   }
 
   if (info->force_nocache()) {
-    SetNocache(info);
+    SetNocache(loop, info);
   } else {
     info->SetNocache(false);
   }
   if (info->compressed()) {
-    zlib::DecompressInit(info->GetZstreamPtr());
+    info->PrepareDecompressor();
   }
   if (info->expected_hash()) {
     assert(info->hash_context().buffer != NULL);
@@ -1193,7 +1238,7 @@ bool DownloadManager::ValidateProxyIpsUnlocked(
 /**
  * Adds transfer time and downloaded bytes to the global counters.
  */
-void DownloadManager::UpdateStatistics(CURL *handle) {
+void DownloadManager::UpdateStatistics(EventLoop *loop, CURL *handle) {
   double val;
   int retval;
   int64_t sum = 0;
@@ -1205,6 +1250,8 @@ void DownloadManager::UpdateStatistics(CURL *handle) {
   assert(retval == CURLE_OK);
   sum += static_cast<int64_t>(val);*/
   perf::Xadd(counters_->sz_transferred_bytes, sum);
+  if (loop->counters != NULL)
+    perf::Xadd(loop->counters->sz_transferred_bytes, sum);
 }
 
 
@@ -1227,7 +1274,7 @@ bool DownloadManager::CanRetry(const JobInfo *info) {
  *
  * \return true if backoff has been performed, false otherwise
  */
-void DownloadManager::Backoff(JobInfo *info) {
+void DownloadManager::Backoff(EventLoop *loop, JobInfo *info) {
   unsigned backoff_init_ms = 0;
   unsigned backoff_max_ms = 0;
   {
@@ -1239,7 +1286,7 @@ void DownloadManager::Backoff(JobInfo *info) {
   info->SetNumRetries(info->num_retries() + 1);
   perf::Inc(counters_->n_retries);
   if (info->backoff_ms() == 0) {
-    info->SetBackoffMs(prng_.Next(backoff_init_ms + 1));  // Must be != 0
+    info->SetBackoffMs(loop->prng.Next(backoff_init_ms + 1));  // Must be != 0
   } else {
     info->SetBackoffMs(info->backoff_ms() * 2);
   }
@@ -1252,11 +1299,11 @@ void DownloadManager::Backoff(JobInfo *info) {
   SafeSleepMs(info->backoff_ms());
 }
 
-void DownloadManager::SetNocache(JobInfo *info) {
+void DownloadManager::SetNocache(EventLoop *loop, JobInfo *info) {
   if (info->nocache())
     return;
-  header_lists_->AppendHeader(info->headers(), "Pragma: no-cache");
-  header_lists_->AppendHeader(info->headers(), "Cache-Control: no-cache");
+  loop->header_lists->AppendHeader(info->headers(), "Pragma: no-cache");
+  loop->header_lists->AppendHeader(info->headers(), "Cache-Control: no-cache");
   curl_easy_setopt(info->curl_handle(), CURLOPT_HTTPHEADER, info->headers());
   info->SetNocache(true);
 }
@@ -1266,11 +1313,12 @@ void DownloadManager::SetNocache(JobInfo *info) {
  * Reverse operation of SetNocache. Makes sure that "no-cache" header
  * disappears from the list of headers to let proxies work normally.
  */
-void DownloadManager::SetRegularCache(JobInfo *info) {
+void DownloadManager::SetRegularCache(EventLoop *loop, JobInfo *info) {
   if (info->nocache() == false)
     return;
-  header_lists_->CutHeader("Pragma: no-cache", info->GetHeadersPtr());
-  header_lists_->CutHeader("Cache-Control: no-cache", info->GetHeadersPtr());
+  loop->header_lists->CutHeader("Pragma: no-cache", info->GetHeadersPtr());
+  loop->header_lists->CutHeader("Cache-Control: no-cache",
+                                info->GetHeadersPtr());
   curl_easy_setopt(info->curl_handle(), CURLOPT_HTTPHEADER, info->headers());
   info->SetNocache(false);
 }
@@ -1289,17 +1337,56 @@ void DownloadManager::ReleaseCredential(JobInfo *info) {
 }
 
 
+/**
+ * Waits for the decompression workers to process the rest of the download.
+ * A failure of the workers turns a successful transfer into a write error, as
+ * if the data callback had failed.  Returns the new curl error.
+ */
+int DownloadManager::FinishDecompression(JobInfo *info, const int curl_error) {
+  Failures result = info->decompress_job()->Finish();
+  if ((result == kFailOk) || (curl_error != CURLE_OK))
+    return curl_error;
+  info->SetErrorCode(result);
+  return CURLE_WRITE_ERROR;
+}
+
+
+/**
+ * Continues the transfers that were paused because the decompression workers
+ * fell behind.
+ */
+void DownloadManager::ResumeTransfers(EventLoop *loop) {
+  for (set<CURL *>::const_iterator i = loop->pool_handles_inuse.begin(),
+       iEnd = loop->pool_handles_inuse.end(); i != iEnd; ++i)
+  {
+    JobInfo *info;
+    curl_easy_getinfo(*i, CURLINFO_PRIVATE, &info);
+    DecompressJob *decompress_job = info->decompress_job();
+    if ((decompress_job == NULL) || !decompress_job->IsPaused() ||
+        !decompress_job->CanResume())
+    {
+      continue;
+    }
+    decompress_job->Resume();
+    curl_easy_pause(*i, CURLPAUSE_CONT);
+  }
+}
+
+
 /**
  * Checks the result of a curl download and implements the failure logic, such
  * as changing the proxy server.  Takes care of cleanup.
  *
  * \return true if another download should be performed, false otherwise
  */
-bool DownloadManager::VerifyAndFinalize(const int curl_error, JobInfo *info) {
+bool DownloadManager::VerifyAndFinalize(EventLoop *loop,
+                                        const int curl_error,
+                                        JobInfo *info)
+{
   LogCvmfs(kLogDownload, kLogDebug,
            "Verify downloaded url %s, proxy %s (curl error %d)",
            info->url()->c_str(), info->proxy().c_str(), curl_error);
-  UpdateStatistics(info->curl_handle());
+  UpdateStatistics(loop, info->curl_handle());
 
   // Verification and error classification
   switch (curl_error) {
@@ -1503,21 +1590,21 @@ bool DownloadManager::VerifyAndFinalize(const int curl_error, JobInfo *info) {
       shash::Init(info->hash_context());
     }
     if (info->compressed()) {
-      zlib::DecompressInit(info->GetZstreamPtr());
+      info->PrepareDecompressor();
     }
 
     if (sharding_policy_.UseCount() > 0) {  // sharding policy
       ReleaseCredential(info);
       SetUrlOptions(info);
     } else {  // no sharding policy
-      SetRegularCache(info);
+      SetRegularCache(loop, info);
 
       // Failure handling
       bool switch_proxy = false;
       bool switch_host = false;
       switch (info->error_code()) {
         case kFailBadData:
-          SetNocache(info);
+          SetNocache(loop, info);
           break;
         case kFailProxyResolve:
         case kFailProxyHttp:
@@ -1531,13 +1618,13 @@ bool DownloadManager::VerifyAndFinalize(const int curl_error, JobInfo *info) {
         default:
           if (IsProxyTransferError(info->error_code())) {
             if (same_url_retry) {
-              Backoff(info);
+              Backoff(loop, info);
             } else {
               switch_proxy = true;
             }
           } else if (IsHostTransferError(info->error_code())) {
             if (same_url_retry) {
-              Backoff(info);
+              Backoff(loop, info);
             } else {
               switch_host = true;
             }
@@ -1575,11 +1662,8 @@ bool DownloadManager::VerifyAndFinalize(const int curl_error, JobInfo *info) {
     info->SetErrorCode(kFailLocalIO);
   }
 
-  if (info->compressed())
-    zlib::DecompressFini(info->GetZstreamPtr());
-
   if (info->headers()) {
-    header_lists_->PutList(info->headers());
+    loop->header_lists->PutList(info->headers());
     info->SetHeaders(NULL);
   }
 
@@ -1600,25 +1684,19 @@ DownloadManager::~DownloadManager() {
   }
 
   if (atomic_xadd32(&multi_threaded_, 0) == 1) {
-    // Shutdown I/O thread
+    // Shutdown I/O threads
     pipe_terminate_->Write(kPipeTerminateSignal);
-    pthread_join(thread_download_, NULL);
-    // All handles are removed from the multi stack
+    for (unsigned i = 0; i < event_loops_.size(); ++i)
+      pthread_join(event_loops_[i]->thread_download, NULL);
+    // All handles are removed from the multi stacks
     pipe_terminate_.Destroy();
-    pipe_jobs_.Destroy();
   }
 
-  for (set<CURL *>::iterator i = pool_handles_idle_->begin(),
-       iEnd = pool_handles_idle_->end(); i != iEnd; ++i)
-  {
-    curl_easy_cleanup(*i);
-  }
-
-  delete pool_handles_idle_;
-  delete pool_handles_inuse_;
-  curl_multi_cleanup(curl_multi_);
+  for (unsigned i = 0; i < event_loops_.size(); ++i)
+    delete event_loops_[i];
+  event_loops_.clear();
+  delete decompress_pipeline_;
 
-  delete header_lists_;
   if (user_agent_)
     free(user_agent_);
 
@@ -1651,26 +1729,62 @@ void DownloadManager::InitHeaders() {
     sanitizer::InputSanitizer("az AZ 09 -").Filter(getenv("CERNVM_UUID"));
   }
   user_agent_ = strdup(cernvm_id.c_str());
+}
+
+
+DownloadManager::EventLoop::EventLoop(DownloadManager *download_mgr,
+                                      const unsigned id)
+  : download_mgr(download_mgr)
+  , id(id)
+  , curl_multi(NULL)
+  , header_lists(new HeaderLists())
+  , default_headers(NULL)
+  , pipe_jobs(NULL)
+  , watch_fds(NULL)
+  , watch_fds_size(0)
+  , watch_fds_inuse(0)
+  , watch_fds_max(4 * download_mgr->pool_max_handles_)
+  , counters(NULL)
+{
+  default_headers = header_lists->GetList("Connection: Keep-Alive");
+  header_lists->AppendHeader(default_headers, "Pragma:");
+  header_lists->AppendHeader(default_headers, download_mgr->user_agent_);
+
+  curl_multi = curl_multi_init();
+  assert(curl_multi != NULL);
+  curl_multi_setopt(curl_multi, CURLMOPT_SOCKETFUNCTION, CallbackCurlSocket);
+  curl_multi_setopt(curl_multi, CURLMOPT_SOCKETDATA,
+                    static_cast<void *>(this));
+  curl_multi_setopt(curl_multi, CURLMOPT_MAXCONNECTS, watch_fds_max);
+  curl_multi_setopt(curl_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS,
+                    download_mgr->pool_max_handles_);
+
+  prng.InitSeed(download_mgr->prng_.Next(0x7fffffff) + id);
+}
 
-  header_lists_ = new HeaderLists();
 
-  default_headers_ = header_lists_->GetList("Connection: Keep-Alive");
-  header_lists_->AppendHeader(default_headers_, "Pragma:");
-  header_lists_->AppendHeader(default_headers_, user_agent_);
+DownloadManager::EventLoop::~EventLoop() {
+  for (set<CURL *>::iterator i = pool_handles_idle.begin(),
+       iEnd = pool_handles_idle.end(); i != iEnd; ++i)
+  {
+    curl_easy_cleanup(*i);
+  }
+  curl_multi_cleanup(curl_multi);
+  pipe_jobs.Destroy();
+  delete header_lists;
+  delete counters;
 }
 
 DownloadManager::DownloadManager(const unsigned max_pool_handles,
                            const perf::StatisticsTemplate &statistics) :
                   prng_(Prng()),
-                  pool_handles_idle_(new set<CURL *>),
-                  pool_handles_inuse_(new set<CURL *>),
                   pool_max_handles_(max_pool_handles),
+                  user_agent_(NULL),
+                  num_event_loops_(1),
+                  num_decompress_workers_(0),
+                  decompress_pipeline_(NULL),
+                  statistics_(statistics),
                   pipe_terminate_(NULL),
-                  pipe_jobs_(NULL),
-                  watch_fds_(NULL),
-                  watch_fds_size_(0),
-                  watch_fds_inuse_(0),
-                  watch_fds_max_(4 * max_pool_handles),
                   opt_timeout_proxy_(5),
                   opt_timeout_direct_(10),
                   opt_low_speed_limit_(1024),
@@ -1702,6 +1816,7 @@ DownloadManager::DownloadManager(const unsigned max_pool_handles,
                   counters_(new Counters(statistics))
 {
   atomic_init32(&multi_threaded_);
+  atomic_init32(&next_event_loop_);
 
   lock_options_ =
           reinterpret_cast<pthread_mutex_t *>(smalloc(sizeof(pthread_mutex_t)));
@@ -1717,17 +1832,11 @@ DownloadManager::DownloadManager(const unsigned max_pool_handles,
 
   InitHeaders();
 
-  curl_multi_ = curl_multi_init();
-  assert(curl_multi_ != NULL);
-  curl_multi_setopt(curl_multi_, CURLMOPT_SOCKETFUNCTION, CallbackCurlSocket);
-  curl_multi_setopt(curl_multi_, CURLMOPT_SOCKETDATA,
-                    static_cast<void *>(this));
-  curl_multi_setopt(curl_multi_, CURLMOPT_MAXCONNECTS, watch_fds_max_);
-  curl_multi_setopt(curl_multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS,
-                    pool_max_handles_);
-
   prng_.InitLocaltime();
 
+  // The first event loop also serves the synchronous mode
+  event_loops_.push_back(new EventLoop(this, 0));
+
   // Name resolving
   if ((getenv("CVMFS_IPV4_ONLY") != NULL) &&
       (strlen(getenv("CVMFS_IPV4_ONLY")) > 0))
@@ -1740,16 +1849,34 @@ DownloadManager::DownloadManager(const unsigned max_pool_handles,
 }
 
 /**
- * Spawns the I/O worker thread and switches the module in multi-threaded mode.
- * No way back except Fini(); Init();
+ * Spawns the I/O worker threads, one per event loop, and switches the module in
+ * multi-threaded mode.  No way back except Fini(); Init();
  */
 void DownloadManager::Spawn() {
   pipe_terminate_ = new Pipe<kPipeThreadTerminator>();
-  pipe_jobs_ = new Pipe<kPipeDownloadJobs>();
 
-  int retval = pthread_create(&thread_download_, NULL, MainDownload,
-                              static_cast<void *>(this));
-  assert(retval == 0);
+  if (num_decompress_workers_ > 0) {
+    decompress_pipeline_ = new DecompressPipeline(num_decompress_workers_,
+      perf::StatisticsTemplate("decompress", statistics_));
+  }
+
+  while (event_loops_.size() < num_event_loops_)
+    event_loops_.push_back(new EventLoop(this, event_loops_.size()));
+  for (unsigned i = 0; i < event_loops_.size(); ++i) {
+    EventLoop *loop = event_loops_[i];
+    if (event_loops_.size() > 1) {
+      loop->counters = new LoopCounters(
+        perf::StatisticsTemplate("loop" + StringifyUint(i), statistics_));
+    }
+    loop->pipe_jobs = new Pipe<kPipeDownloadJobs>();
+    int retval = pthread_create(&loop->thread_download, NULL, MainDownload,
+                                static_cast<void *>(loop));
+    assert(retval == 0);
+  }
+  if (event_loops_.size() > 1) {
+    LogCvmfs(kLogDownload, kLogDebug, "spawned %u download event loops",
+             event_loops_.size());
+  }
 
   atomic_inc32(&multi_threaded_);
 
@@ -1813,15 +1940,19 @@ Failures DownloadManager::Fetch(JobInfo *info) {
       info->CreatePipeJobResults();
     }
 
+    EventLoop *loop = SelectEventLoop(info);
+    if (loop->counters != NULL)
+      perf::Inc(loop->counters->n_jobs_queued);
     // LogCvmfs(kLogDownload, kLogDebug, "send job to thread, pipe %d %d",
     //          info->wait_at[0], info->wait_at[1]);
-    pipe_jobs_->Write<JobInfo*>(info);
+    loop->pipe_jobs->Write<JobInfo*>(info);
     info->GetPipeJobResultWeakRef()->Read<download::Failures>(&result);
     // LogCvmfs(kLogDownload, kLogDebug, "got result %d", result);
   } else {
     MutexLockGuard l(lock_synchronous_mode_);
-    CURL *handle = AcquireCurlHandle();
-    InitializeRequest(info, handle);
+    EventLoop *loop = event_loops_[0];
+    CURL *handle = AcquireCurlHandle(loop);
+    InitializeRequest(loop, info, handle);
     SetUrlOptions(info);
     // curl_easy_setopt(handle, CURLOPT_VERBOSE, 1);
     int retval;
@@ -1834,9 +1965,9 @@ Failures DownloadManager::Fetch(JobInfo *info) {
         perf::Xadd(counters_->sz_transfer_time,
                    static_cast<int64_t>(elapsed * 1000));
       }
-    } while (VerifyAndFinalize(retval, info));
+    } while (VerifyAndFinalize(loop, retval, info));
     result = info->error_code();
-    ReleaseCurlHandle(info->curl_handle());
+    ReleaseCurlHandle(loop, info->curl_handle());
   }
 
   if (result != kFailOk) {
@@ -1852,6 +1983,28 @@ Failures DownloadManager::Fetch(JobInfo *info) {
 }
 
 
+/**
+ * Jobs with an expected content hash are sharded by hash so that concurrent
+ * requests for the same object end up on the same connection pool.  Other jobs
+ * (manifests, probes, geo API calls) are distributed round-robin.
+ */
+DownloadManager::EventLoop *DownloadManager::SelectEventLoop(
+  const JobInfo *info)
+{
+  const unsigned num_loops = event_loops_.size();
+  if (num_loops == 1)
+    return event_loops_[0];
+
+  uint32_t idx;
+  if (info->expected_hash() != NULL) {
+    idx = info->expected_hash()->Partial32();
+  } else {
+    idx = static_cast<uint32_t>(atomic_xadd32(&next_event_loop_, 1));
+  }
+  return event_loops_[idx % num_loops];
+}
+
+
 /**
  * Used by the client to connect the authz session manager to the download
  * manager.
@@ -2851,6 +3004,40 @@ void DownloadManager::SetFailoverIndefinitely() {
   failover_indefinitely_ = true;
 }
 
+/**
+ * Sets the number of download I/O threads.  Each of them maintains its own
+ * connection pool of up to max_pool_handles connections.  Must be called
+ * before Spawn().
+ *
+ * @return false if the number is out of range or the module is already
+ *         multi-threaded
+ */
+bool DownloadManager::SetNumEventLoops(const unsigned num_loops) {
+  if ((num_loops == 0) || (num_loops > kMaxEventLoops)) {
+    LogCvmfs(kLogDownload, kLogDebug | kLogSyslogWarn,
+             "invalid number of download event loops: %u (allowed: 1-%u)",
+             num_loops, kMaxEventLoops);
+    return false;
+  }
+  if (atomic_xadd32(&multi_threaded_, 0) == 1)
+    return false;
+  num_event_loops_ = num_loops;
+  return true;
+}
+
+bool DownloadManager::SetNumDecompressWorkers(const unsigned num_workers) {
+  if (num_workers > DecompressPipeline::kMaxWorkers) {
+    LogCvmfs(kLogDownload, kLogDebug | kLogSyslogWarn,
+             "invalid number of decompression workers: %u (allowed: 0-%u)",
+             num_workers, DecompressPipeline::kMaxWorkers);
+    return false;
+  }
+  if (atomic_xadd32(&multi_threaded_, 0) == 1)
+    return false;
+  num_decompress_workers_ = num_workers;
+  return true;
+}
+
 /**
  * Creates a copy of the existing download manager.  Must only be called in
  * single-threaded stage because it calls curl_global_init().
@@ -2859,6 +3046,8 @@ DownloadManager *DownloadManager::Clone(
   const perf::StatisticsTemplate &statistics)
 {
   DownloadManager *clone = new DownloadManager(pool_max_handles_, statistics);
+  clone->num_event_loops_ = num_event_loops_;
+  clone->num_decompress_workers_ = num_decompress_workers_;
 
   clone->SetDnsParameters(resolver_->retries(), resolver_->timeout_ms());
   clone->SetDnsTtlLimits(resolver_->min_ttl(), resolver_->max_ttl());
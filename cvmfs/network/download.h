@@ -21,6 +21,7 @@
 #include "compression.h"
 #include "crypto/hash.h"
 #include "duplex_curl.h"
+#include "network/decompress_pipeline.h"
 #include "network/dns.h"
 #include "network/health_check.h"
 #include "network/jobinfo.h"
@@ -62,6 +63,26 @@ struct Counters {
   }
 };  // Counters
 
+
+/**
+ * Counters of a single download event loop.  Only registered if more than one
+ * event loop is spawned; the totals are still accounted for in Counters.
+ */
+struct LoopCounters {
+  perf::Counter *sz_transferred_bytes;
+  perf::Counter *n_requests;
+  perf::Counter *n_jobs_queued;
+
+  explicit LoopCounters(perf::StatisticsTemplate statistics) {
+    sz_transferred_bytes = statistics.RegisterTemplated("sz_transferred_bytes",
+        "Number of transferred bytes by this event loop");
+    n_requests = statistics.RegisterTemplated("n_requests",
+        "Number of requests handled by this event loop");
+    n_jobs_queued = statistics.RegisterTemplated("n_jobs_queued",
+        "Number of jobs assigned to this event loop");
+  }
+};  // LoopCounters
+
 /**
  * Manages blocks of arrays of curl_slist storing header strings.  In contrast
  * to curl's slists, these ones don't take ownership of the header strings.
@@ -154,6 +175,11 @@ class DownloadManager {  // NOLINT(clang-analyzer-optin.performance.Padding)
   static const unsigned kDnsDefaultRetries = 1;
   static const unsigned kDnsDefaultTimeoutMs = 3000;
   static const unsigned kProxyMapScale = 16;
+  /**
+   * Upper bound for SetNumEventLoops().  Every event loop is an I/O thread with
+   * its own curl multi handle and connection pool.
+   */
+  static const unsigned kMaxEventLoops = 64;
 
   DownloadManager(const unsigned max_pool_handles,
                   const perf::StatisticsTemplate &statistics);
@@ -215,6 +241,11 @@ class DownloadManager {  // NOLINT(clang-analyzer-optin.performance.Padding)
   bool SetShardingPolicy(const ShardingPolicySelector type);
   void SetFailoverIndefinitely();
   void SetFqrn(const std::string &fqrn) { fqrn_ = fqrn; }
+  bool SetNumEventLoops(const unsigned num_loops);
+  bool SetNumDecompressWorkers(const unsigned num_workers);
+
+  unsigned num_event_loops() const { return num_event_loops_; }
+  unsigned num_decompress_workers() const { return num_decompress_workers_; }
 
   unsigned num_hosts() {
     if (opt_host_chain_) return opt_host_chain_->size();
@@ -226,6 +257,40 @@ class DownloadManager {  // NOLINT(clang-analyzer-optin.performance.Padding)
   }
 
  private:
+  /**
+   * State of a single download I/O thread.  Every event loop drives its own
+   * curl multi handle with its own pool of easy handles and header lists, so
+   * that loops never share mutable curl state.  The first loop is created
+   * together with the download manager and also serves the synchronous mode
+   * before Spawn().  Options (hosts, proxies, timeouts) remain shared and are
+   * protected by lock_options_.
+   */
+  struct EventLoop {
+    EventLoop(DownloadManager *download_mgr, const unsigned id);
+    ~EventLoop();
+
+    DownloadManager *download_mgr;
+    unsigned id;
+    CURLM *curl_multi;
+    std::set<CURL *> pool_handles_idle;
+    std::set<CURL *> pool_handles_inuse;
+    HeaderLists *header_lists;
+    curl_slist *default_headers;
+    Prng prng;
+
+    pthread_t thread_download;
+    UniquePtr<Pipe<kPipeDownloadJobs> > pipe_jobs;
+    struct pollfd *watch_fds;
+    uint32_t watch_fds_size;
+    uint32_t watch_fds_inuse;
+    uint32_t watch_fds_max;
+
+    /**
+     * NULL if there is only a single event loop
+     */
+    LoopCounters *counters;
+  };
+
   static int CallbackCurlSocket(CURL *easy, curl_socket_t s, int action,
                                 void *userp, void *socketp);
   static void *MainDownload(void *data);
@@ -239,18 +304,21 @@ class DownloadManager {  // NOLINT(clang-analyzer-optin.performance.Padding)
   ProxyInfo *ChooseProxyUnlocked(const shash::Any *hash);
   void UpdateProxiesUnlocked(const std::string &reason);
   void RebalanceProxiesUnlocked(const std::string &reason);
-  CURL *AcquireCurlHandle();
-  void ReleaseCurlHandle(CURL *handle);
+  EventLoop *SelectEventLoop(const JobInfo *info);
+  CURL *AcquireCurlHandle(EventLoop *loop);
+  void ReleaseCurlHandle(EventLoop *loop, CURL *handle);
   void ReleaseCredential(JobInfo *info);
-  void InitializeRequest(JobInfo *info, CURL *handle);
+  void InitializeRequest(EventLoop *loop, JobInfo *info, CURL *handle);
   void SetUrlOptions(JobInfo *info);
   bool ValidateProxyIpsUnlocked(const std::string &url, const dns::Host &host);
-  void UpdateStatistics(CURL *handle);
+  void UpdateStatistics(EventLoop *loop, CURL *handle);
   bool CanRetry(const JobInfo *info);
-  void Backoff(JobInfo *info);
-  void SetNocache(JobInfo *info);
-  void SetRegularCache(JobInfo *info);
-  bool VerifyAndFinalize(const int curl_error, JobInfo *info);
+  void Backoff(EventLoop *loop, JobInfo *info);
+  void SetNocache(EventLoop *loop, JobInfo *info);
+  void SetRegularCache(EventLoop *loop, JobInfo *info);
+  bool VerifyAndFinalize(EventLoop *loop, const int curl_error, JobInfo *info);
+  int FinishDecompression(JobInfo *info, const int curl_error);
+  void ResumeTransfers(EventLoop *loop);
   void InitHeaders();
   void CloneProxyConfig(DownloadManager *clone);
 
@@ -265,24 +333,35 @@ class DownloadManager {  // NOLINT(clang-analyzer-optin.performance.Padding)
   }
 
   Prng prng_;
-  std::set<CURL *> *pool_handles_idle_;
-  std::set<CURL *> *pool_handles_inuse_;
   uint32_t pool_max_handles_;
-  CURLM *curl_multi_;
-  HeaderLists *header_lists_;
-  curl_slist *default_headers_;
   char *user_agent_;
 
-  pthread_t thread_download_;
+  /**
+   * The event loops, i.e. the I/O threads.  The vector is filled with the
+   * first loop in the constructor and extended to num_event_loops_ on Spawn().
+   * It does not change afterwards.
+   */
+  std::vector<EventLoop *> event_loops_;
+  unsigned num_event_loops_;
+  /**
+   * Used to distribute jobs without expected hash among the event loops.
+   */
+  atomic_int32 next_event_loop_;
+  /**
+   * Number of threads that hash and decompress large downloads, 0 if that
+   * happens inline in the event loops.  The pipeline is created on Spawn().
+   */
+  unsigned num_decompress_workers_;
+  DecompressPipeline *decompress_pipeline_;
+  perf::StatisticsTemplate statistics_;
+
   atomic_int32 multi_threaded_;
+  /**
+   * Shared by all event loops.  A single write terminates all I/O threads as
+   * nobody drains the pipe.
+   */
   UniquePtr<Pipe<kPipeThreadTerminator> > pipe_terminate_;
 
-  UniquePtr<Pipe<kPipeDownloadJobs> > pipe_jobs_;
-  struct pollfd *watch_fds_;
-  uint32_t watch_fds_size_;
-  uint32_t watch_fds_inuse_;
-  uint32_t watch_fds_max_;
-
   pthread_mutex_t *lock_options_;
   pthread_mutex_t *lock_synchronous_mode_;
   std::string opt_dns_server_;
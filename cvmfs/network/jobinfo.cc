@@ -3,6 +3,9 @@
  */
 
 #include "jobinfo.h"
+
+#include <cassert>
+
 #include "util/string.h"
 
 namespace download {
@@ -34,10 +37,23 @@ bool JobInfo::IsFileNotFound() {
   return http_code_ == 404;
 }
 
+void JobInfo::PrepareDecompressor() {
+  if ((decompressor_ != NULL) && (decompressor_alg_ == compression_alg_)) {
+    decompressor_->Reset();
+    return;
+  }
+  delete decompressor_;
+  // NULL if the algorithm is not supported by this build; the download then
+  // fails with kFailBadData
+  decompressor_ = zlib::Decompressor::Construct(compression_alg_);
+  decompressor_alg_ = compression_alg_;
+}
+
 void JobInfo::Init() {
   pipe_job_results = NULL;
   url_ = NULL;
   compressed_ = false;
+  compression_alg_ = zlib::kZlibDefault;
   probe_hosts_ = false;
   head_request_ = false;
   follow_redirects_ = false;
@@ -71,7 +87,9 @@ void JobInfo::Init() {
 
   allow_failure_ = false;
 
-  memset(&zstream_, 0, sizeof(zstream_));
+  decompressor_ = NULL;
+  decompressor_alg_ = zlib::kZlibDefault;
+  decompress_job_ = NULL;
 }
 
 }  // namespace download
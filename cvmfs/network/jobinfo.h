@@ -30,6 +30,8 @@ class InterruptCue;
 
 namespace download {
 
+class DecompressJob;
+
 /**
  * Contains all the information to specify a download job.
  */
@@ -39,6 +41,7 @@ class JobInfo {
   UniquePtr<Pipe<kPipeDownloadJobsResults> > pipe_job_results;
   const std::string *url_;
   bool compressed_;
+  zlib::Algorithms compression_alg_;
   bool probe_hosts_;
   bool head_request_;
   bool follow_redirects_;
@@ -63,8 +66,10 @@ class JobInfo {
   char *tracing_header_pid_;
   char *tracing_header_gid_;
   char *tracing_header_uid_;
-  z_stream zstream_;
+  zlib::Decompressor *decompressor_;
+  zlib::Algorithms decompressor_alg_;
   shash::ContextPtr hash_context_;
+  DecompressJob *decompress_job_;
   std::string proxy_;
   bool nocache_;
   Failures error_code_;
@@ -98,6 +103,7 @@ class JobInfo {
     if (pipe_job_results.IsValid()) {
       pipe_job_results.Destroy();
     }
+    delete decompressor_;
   }
 
   void CreatePipeJobResults() {
@@ -114,11 +120,16 @@ class JobInfo {
    */
   bool IsFileNotFound();
 
+  /**
+   * Readies the decompressor for a new download.  The decompressor is kept
+   * across downloads with the same compression algorithm.
+   */
+  void PrepareDecompressor();
+
   pid_t *GetPidPtr() { return &pid_; }
   uid_t *GetUidPtr() { return &uid_; }
   gid_t *GetGidPtr() { return &gid_; }
   InterruptCue **GetInterruptCuePtr() { return &interrupt_cue_; }
-  z_stream *GetZstreamPtr() { return &zstream_; }
   Failures *GetErrorCodePtr() { return &error_code_; }
   void **GetCredDataPtr() { return &cred_data_; }
   curl_slist **GetHeadersPtr() { return &headers_; }
@@ -129,6 +140,7 @@ class JobInfo {
 
   const std::string* url() const { return url_; }
   bool compressed() const { return compressed_; }
+  zlib::Algorithms compression_alg() const { return compression_alg_; }
   bool probe_hosts() const { return probe_hosts_; }
   bool head_request() const { return head_request_; }
   bool follow_redirects() const { return follow_redirects_; }
@@ -151,8 +163,9 @@ class JobInfo {
   char *tracing_header_pid() const { return tracing_header_pid_; }
   char *tracing_header_gid() const { return tracing_header_gid_; }
   char *tracing_header_uid() const { return tracing_header_uid_; }
-  z_stream zstream() const { return zstream_; }
+  zlib::Decompressor *decompressor() const { return decompressor_; }
   shash::ContextPtr hash_context() const { return hash_context_; }
+  DecompressJob *decompress_job() const { return decompress_job_; }
   std::string proxy() const { return proxy_; }
   bool nocache() const { return nocache_; }
   Failures error_code() const { return error_code_; }
@@ -169,6 +182,10 @@ class JobInfo {
 
   void SetUrl(const std::string *url) { url_ = url; }
   void SetCompressed(bool compressed) { compressed_ = compressed; }
+  void SetCompressionAlgorithm(zlib::Algorithms alg) {
+    compression_alg_ = alg;
+    compressed_ = (alg != zlib::kNoCompression);
+  }
   void SetProbeHosts(bool probe_hosts) { probe_hosts_ = probe_hosts; }
   void SetHeadRequest(bool head_request) { head_request_ = head_request; }
   void SetFollowRedirects(bool follow_redirects)
@@ -199,9 +216,10 @@ class JobInfo {
                                   { tracing_header_gid_ = tracing_header_gid; };
   void SetTracingHeaderUid(char *tracing_header_uid)
                                   { tracing_header_uid_ = tracing_header_uid; };
-  void SetZstream(z_stream zstream) { zstream_ = zstream; }
   void SetHashContext(shash::ContextPtr hash_context)
                                                { hash_context_ = hash_context; }
+  void SetDecompressJob(DecompressJob *decompress_job)
+                                           { decompress_job_ = decompress_job; }
   void SetProxy(const std::string &proxy) { proxy_ = proxy; }
   void SetNocache(bool nocache) { nocache_ = nocache; }
   void SetErrorCode(Failures error_code) { error_code_ = error_code; }
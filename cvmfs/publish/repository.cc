@@ -248,6 +248,8 @@ void Publisher::ConstructSpoolers() {
     settings_.storage().GetLocator(),
     settings_.transaction().hash_algorithm(),
     settings_.transaction().compression_algorithm());
+  sd.compression_level = settings_.transaction().compression_level();
+  sd.chunking_algorithm = settings_.transaction().chunking_algorithm();
   sd.session_token_file =
     settings_.transaction().spool_area().gw_session_token();
   sd.key_file = settings_.keychain().gw_key_path();
@@ -80,7 +80,16 @@ void SettingsTransaction::SetHashAlgorithm(const std::string &algorithm) {
 
 void SettingsTransaction::SetCompressionAlgorithm(const std::string &algorithm)
 {
-  compression_algorithm_ = zlib::ParseCompressionAlgorithm(algorithm);
+  int level;
+  compression_algorithm_ = zlib::ParseCompressionAlgorithm(algorithm, &level);
+  compression_level_ = level;
+}
+
+void SettingsTransaction::SetChunkingAlgorithm(const std::string &algorithm) {
+  ChunkingAlgorithms chunking_algorithm = ParseChunkingAlgorithm(algorithm);
+  if (chunking_algorithm == kChunkingUnknown)
+    throw EPublish("unknown file chunking algorithm: " + algorithm);
+  chunking_algorithm_ = chunking_algorithm;
 }
 
 void SettingsTransaction::SetEnforceLimits(bool value) {
@@ -555,6 +564,9 @@ void SettingsBuilder::ApplyOptionsFromServerPath(
   if (options_mgr_.GetValue("CVMFS_COMPRESSION_ALGORITHM", &arg)) {
     settings_publisher->GetTransaction()->SetCompressionAlgorithm(arg);
   }
+  if (options_mgr_.GetValue("CVMFS_CHUNKING_ALGORITHM", &arg)) {
+    settings_publisher->GetTransaction()->SetChunkingAlgorithm(arg);
+  }
   if (options_mgr_.GetValue("CVMFS_ENFORCE_LIMITS", &arg)) {
     settings_publisher->GetTransaction()->SetEnforceLimits(
         options_mgr_.IsOn(arg));
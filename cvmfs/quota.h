@@ -41,6 +41,10 @@ class QuotaManager : SingleCopy {
    *  - backchannel command 'R': release pinned files if possible
    * Revision 2:
    *  - add kCleanupRate command
+   * Revision 3:
+   *  - ring buffer in shared memory for commands without reply, kRingDoorbell
+   * Revision 4:
+   *  - add kEvictionStatistics command
    */
   static const uint32_t kProtocolRevision;
 
@@ -50,6 +54,34 @@ class QuotaManager : SingleCopy {
     kCapList,
     kCapShrink,
     kCapListeners,
+    kCapIntrospectEviction,
+  };
+
+  /**
+   * Counters of the cache cleanup.  A cleanup is "early" if it is started by
+   * the high watermark before an insert actually hits the limit.  Inserts that
+   * hit the limit stall until the cleanup is done.
+   */
+  struct EvictionStatistics {
+    EvictionStatistics()
+      : n_cleanup(0)
+      , n_cleanup_early(0)
+      , n_evict(0)
+      , sz_evict(0)
+      , n_stall(0)
+      , stall_time_ns(0)
+      , n_unlink(0)
+      , n_unlink_pending(0)
+    { }
+
+    uint64_t n_cleanup;
+    uint64_t n_cleanup_early;
+    uint64_t n_evict;
+    uint64_t sz_evict;
+    uint64_t n_stall;
+    uint64_t stall_time_ns;
+    uint64_t n_unlink;
+    uint64_t n_unlink_pending;
   };
 
   QuotaManager();
@@ -76,6 +108,7 @@ class QuotaManager : SingleCopy {
   virtual uint64_t GetSize() = 0;
   virtual uint64_t GetSizePinned() = 0;
   virtual uint64_t GetCleanupRate(uint64_t period_s) = 0;
+  virtual EvictionStatistics GetEvictionStatistics() = 0;
 
   virtual void Spawn() = 0;
   virtual pid_t GetPid() = 0;
@@ -152,6 +185,9 @@ class NoopQuotaManager : public QuotaManager {
   virtual uint64_t GetSize() { return 0; }
   virtual uint64_t GetSizePinned() { return 0; }
   virtual uint64_t GetCleanupRate(uint64_t period_s) { return 0; }
+  virtual EvictionStatistics GetEvictionStatistics() {
+    return EvictionStatistics();
+  }
 
   virtual void Spawn() { }
   virtual pid_t GetPid() { return getpid(); }
@@ -0,0 +1,422 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "quota_index.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "quota_policy.h"
+#include "util/logging.h"
+#include "util/platform.h"
+#include "util/posix.h"
+
+using namespace std;  // NOLINT
+
+
+namespace {
+
+bool SeqLessThan(const QuotaIndex::Entry *a, const QuotaIndex::Entry *b) {
+  return (a->seq & ~QuotaIndex::kVolatileFlag) <
+         (b->seq & ~QuotaIndex::kVolatileFlag);
+}
+
+}  // anonymous namespace
+
+
+QuotaIndex::QuotaIndex()
+  : policy_(QuotaPolicy::Create(QuotaPolicy::kPolicyLru))
+  , max_seq_(0)
+{
+  entries_.Init(1024, shash::Any(), hasher_any);
+}
+
+
+QuotaIndex::~QuotaIndex() {
+  Clear();
+  delete policy_;
+}
+
+
+/**
+ * Replaces the replacement policy.  Takes ownership of the policy.  Existing
+ * entries are handed to the new policy in order of their sequence numbers, as
+ * if they were loaded from the cache catalog.
+ */
+void QuotaIndex::SetPolicy(QuotaPolicy *policy) {
+  vector<Entry *> entries;
+  entries.reserve(entries_.size());
+  for (Entry *entry = First(); entry != NULL; entry = Next(entry))
+    entries.push_back(entry);
+  std::stable_sort(entries.begin(), entries.end(), SeqLessThan);
+
+  delete policy_;
+  policy_ = policy;
+  for (unsigned i = 0; i < entries.size(); ++i)
+    policy_->Load(entries[i]);
+}
+
+
+QuotaIndex::Entry *QuotaIndex::First() const {
+  return policy_->First();
+}
+
+
+QuotaIndex::Entry *QuotaIndex::Next(const Entry *entry) const {
+  return policy_->Next(entry);
+}
+
+
+void QuotaIndex::Clear() {
+  Entry *entry = First();
+  while (entry != NULL) {
+    Entry *next = Next(entry);
+    delete entry->description;
+    delete entry;
+    entry = next;
+  }
+  entries_.Clear();
+  policy_->Clear();
+  changes_.clear();
+  max_seq_ = 0;
+}
+
+
+QuotaIndex::Entry *QuotaIndex::Lookup(const shash::Any &hash) const {
+  Entry *entry;
+  if (entries_.Lookup(hash, &entry))
+    return entry;
+  return NULL;
+}
+
+
+/**
+ * Inserts a new entry or replaces an existing one, like INSERT OR REPLACE on
+ * the cache catalog.  Returns true if the entry was not yet in the index.
+ */
+bool QuotaIndex::Insert(
+  const shash::Any &hash,
+  const uint64_t size,
+  const uint64_t seq,
+  const std::string &description,
+  const int type,
+  const bool pinned)
+{
+  Entry *entry = Lookup(hash);
+  const bool is_new = (entry == NULL);
+  if (is_new) {
+    entry = new Entry();
+    entry->hash = hash;
+    entries_.Insert(hash, entry);
+  } else {
+    policy_->Remove(entry);
+  }
+  entry->size = size;
+  entry->seq = seq;
+  entry->type = type;
+  entry->pinned = pinned;
+  if (entry->description == NULL)
+    entry->description = new string(description);
+  else
+    entry->description->assign(description);
+  if (is_new)
+    policy_->Insert(entry);
+  else
+    policy_->Promote(entry);
+  MarkDirty(entry);
+  UpdateMaxSeq(seq);
+  return is_new;
+}
+
+
+/**
+ * Adds an entry from the cache catalog.  Such entries are not dirty and have no
+ * description.  Entries need to be loaded in order of their sequence numbers.
+ */
+QuotaIndex::Entry *QuotaIndex::Load(
+  const shash::Any &hash,
+  const uint64_t size,
+  const uint64_t seq,
+  const int type)
+{
+  assert(Lookup(hash) == NULL);
+  Entry *entry = new Entry();
+  entry->hash = hash;
+  entry->size = size;
+  entry->seq = seq;
+  entry->type = type;
+  entries_.Insert(hash, entry);
+  policy_->Load(entry);
+  UpdateMaxSeq(seq);
+  return entry;
+}
+
+
+/**
+ * Moves the entry to the end of its LRU list resp. lets the policy promote the
+ * entry.  Volatile entries stay volatile.
+ */
+bool QuotaIndex::Touch(const shash::Any &hash, const uint64_t seq) {
+  Entry *entry = Lookup(hash);
+  if (entry == NULL)
+    return false;
+  policy_->Remove(entry);
+  entry->seq = seq | (entry->seq & kVolatileFlag);
+  policy_->Promote(entry);
+  MarkDirty(entry);
+  UpdateMaxSeq(seq);
+  return true;
+}
+
+
+bool QuotaIndex::SetPinned(const shash::Any &hash, const bool pinned) {
+  Entry *entry = Lookup(hash);
+  if (entry == NULL)
+    return false;
+  if (entry->pinned != pinned) {
+    entry->pinned = pinned;
+    MarkDirty(entry);
+  }
+  return true;
+}
+
+
+bool QuotaIndex::Remove(const shash::Any &hash) {
+  Entry *entry = Lookup(hash);
+  if (entry == NULL)
+    return false;
+  policy_->Remove(entry);
+  entries_.Erase(hash);
+  changes_.push_back(hash);
+  delete entry->description;
+  delete entry;
+  return true;
+}
+
+
+/**
+ * Hands out the entries that changed since the last call and the hashes of the
+ * removed entries.  The changed entries are marked clean.  The pointers are
+ * valid until the next modification of the index.
+ */
+void QuotaIndex::PopChanges(
+  std::vector<Entry *> *changed,
+  std::vector<shash::Any> *removed)
+{
+  for (unsigned i = 0; i < changes_.size(); ++i) {
+    Entry *entry = Lookup(changes_[i]);
+    if (entry == NULL) {
+      removed->push_back(changes_[i]);
+      continue;
+    }
+    if (!entry->dirty)
+      continue;
+    entry->dirty = false;
+    changed->push_back(entry);
+  }
+  changes_.clear();
+}
+
+
+//------------------------------------------------------------------------------
+
+
+QuotaJournal::QuotaJournal() : fd_(-1), size_(0) { }
+
+
+QuotaJournal::~QuotaJournal() {
+  Close();
+}
+
+
+bool QuotaJournal::Open(const std::string &path) {
+  assert(fd_ < 0);
+  path_ = path;
+  fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0600);
+  if (fd_ < 0) {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogErr,
+             "failed to open LRU journal %s (%d)", path.c_str(), errno);
+    return false;
+  }
+  platform_stat64 info;
+  int retval = platform_fstat(fd_, &info);
+  assert(retval == 0);
+  size_ = info.st_size;
+  buffer_.clear();
+  return true;
+}
+
+
+void QuotaJournal::Close() {
+  if (fd_ < 0)
+    return;
+  Flush();
+  close(fd_);
+  fd_ = -1;
+}
+
+
+/**
+ * Applies the journaled changes to the index.  Stops at the first incomplete
+ * or invalid record.  Returns false only if the journal cannot be read.
+ */
+bool QuotaJournal::Replay(QuotaIndex *index) {
+  assert(fd_ >= 0);
+  if (size_ == 0)
+    return true;
+
+  string content;
+  if (lseek(fd_, 0, SEEK_SET) != 0)
+    return false;
+  if (!SafeReadToString(fd_, &content))
+    return false;
+
+  Header header;
+  if ((content.size() < sizeof(header))) {
+    LogCvmfs(kLogQuota, kLogDebug, "ignoring truncated LRU journal");
+    return true;
+  }
+  memcpy(&header, content.data(), sizeof(header));
+  if ((header.magic != kMagic) || (header.version != kVersion)) {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+             "ignoring LRU journal %s with unknown format", path_.c_str());
+    return true;
+  }
+
+  unsigned num_records = 0;
+  uint64_t pos = sizeof(header);
+  while (pos + sizeof(Record) <= content.size()) {
+    Record record;
+    memcpy(&record, content.data() + pos, sizeof(record));
+    if ((record.algorithm >= shash::kAny) ||
+        (pos + sizeof(record) + record.desc_length > content.size()))
+    {
+      break;
+    }
+    shash::Any hash(static_cast<shash::Algorithms>(record.algorithm));
+    memcpy(hash.digest, record.digest, hash.GetDigestSize());
+
+    switch (record.operation) {
+      case kOpInsert:
+        index->Insert(hash, record.size, record.seq,
+                      string(content.data() + pos + sizeof(record),
+                             record.desc_length),
+                      record.type, false);
+        break;
+      case kOpTouch:
+        index->Touch(hash, record.seq);
+        break;
+      case kOpRemove:
+        index->Remove(hash);
+        break;
+      default:
+        LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+                 "invalid record in LRU journal %s", path_.c_str());
+        return true;
+    }
+    pos += sizeof(record) + record.desc_length;
+    num_records++;
+  }
+  LogCvmfs(kLogQuota, kLogDebug, "replayed %u records from LRU journal",
+           num_records);
+  return true;
+}
+
+
+bool QuotaJournal::Truncate() {
+  assert(fd_ >= 0);
+  buffer_.clear();
+  size_ = 0;
+  if (ftruncate(fd_, 0) != 0) {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+             "failed to truncate LRU journal %s (%d)", path_.c_str(), errno);
+    return false;
+  }
+  return true;
+}
+
+
+void QuotaJournal::WriteHeader() {
+  Header header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  buffer_.append(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+
+void QuotaJournal::Append(const Record &record, const char *description) {
+  if (fd_ < 0)
+    return;
+  if (size() == 0)
+    WriteHeader();
+  buffer_.append(reinterpret_cast<const char *>(&record), sizeof(record));
+  if (record.desc_length > 0)
+    buffer_.append(description, record.desc_length);
+}
+
+
+void QuotaJournal::AppendInsert(
+  const shash::Any &hash,
+  const uint64_t size,
+  const uint64_t seq,
+  const std::string &description,
+  const int type)
+{
+  Record record;
+  memset(&record, 0, sizeof(record));
+  record.operation = kOpInsert;
+  record.algorithm = hash.algorithm;
+  record.type = type;
+  record.desc_length = description.length();
+  record.size = size;
+  record.seq = seq;
+  memcpy(record.digest, hash.digest, hash.GetDigestSize());
+  Append(record, description.data());
+}
+
+
+void QuotaJournal::AppendTouch(const shash::Any &hash, const uint64_t seq) {
+  Record record;
+  memset(&record, 0, sizeof(record));
+  record.operation = kOpTouch;
+  record.algorithm = hash.algorithm;
+  record.seq = seq;
+  memcpy(record.digest, hash.digest, hash.GetDigestSize());
+  Append(record, NULL);
+}
+
+
+void QuotaJournal::AppendRemove(const shash::Any &hash) {
+  Record record;
+  memset(&record, 0, sizeof(record));
+  record.operation = kOpRemove;
+  record.algorithm = hash.algorithm;
+  memcpy(record.digest, hash.digest, hash.GetDigestSize());
+  Append(record, NULL);
+}
+
+
+/**
+ * Writes out the buffered records.  On failure, the records are dropped and the
+ * caller needs to write a checkpoint and truncate the journal.
+ */
+bool QuotaJournal::Flush() {
+  if ((fd_ < 0) || buffer_.empty())
+    return true;
+  const bool retval = SafeWrite(fd_, buffer_.data(), buffer_.size());
+  if (retval) {
+    size_ += buffer_.size();
+  } else {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+             "failed to write to LRU journal %s (%d)", path_.c_str(), errno);
+  }
+  buffer_.clear();
+  return retval;
+}
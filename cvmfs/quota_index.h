@@ -0,0 +1,197 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#ifndef CVMFS_QUOTA_INDEX_H_
+#define CVMFS_QUOTA_INDEX_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "crypto/hash.h"
+#include "smallhash.h"
+#include "util/single_copy.h"
+
+class QuotaPolicy;
+
+/**
+ * In-memory index of the files tracked by the PosixQuotaManager.  Entries
+ * are kept in a hash table keyed by content hash.  The replacement policy
+ * (see quota_policy.h) orders the entries in intrusive lists.  By default,
+ * there are two LRU lists, one for volatile entries and one for regular
+ * entries.  Touching an entry moves it to the end of its list, so that the
+ * least recently used entry is always found at the head of the volatile list
+ * or, if there are no volatile entries, at the head of the regular list.
+ *
+ * The index remembers which entries changed since the last call to
+ * PopChanges() so that the quota manager can write back only the modified rows
+ * to the SQlite cache catalog.
+ */
+class QuotaIndex : SingleCopy {
+ public:
+  /**
+   * The last bit in the sequence number indicates if an entry is volatile.
+   */
+  static const uint64_t kVolatileFlag = 1ULL << 63;
+
+  struct Entry {
+    Entry()
+      : size(0), seq(0), type(0), pinned(false), dirty(false), segment(0)
+      , description(NULL), prev(NULL), next(NULL) { }
+    bool IsVolatile() const { return seq & kVolatileFlag; }
+
+    shash::Any hash;
+    uint64_t size;
+    uint64_t seq;
+    int type;
+    bool pinned;
+    /**
+     * Changed since the last PopChanges()
+     */
+    bool dirty;
+    /**
+     * Used by the replacement policy, e.g. to tell the list of the entry
+     */
+    unsigned char segment;
+    /**
+     * The description (path) is only kept until the entry is written to the
+     * cache catalog.  Afterwards, listings are served from the cache catalog.
+     */
+    std::string *description;
+
+    Entry *prev;
+    Entry *next;
+  };
+
+  QuotaIndex();
+  ~QuotaIndex();
+  void SetPolicy(QuotaPolicy *policy);
+  const QuotaPolicy *policy() const { return policy_; }
+
+  Entry *Lookup(const shash::Any &hash) const;
+  bool Insert(const shash::Any &hash, const uint64_t size, const uint64_t seq,
+              const std::string &description, const int type,
+              const bool pinned);
+  Entry *Load(const shash::Any &hash, const uint64_t size, const uint64_t seq,
+              const int type);
+  bool Touch(const shash::Any &hash, const uint64_t seq);
+  bool SetPinned(const shash::Any &hash, const bool pinned);
+  bool Remove(const shash::Any &hash);
+  void Clear();
+  void PopChanges(std::vector<Entry *> *changed,
+                  std::vector<shash::Any> *removed);
+
+  /**
+   * First entry to evict, volatile entries first.  NULL if empty.
+   */
+  Entry *First() const;
+  /**
+   * Next entry in eviction order or NULL.
+   */
+  Entry *Next(const Entry *entry) const;
+
+  uint32_t size() const { return entries_.size(); }
+  uint64_t max_seq() const { return max_seq_; }
+
+ private:
+  static uint32_t hasher_any(const shash::Any &key) {
+    return MurmurHash2(key.digest, sizeof(uint64_t), 0x07387a4f);
+  }
+
+  void MarkDirty(Entry *entry) {
+    if (entry->dirty)
+      return;
+    entry->dirty = true;
+    changes_.push_back(entry->hash);
+  }
+  void UpdateMaxSeq(const uint64_t seq) {
+    if ((seq & ~kVolatileFlag) > max_seq_)
+      max_seq_ = seq & ~kVolatileFlag;
+  }
+
+  SmallHashDynamic<shash::Any, Entry *> entries_;
+  QuotaPolicy *policy_;
+  /**
+   * Hashes of entries that were modified or removed since the last
+   * PopChanges().  A hash can appear multiple times.
+   */
+  std::vector<shash::Any> changes_;
+  uint64_t max_seq_;
+};
+
+
+/**
+ * Append-only log of the changes to the QuotaIndex.  The quota manager keeps
+ * the cache catalog as a checkpoint of the index and appends all changes since
+ * the last checkpoint to the journal.  On start, the journal is replayed on top
+ * of the cache catalog, so that a crashed cache manager does not need to
+ * rebuild the cache catalog from the file system.  After a checkpoint, the
+ * journal is truncated.
+ *
+ * Records are buffered and written on Flush().  A torn record at the end of the
+ * journal, e.g. after a crash, is ignored on replay.  Replaying the journal is
+ * idempotent, i.e. it does not matter if the changes were already partially
+ * written to the cache catalog.
+ */
+class QuotaJournal : SingleCopy {
+ public:
+  enum Operation {
+    kOpInsert = 1,
+    kOpTouch,
+    kOpRemove,
+  };
+
+  QuotaJournal();
+  ~QuotaJournal();
+
+  bool Open(const std::string &path);
+  void Close();
+  bool Replay(QuotaIndex *index);
+  bool Truncate();
+
+  void AppendInsert(const shash::Any &hash, const uint64_t size,
+                    const uint64_t seq, const std::string &description,
+                    const int type);
+  void AppendTouch(const shash::Any &hash, const uint64_t seq);
+  void AppendRemove(const shash::Any &hash);
+  bool Flush();
+
+  /**
+   * Bytes written since the last truncation, including the buffer
+   */
+  uint64_t size() const { return size_ + buffer_.size(); }
+  bool IsOpen() const { return fd_ >= 0; }
+
+ private:
+  static const uint32_t kMagic = 0x4a51564d;  // "MVQJ" on little-endian
+  static const uint32_t kVersion = 1;
+
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+  };
+
+  struct Record {
+    uint8_t operation;
+    uint8_t algorithm;
+    uint8_t type;
+    uint8_t reserved;
+    uint16_t desc_length;
+    uint16_t reserved2;
+    uint64_t size;
+    uint64_t seq;
+    unsigned char digest[shash::kMaxDigestSize];
+  };
+
+  void Append(const Record &record, const char *description);
+  void WriteHeader();
+
+  std::string path_;
+  int fd_;
+  uint64_t size_;
+  std::string buffer_;
+};
+
+#endif  // CVMFS_QUOTA_INDEX_H_
@@ -0,0 +1,113 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "quota_policy.h"
+
+#include <cassert>
+
+#include "util/exception.h"
+
+using namespace std;  // NOLINT
+
+
+QuotaPolicy *QuotaPolicy::Create(const Type type) {
+  switch (type) {
+    case kPolicyLru:
+      return new QuotaPolicyLru();
+    case kPolicySlru:
+      return new QuotaPolicySlru();
+    default:
+      PANIC(NULL);
+  }
+}
+
+
+string QuotaPolicy::GetTypeName(const Type type) {
+  switch (type) {
+    case kPolicyLru:
+      return "lru";
+    case kPolicySlru:
+      return "slru";
+    default:
+      return "unknown";
+  }
+}
+
+
+bool QuotaPolicy::ParseType(const string &name, Type *type) {
+  if (name == "lru") {
+    *type = kPolicyLru;
+    return true;
+  }
+  if (name == "slru") {
+    *type = kPolicySlru;
+    return true;
+  }
+  return false;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+void QuotaPolicySlru::Insert(Entry *entry) {
+  entry->segment = entry->IsVolatile() ? kSegmentVolatile : kSegmentProbation;
+  GetList(entry)->Append(entry);
+}
+
+
+void QuotaPolicySlru::Promote(Entry *entry) {
+  if (entry->IsVolatile()) {
+    entry->segment = kSegmentVolatile;
+    volatile_.Append(entry);
+    return;
+  }
+  entry->segment = kSegmentProtected;
+  protected_.Append(entry);
+  Demote();
+}
+
+
+void QuotaPolicySlru::Remove(Entry *entry) {
+  GetList(entry)->Unlink(entry);
+}
+
+
+/**
+ * Moves the least recently used protected entries to probation until the
+ * protected entries are within their share.
+ */
+void QuotaPolicySlru::Demote() {
+  while (protected_.size * 100 >
+         (probation_.size + protected_.size) * kProtectedShare)
+  {
+    Entry *entry = protected_.Front();
+    assert(entry != NULL);
+    protected_.Unlink(entry);
+    entry->segment = kSegmentProbation;
+    probation_.Append(entry);
+  }
+}
+
+
+QuotaPolicy::Entry *QuotaPolicySlru::First() const {
+  if (!volatile_.IsEmpty())
+    return volatile_.Front();
+  if (!probation_.IsEmpty())
+    return probation_.Front();
+  return protected_.Front();
+}
+
+
+QuotaPolicy::Entry *QuotaPolicySlru::Next(const Entry *entry) const {
+  if (entry->next == &volatile_.head) {
+    if (!probation_.IsEmpty())
+      return probation_.Front();
+    return protected_.Front();
+  }
+  if (entry->next == &probation_.head)
+    return protected_.Front();
+  return (entry->next == &protected_.head) ? NULL : entry->next;
+}
@@ -0,0 +1,193 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#ifndef CVMFS_QUOTA_POLICY_H_
+#define CVMFS_QUOTA_POLICY_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "quota_index.h"
+#include "util/single_copy.h"
+
+/**
+ * Replacement policy of the QuotaIndex.  The policy keeps the entries of the
+ * index in intrusive lists and decides about the eviction order.  Volatile
+ * entries are always evicted first.  The index unlinks an entry from the policy
+ * (Remove()) before it changes the entry's size or sequence number and links
+ * it again afterwards.
+ */
+class QuotaPolicy : SingleCopy {
+ public:
+  typedef QuotaIndex::Entry Entry;
+
+  enum Type {
+    /**
+     * Plain least recently used
+     */
+    kPolicyLru = 0,
+    /**
+     * Segmented LRU, a variant of 2Q.  New entries are put on probation and
+     * only files that are accessed again get protected.  A file system scan
+     * that reads every file once thus only replaces the probationary entries.
+     */
+    kPolicySlru,
+  };
+
+  static QuotaPolicy *Create(const Type type);
+  static bool ParseType(const std::string &name, Type *type);
+  static std::string GetTypeName(const Type type);
+
+  virtual ~QuotaPolicy() { }
+  virtual Type type() const = 0;
+
+  /**
+   * A new entry that has not been accessed before
+   */
+  virtual void Insert(Entry *entry) = 0;
+  /**
+   * An entry that is accessed again (touched or replaced)
+   */
+  virtual void Promote(Entry *entry) = 0;
+  /**
+   * An entry from the cache catalog.  Entries are loaded in order of their
+   * sequence numbers.
+   */
+  virtual void Load(Entry *entry) = 0;
+  virtual void Remove(Entry *entry) = 0;
+  /**
+   * Forgets about all entries, does not free them.
+   */
+  virtual void Clear() = 0;
+
+  /**
+   * First entry in eviction order, NULL if empty
+   */
+  virtual Entry *First() const = 0;
+  /**
+   * Next entry in eviction order or NULL
+   */
+  virtual Entry *Next(const Entry *entry) const = 0;
+
+ protected:
+  /**
+   * A list head (sentinel) together with the number of bytes in the list
+   */
+  struct List {
+    List() : size(0) { Reset(); }
+    void Reset() {
+      head.prev = head.next = &head;
+      size = 0;
+    }
+    bool IsEmpty() const { return head.next == &head; }
+    Entry *Front() const { return IsEmpty() ? NULL : head.next; }
+    void Append(Entry *entry) {
+      entry->prev = head.prev;
+      entry->next = &head;
+      head.prev->next = entry;
+      head.prev = entry;
+      size += entry->size;
+    }
+    void Unlink(Entry *entry) {
+      entry->prev->next = entry->next;
+      entry->next->prev = entry->prev;
+      size -= entry->size;
+    }
+
+    Entry head;
+    uint64_t size;
+  };
+
+  QuotaPolicy() { }
+};
+
+
+/**
+ * Two lists, one for volatile entries and one for regular entries.  Touching
+ * an entry moves it to the end of its list.
+ */
+class QuotaPolicyLru : public QuotaPolicy {
+ public:
+  virtual Type type() const { return kPolicyLru; }
+  virtual void Insert(Entry *entry) { GetList(entry)->Append(entry); }
+  virtual void Promote(Entry *entry) { GetList(entry)->Append(entry); }
+  virtual void Load(Entry *entry) { GetList(entry)->Append(entry); }
+  virtual void Remove(Entry *entry) { GetList(entry)->Unlink(entry); }
+  virtual void Clear() {
+    volatile_.Reset();
+    regular_.Reset();
+  }
+  virtual Entry *First() const {
+    return volatile_.IsEmpty() ? regular_.Front() : volatile_.Front();
+  }
+  virtual Entry *Next(const Entry *entry) const {
+    if (entry->next == &volatile_.head)
+      return regular_.Front();
+    return (entry->next == &regular_.head) ? NULL : entry->next;
+  }
+
+ private:
+  List *GetList(const Entry *entry) {
+    return entry->IsVolatile() ? &volatile_ : &regular_;
+  }
+
+  List volatile_;
+  List regular_;
+};
+
+
+/**
+ * Regular entries are either on probation or protected.  New entries start on
+ * probation; an access to an entry moves it to the end of the protected list.
+ * If the protected entries take more than kProtectedShare percent of the
+ * regular entries' size, the least recently used protected entries are moved
+ * back to the end of the probation list.  Probationary entries are evicted
+ * before protected ones.
+ *
+ * Entries loaded from the cache catalog are treated as protected, so that the
+ * most recently used files stay protected across restarts.
+ */
+class QuotaPolicySlru : public QuotaPolicy {
+ public:
+  static const unsigned kProtectedShare = 80;
+
+  virtual Type type() const { return kPolicySlru; }
+  virtual void Insert(Entry *entry);
+  virtual void Promote(Entry *entry);
+  virtual void Load(Entry *entry) { Promote(entry); }
+  virtual void Remove(Entry *entry);
+  virtual void Clear() {
+    volatile_.Reset();
+    probation_.Reset();
+    protected_.Reset();
+  }
+  virtual Entry *First() const;
+  virtual Entry *Next(const Entry *entry) const;
+
+  uint64_t size_probation() const { return probation_.size; }
+  uint64_t size_protected() const { return protected_.size; }
+
+ private:
+  enum Segment {
+    kSegmentVolatile = 0,
+    kSegmentProbation,
+    kSegmentProtected,
+  };
+
+  List *GetList(const Entry *entry) {
+    switch (entry->segment) {
+      case kSegmentProbation: return &probation_;
+      case kSegmentProtected: return &protected_;
+      default: return &volatile_;
+    }
+  }
+  void Demote();
+
+  List volatile_;
+  List probation_;
+  List protected_;
+};
+
+#endif  // CVMFS_QUOTA_POLICY_H_
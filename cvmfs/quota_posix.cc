@@ -5,8 +5,10 @@
  * This way, we are able to track access times of files in the cache
  * and remove files based on least recently used strategy.
  *
- * We setup another SQLite catalog, a "cache catalog", that helps us
- * in the bookkeeping of files, file sizes and access times.
+ * The bookkeeping of files, file sizes and access times happens in an
+ * in-memory index.  We setup another SQLite catalog, a "cache catalog", as a
+ * persistent checkpoint of the index plus a journal of the changes since the
+ * last checkpoint.
  *
  * We might choose to not manage the local cache.  This is indicated
  * by limit == 0 and everything succeeds in that case.
@@ -23,6 +25,7 @@
 #include <fcntl.h>
 #include <inttypes.h>
 #include <pthread.h>
+#include <sched.h>
 #include <signal.h>
 #include <stdint.h>
 #include <sys/dir.h>
@@ -32,7 +35,6 @@
 #endif
 #include <sys/statvfs.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
 #include <cassert>
@@ -61,6 +63,34 @@
 using namespace std;  // NOLINT
 
 
+/**
+ * Connects to the ring buffer of the shared cache manager, if it provides one.
+ * Otherwise, all commands are sent through the FIFO.
+ */
+void PosixQuotaManager::AttachRing() {
+  // The ring buffer is available as of protocol revision 3
+  if (protocol_revision_ < 3)
+    return;
+
+  const int fd = open((workspace_dir_ + "/cachemgr.ring").c_str(), O_RDONLY);
+  if (fd < 0) {
+    LogCvmfs(kLogQuota, kLogDebug, "cache manager provides no ring buffer");
+    return;
+  }
+  string name;
+  const bool retval = SafeReadToString(fd, &name);
+  close(fd);
+  if (!retval || name.empty())
+    return;
+
+  ring_ = QuotaRing::AttachShared(name);
+  if (ring_ != NULL) {
+    LogCvmfs(kLogQuota, kLogDebug, "attached to ring buffer %s",
+             name.c_str());
+  }
+}
+
+
 int PosixQuotaManager::BindReturnPipe(int pipe_wronly) {
   if (!shared_)
     return pipe_wronly;
@@ -79,6 +109,19 @@ int PosixQuotaManager::BindReturnPipe(int pipe_wronly) {
 }
 
 
+/**
+ * Called when a file is (re-)inserted into the cache.  If the file was evicted
+ * before but not yet unlinked, the unlink is skipped.  There remains a small
+ * window where the unlink thread has already picked up the file.  Like with any
+ * other missing cache file, the file is then fetched again on the next access.
+ */
+void PosixQuotaManager::CancelUnlink(const string &path) {
+  MutexLockGuard guard(&lock_unlink_);
+  if (!unlink_pending_.empty())
+    unlink_pending_.erase(path);
+}
+
+
 void PosixQuotaManager::CheckHighPinWatermark() {
   const uint64_t watermark = kHighPinWatermark*cleanup_threshold_/100;
   if ((cleanup_threshold_ > 0) && (pinned_ > watermark)) {
@@ -118,7 +161,7 @@ void PosixQuotaManager::CleanupPipes() {
 
 /**
  * Cleans up in data cache, until cache size is below leave_size.
- * The actual unlinking is done in a separate process (fork).
+ * The actual unlinking is done by the unlink thread.
  *
  * \return True on success, false otherwise
  */
@@ -143,18 +186,85 @@ bool PosixQuotaManager::Cleanup(const uint64_t leave_size) {
 }
 
 
+/**
+ * Writes the changes of the in-memory index since the last checkpoint to the
+ * cache catalog and truncates the journal.  Entries that are already in the
+ * cache catalog are updated in place, so that their description (path) does not
+ * need to be kept in memory.
+ */
+void PosixQuotaManager::Checkpoint() {
+  vector<QuotaIndex::Entry *> changed;
+  vector<shash::Any> removed;
+  index_.PopChanges(&changed, &removed);
+  if (changed.empty() && removed.empty() && (journal_.size() == 0))
+    return;
+  LogCvmfs(kLogQuota, kLogDebug, "checkpoint: %lu changed, %lu removed entries",
+           changed.size(), removed.size());
+
+  int retval = sqlite3_exec(database_, "BEGIN", NULL, NULL, NULL);
+  assert(retval == SQLITE_OK);
+
+  for (unsigned i = 0; i < removed.size(); ++i) {
+    const string hash_str = removed[i].ToString();
+    sqlite3_bind_text(stmt_rm_, 1, &hash_str[0], hash_str.length(),
+                      SQLITE_STATIC);
+    retval = sqlite3_step(stmt_rm_);
+    if ((retval != SQLITE_DONE) && (retval != SQLITE_OK)) {
+      PANIC(kLogSyslogErr, "failed to delete %s from cachedb, error %d",
+            hash_str.c_str(), retval);
+    }
+    sqlite3_reset(stmt_rm_);
+  }
+
+  for (unsigned i = 0; i < changed.size(); ++i) {
+    QuotaIndex::Entry *entry = changed[i];
+    const string hash_str = entry->hash.ToString();
+    sqlite3_stmt *stmt = (entry->description != NULL) ? stmt_new_
+                                                      : stmt_update_;
+    sqlite3_bind_text(stmt, 1, &hash_str[0], hash_str.length(), SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 2, entry->size);
+    sqlite3_bind_int64(stmt, 3, entry->seq);
+    sqlite3_bind_int64(stmt, 4, entry->type);
+    sqlite3_bind_int64(stmt, 5, entry->pinned ? 1 : 0);
+    if (entry->description != NULL) {
+      sqlite3_bind_text(stmt, 6, entry->description->data(),
+                        entry->description->length(), SQLITE_STATIC);
+    }
+    retval = sqlite3_step(stmt);
+    if ((retval != SQLITE_DONE) && (retval != SQLITE_OK)) {
+      PANIC(kLogSyslogErr, "failed to write %s to cachedb, error %d",
+            hash_str.c_str(), retval);
+    }
+    sqlite3_reset(stmt);
+    delete entry->description;
+    entry->description = NULL;
+  }
+
+  retval = sqlite3_exec(database_, "COMMIT", NULL, NULL, NULL);
+  if (retval != SQLITE_OK) {
+    PANIC(kLogSyslogErr, "failed to commit to cachedb, error %d", retval);
+  }
+  if (journal_.IsOpen())
+    journal_.Truncate();
+}
+
+
 void PosixQuotaManager::CloseDatabase() {
+  if (database_) {
+    Checkpoint();
+    if (journal_.IsOpen()) {
+      journal_.Close();
+      unlink((cache_dir_ + "/cachedb.lru").c_str());
+    }
+  }
+  index_.Clear();
+
   if (stmt_list_catalogs_) sqlite3_finalize(stmt_list_catalogs_);
   if (stmt_list_pinned_) sqlite3_finalize(stmt_list_pinned_);
   if (stmt_list_volatile_) sqlite3_finalize(stmt_list_volatile_);
   if (stmt_list_) sqlite3_finalize(stmt_list_);
-  if (stmt_lru_) sqlite3_finalize(stmt_lru_);
   if (stmt_rm_) sqlite3_finalize(stmt_rm_);
-  if (stmt_size_) sqlite3_finalize(stmt_size_);
-  if (stmt_touch_) sqlite3_finalize(stmt_touch_);
-  if (stmt_unpin_) sqlite3_finalize(stmt_unpin_);
-  if (stmt_block_) sqlite3_finalize(stmt_block_);
-  if (stmt_unblock_) sqlite3_finalize(stmt_unblock_);
+  if (stmt_update_) sqlite3_finalize(stmt_update_);
   if (stmt_new_) sqlite3_finalize(stmt_new_);
   if (database_) sqlite3_close(database_);
   UnlockFile(fd_lock_cachedb_);
@@ -164,11 +274,7 @@ void PosixQuotaManager::CloseDatabase() {
   stmt_list_volatile_ = NULL;
   stmt_list_ = NULL;
   stmt_rm_ = NULL;
-  stmt_size_ = NULL;
-  stmt_touch_ = NULL;
-  stmt_unpin_ = NULL;
-  stmt_block_ = NULL;
-  stmt_unblock_ = NULL;
+  stmt_update_ = NULL;
   stmt_new_ = NULL;
   database_ = NULL;
 
@@ -186,14 +292,20 @@ void PosixQuotaManager::CloseReturnPipe(int pipe[2]) {
 }
 
 
-bool PosixQuotaManager::Contains(const string &hash_str) {
-  bool result = false;
+QuotaManager::EvictionStatistics
+PosixQuotaManager::CollectEvictionStatistics()
+{
+  EvictionStatistics result = eviction_stats_;
+  MutexLockGuard guard(&lock_unlink_);
+  result.n_unlink = n_unlink_;
+  result.n_unlink_pending = unlink_pending_.size();
+  return result;
+}
+
 
-  sqlite3_bind_text(stmt_size_, 1, &hash_str[0], hash_str.length(),
-                    SQLITE_STATIC);
-  if (sqlite3_step(stmt_size_) == SQLITE_ROW)
-    result = true;
-  sqlite3_reset(stmt_size_);
+bool PosixQuotaManager::Contains(const string &hash_str) {
+  const bool result =
+    index_.Lookup(shash::MkFromHexPtr(shash::HexPtr(hash_str))) != NULL;
   LogCvmfs(kLogQuota, kLogDebug, "contains %s returns %d",
            hash_str.c_str(), result);
 
@@ -231,7 +343,8 @@ PosixQuotaManager *PosixQuotaManager::Create(
   const string &cache_workspace,
   const uint64_t limit,
   const uint64_t cleanup_threshold,
-  const bool rebuild_database)
+  const bool rebuild_database,
+  const QuotaPolicy::Type policy)
 {
   if (cleanup_threshold >= limit) {
     LogCvmfs(kLogQuota, kLogDebug, "invalid parameters: limit %" PRIu64 ", "
@@ -241,6 +354,7 @@ PosixQuotaManager *PosixQuotaManager::Create(
 
   PosixQuotaManager *quota_manager =
     new PosixQuotaManager(limit, cleanup_threshold, cache_workspace);
+  quota_manager->index_.SetPolicy(QuotaPolicy::Create(policy));
 
   // Initialize cache catalog
   if (!quota_manager->InitDatabase(rebuild_database)) {
@@ -249,6 +363,9 @@ PosixQuotaManager *PosixQuotaManager::Create(
   }
   quota_manager->CheckFreeSpace();
   MakePipe(quota_manager->pipe_lru_);
+  // Without the ring, commands go through the pipe
+  quota_manager->ring_ =
+    QuotaRing::CreateAnonymous(QuotaRing::kDefaultCapacity);
 
   quota_manager->protocol_revision_ = kProtocolRevision;
   quota_manager->initialized_ = true;
@@ -264,7 +381,8 @@ PosixQuotaManager *PosixQuotaManager::CreateShared(
   const std::string &cache_workspace,
   const uint64_t limit,
   const uint64_t cleanup_threshold,
-  bool foreground)
+  bool foreground,
+  const QuotaPolicy::Type policy)
 {
   string cache_dir;
   string workspace_dir;
@@ -300,6 +418,7 @@ PosixQuotaManager *PosixQuotaManager::CreateShared(
       quota_mgr->protocol_revision_ = quota_mgr->GetProtocolRevision();
       LogCvmfs(kLogQuota, kLogDebug, "connected protocol revision %u",
                quota_mgr->protocol_revision_);
+      quota_mgr->AttachRing();
     } else {
       LogCvmfs(kLogQuota, kLogDebug, "connected to ancient cache manager");
     }
@@ -351,6 +470,7 @@ PosixQuotaManager *PosixQuotaManager::CreateShared(
   command_line.push_back(StringifyInt(GetLogSyslogLevel()));
   command_line.push_back(StringifyInt(GetLogSyslogFacility()));
   command_line.push_back(GetLogDebugFile() + ":" + GetLogMicroSyslog());
+  command_line.push_back(QuotaPolicy::GetTypeName(policy));
 
   set<int> preserve_filedes;
   preserve_filedes.insert(0);
@@ -417,10 +537,48 @@ PosixQuotaManager *PosixQuotaManager::CreateShared(
   LogCvmfs(kLogQuota, kLogDebug, "received limit %" PRIu64 ", "
            "threshold %" PRIu64,
            quota_mgr->limit_, quota_mgr->cleanup_threshold_);
+  quota_mgr->AttachRing();
   return quota_mgr;
 }
 
 
+/**
+ * Creates the ring buffer of the shared cache manager.  Clients find the name
+ * of the shared memory object in the cachemgr.ring file.
+ */
+bool PosixQuotaManager::CreateRing() {
+  const string ring_path = workspace_dir_ + "/cachemgr.ring";
+  string name;
+
+  // Remove the ring buffer of a crashed cache manager
+  const int fd = open(ring_path.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    if (SafeReadToString(fd, &name) && !name.empty())
+      QuotaRing::UnlinkShared(name);
+    close(fd);
+    unlink(ring_path.c_str());
+  }
+
+  name = "/cvmfs.cachemgr." + StringifyInt(getpid());
+  QuotaRing::UnlinkShared(name);
+  ring_ = QuotaRing::CreateShared(name, QuotaRing::kDefaultCapacity);
+  if (ring_ == NULL) {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+             "failed to create ring buffer, clients use the FIFO only");
+    return false;
+  }
+  if (!SafeWriteToFile(name, ring_path, 0600)) {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+             "failed to publish ring buffer (%d)", errno);
+    delete ring_;
+    ring_ = NULL;
+    return false;
+  }
+  LogCvmfs(kLogQuota, kLogDebug, "created ring buffer %s", name.c_str());
+  return true;
+}
+
+
 bool PosixQuotaManager::DoCleanup(const uint64_t leave_size) {
   if (gauge_ <= leave_size)
     return true;
@@ -430,91 +588,32 @@ bool PosixQuotaManager::DoCleanup(const uint64_t leave_size) {
            "clean up cache until at most %lu KB is used", leave_size/1024);
   LogCvmfs(kLogQuota, kLogDebug, "gauge %" PRIu64, gauge_);
   cleanup_recorder_.Tick();
+  eviction_stats_.n_cleanup++;
 
-  bool result;
-  string hash_str;
   vector<string> trash;
 
-  do {
-    sqlite3_reset(stmt_lru_);
-    if (sqlite3_step(stmt_lru_) != SQLITE_ROW) {
-      LogCvmfs(kLogQuota, kLogDebug, "could not get lru-entry");
-      break;
-    }
-
-    hash_str = string(reinterpret_cast<const char *>(
-                      sqlite3_column_text(stmt_lru_, 0)));
-    LogCvmfs(kLogQuota, kLogDebug, "removing %s", hash_str.c_str());
-    shash::Any hash = shash::MkFromHexPtr(shash::HexPtr(hash_str));
+  QuotaIndex::Entry *entry = index_.First();
+  while ((entry != NULL) && (gauge_ > leave_size)) {
+    QuotaIndex::Entry *next = index_.Next(entry);
 
     // That's a critical condition.  We must not delete a not yet inserted
     // pinned file as it is already reserved (but will be inserted later).
-    // Instead, set the pin bit in the db to not run into an endless loop
-    if (pinned_chunks_.find(hash) == pinned_chunks_.end()) {
-      trash.push_back(cache_dir_ + "/" + hash.MakePathWithoutSuffix());
-      gauge_ -= sqlite3_column_int64(stmt_lru_, 1);
+    // Instead, skip it during this cleanup run
+    if (pinned_chunks_.find(entry->hash) == pinned_chunks_.end()) {
+      trash.push_back(cache_dir_ + "/" + entry->hash.MakePathWithoutSuffix());
+      gauge_ -= entry->size;
+      eviction_stats_.n_evict++;
+      eviction_stats_.sz_evict += entry->size;
       LogCvmfs(kLogQuota, kLogDebug, "lru cleanup %s, new gauge %" PRIu64,
-               hash_str.c_str(), gauge_);
-
-      sqlite3_bind_text(stmt_rm_, 1, &hash_str[0], hash_str.length(),
-                        SQLITE_STATIC);
-      result = (sqlite3_step(stmt_rm_) == SQLITE_DONE);
-      sqlite3_reset(stmt_rm_);
-
-      if (!result) {
-        LogCvmfs(kLogQuota, kLogDebug | kLogSyslogErr,
-                 "failed to find %s in cache database (%d). "
-                 "Cache database is out of sync. "
-                 "Restart cvmfs with clean cache.", hash_str.c_str(), result);
-        return false;
-      }
-    } else {
-      sqlite3_bind_text(stmt_block_, 1, &hash_str[0], hash_str.length(),
-                        SQLITE_STATIC);
-      result = (sqlite3_step(stmt_block_) == SQLITE_DONE);
-      sqlite3_reset(stmt_block_);
-      assert(result);
-    }
-  } while (gauge_ > leave_size);
-
-  result = (sqlite3_step(stmt_unblock_) == SQLITE_DONE);
-  sqlite3_reset(stmt_unblock_);
-  assert(result);
-
-  // Double fork avoids zombie, forked removal process must not flush file
-  // buffers
-  if (!trash.empty()) {
-    if (async_delete_) {
-      pid_t pid;
-      int statloc;
-      if ((pid = fork()) == 0) {
-        // TODO(jblomer): eviciting files in the cache should perhaps become a
-        // thread.  This would also allow to block the chunks and prevent the
-        // race with re-insertion.  Then again, a thread can block umount.
-#ifndef DEBUGMSG
-        CloseAllFildes(std::set<int>());
-#endif
-        if (fork() == 0) {
-          for (unsigned i = 0, iEnd = trash.size(); i < iEnd; ++i) {
-            LogCvmfs(kLogQuota, kLogDebug, "unlink %s", trash[i].c_str());
-            unlink(trash[i].c_str());
-          }
-          _exit(0);
-        }
-        _exit(0);
-      } else {
-        if (pid > 0)
-          waitpid(pid, &statloc, 0);
-        else
-          return false;
-      }
-    } else {  // !async_delete_
-      for (unsigned i = 0, iEnd = trash.size(); i < iEnd; ++i) {
-        LogCvmfs(kLogQuota, kLogDebug, "unlink %s", trash[i].c_str());
-        unlink(trash[i].c_str());
-      }
+               entry->hash.ToString().c_str(), gauge_);
+      journal_.AppendRemove(entry->hash);
+      index_.Remove(entry->hash);
     }
+    entry = next;
   }
+  // Make the removals persistent before the files are gone
+  FlushJournal();
+  Unlink(trash);
 
   if (gauge_ > leave_size) {
     LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
@@ -547,7 +646,7 @@ void PosixQuotaManager::DoInsert(
   cmd->desc_length = desc_length;
   memcpy(reinterpret_cast<char *>(cmd)+sizeof(LruCommand),
          &description[0], desc_length);
-  WritePipe(pipe_lru_[1], cmd, sizeof(LruCommand) + desc_length);
+  SendCommand(cmd, sizeof(LruCommand) + desc_length);
 }
 
 
@@ -577,6 +676,37 @@ vector<string> PosixQuotaManager::DoList(const CommandType list_command) {
 }
 
 
+/**
+ * Removes an entry from the index, e.g. on manual removal.  Also releases the
+ * pin, if the entry is pinned.
+ */
+void PosixQuotaManager::DoRemove(const shash::Any &hash) {
+  QuotaIndex::Entry *entry = index_.Lookup(hash);
+  if (entry == NULL)
+    return;
+
+  gauge_ -= entry->size;
+  map<shash::Any, uint64_t>::iterator iter = pinned_chunks_.find(hash);
+  if (iter != pinned_chunks_.end()) {
+    pinned_ -= iter->second;
+    pinned_chunks_.erase(iter);
+  }
+  journal_.AppendRemove(hash);
+  index_.Remove(hash);
+  FlushJournal();
+}
+
+
+/**
+ * Writes the buffered journal records.  Triggers a checkpoint if the journal
+ * grew too large or if it could not be written.
+ */
+void PosixQuotaManager::FlushJournal() {
+  if (!journal_.Flush() || (journal_.size() > kJournalCheckpointSize))
+    Checkpoint();
+}
+
+
 uint64_t PosixQuotaManager::GetCapacity() {
   if (limit_ != (uint64_t)(-1))
     return limit_;
@@ -685,6 +815,32 @@ uint64_t PosixQuotaManager::GetSizePinned() {
 }
 
 
+QuotaManager::EvictionStatistics PosixQuotaManager::GetEvictionStatistics() {
+  if (!spawned_) return CollectEvictionStatistics();
+  if (protocol_revision_ < 4) return EvictionStatistics();
+
+  EvictionStatistics result;
+  int pipe_stats[2];
+  MakeReturnPipe(pipe_stats);
+  LruCommand cmd;
+  cmd.command_type = kEvictionStatistics;
+  cmd.return_pipe = pipe_stats[1];
+  WritePipe(pipe_lru_[1], &cmd, sizeof(cmd));
+  ReadHalfPipe(pipe_stats[0], &result, sizeof(result));
+  CloseReturnPipe(pipe_stats);
+  return result;
+}
+
+
+/**
+ * Inserts that would fill the cache beyond this size trigger a cleanup.
+ */
+uint64_t PosixQuotaManager::GetHighWatermark() const {
+  return cleanup_threshold_ +
+         (limit_ - cleanup_threshold_) / 100 * kHighWatermark;
+}
+
+
 uint64_t PosixQuotaManager::GetCleanupRate(uint64_t period_s) {
   if (!spawned_ || (protocol_revision_ < 2)) return 0;
   uint64_t cleanup_rate;
@@ -714,6 +870,7 @@ bool PosixQuotaManager::InitDatabase(const bool rebuild_database) {
   }
 
   bool retry = false;
+  bool rebuilt = false;
   const string db_file = cache_dir_ + "/cachedb";
   if (rebuild_database) {
     LogCvmfs(kLogQuota, kLogDebug, "rebuild database, unlinking existing (%s)",
@@ -798,6 +955,7 @@ bool PosixQuotaManager::InitDatabase(const bool rebuild_database) {
     if ((sqlite3_column_int64(stmt, 0)) == 0 || rebuild_database) {
       LogCvmfs(kLogCvmfs, kLogDebug,
                "CernVM-FS: building lru cache database...");
+      rebuilt = true;
       if (!RebuildDatabase()) {
         LogCvmfs(kLogQuota, kLogDebug,
                  "could not build cache database from file system");
@@ -812,55 +970,18 @@ bool PosixQuotaManager::InitDatabase(const bool rebuild_database) {
     goto init_database_fail;
   }
 
-  // How many bytes do we already have in cache?
-  sql = "SELECT sum(size) FROM cache_catalog;";
-  sqlite3_prepare_v2(database_, sql.c_str(), -1, &stmt, NULL);
-  if (sqlite3_step(stmt) == SQLITE_ROW) {
-    gauge_ = sqlite3_column_int64(stmt, 0);
-  } else {
-    LogCvmfs(kLogQuota, kLogDebug, "could not determine cache size");
-    sqlite3_finalize(stmt);
-    goto init_database_fail;
-  }
-  sqlite3_finalize(stmt);
-
-  // Highest seq-no?
-  sql = "SELECT coalesce(max(acseq & (~(1<<63))), 0) FROM cache_catalog;";
-  sqlite3_prepare_v2(database_, sql.c_str(), -1, &stmt, NULL);
-  if (sqlite3_step(stmt) == SQLITE_ROW) {
-    seq_ = sqlite3_column_int64(stmt, 0)+1;
-  } else {
-    LogCvmfs(kLogQuota, kLogDebug, "could not determine highest seq-no");
-    sqlite3_finalize(stmt);
-    goto init_database_fail;
-  }
-  sqlite3_finalize(stmt);
-
-  // Prepare touch, new, remove statements
-  sqlite3_prepare_v2(database_,
-                     "UPDATE cache_catalog SET acseq=:seq | (acseq&(1<<63)) "
-                     "WHERE sha1=:sha1;", -1, &stmt_touch_, NULL);
-  sqlite3_prepare_v2(database_, "UPDATE cache_catalog SET pinned=0 "
-                     "WHERE sha1=:sha1;", -1, &stmt_unpin_, NULL);
-  sqlite3_prepare_v2(database_, "UPDATE cache_catalog SET pinned=2 "
-                     "WHERE sha1=:sha1;", -1, &stmt_block_, NULL);
-  sqlite3_prepare_v2(database_, "UPDATE cache_catalog SET pinned=1 "
-                     "WHERE pinned=2;", -1, &stmt_unblock_, NULL);
+  // Prepare checkpoint and list statements
   sqlite3_prepare_v2(database_,
                      "INSERT OR REPLACE INTO cache_catalog "
-                     "(sha1, size, acseq, path, type, pinned) "
-                     "VALUES (:sha1, :s, :seq, :p, :t, :pin);",
+                     "(sha1, size, acseq, type, pinned, path) "
+                     "VALUES (:sha1, :s, :seq, :t, :pin, :p);",
                      -1, &stmt_new_, NULL);
+  // Same parameter positions as stmt_new_
   sqlite3_prepare_v2(database_,
-                     "SELECT size, pinned FROM cache_catalog WHERE sha1=:sha1;",
-                     -1, &stmt_size_, NULL);
+                     "UPDATE cache_catalog SET size=?2, acseq=?3, type=?4, "
+                     "pinned=?5 WHERE sha1=?1;", -1, &stmt_update_, NULL);
   sqlite3_prepare_v2(database_, "DELETE FROM cache_catalog WHERE sha1=:sha1;",
                      -1, &stmt_rm_, NULL);
-  sqlite3_prepare_v2(database_,
-                     "SELECT sha1, size FROM cache_catalog WHERE "
-                     "acseq=(SELECT min(acseq) "
-                     "FROM cache_catalog WHERE pinned<>2);",
-                     -1, &stmt_lru_, NULL);
   sqlite3_prepare_v2(database_,
                      ("SELECT path FROM cache_catalog WHERE type=" +
                       StringifyInt(kFileRegular) +
@@ -875,6 +996,32 @@ bool PosixQuotaManager::InitDatabase(const bool rebuild_database) {
                      ("SELECT path FROM cache_catalog WHERE type=" +
                       StringifyInt(kFileCatalog) +
                       ";").c_str(), -1, &stmt_list_catalogs_, NULL);
+
+  if (!LoadIndex()) {
+    LogCvmfs(kLogQuota, kLogDebug, "could not load cache database");
+    CloseDatabase();
+    return false;
+  }
+
+  // Recover the changes that did not make it into the cache catalog.  A
+  // journal that does not fit to a freshly built cache catalog is discarded.
+  // Without journal, changes are only written on checkpoints.
+  if (journal_.Open(cache_dir_ + "/cachedb.lru")) {
+    if (rebuilt)
+      journal_.Truncate();
+    else
+      journal_.Replay(&index_);
+  }
+
+  // How many bytes do we already have in cache?  Highest seq-no?
+  gauge_ = 0;
+  for (QuotaIndex::Entry *entry = index_.First(); entry != NULL;
+       entry = index_.Next(entry))
+  {
+    gauge_ += entry->size;
+  }
+  seq_ = index_.max_seq() + 1;
+  Checkpoint();
   return true;
 
  init_database_fail:
@@ -944,6 +1091,37 @@ vector<string> PosixQuotaManager::ListVolatile() {
 }
 
 
+/**
+ * Fills the in-memory index from the cache catalog.
+ */
+bool PosixQuotaManager::LoadIndex() {
+  index_.Clear();
+
+  sqlite3_stmt *stmt;
+  sqlite3_prepare_v2(database_,
+                     "SELECT sha1, size, acseq, type FROM cache_catalog "
+                     "ORDER BY acseq;", -1, &stmt, NULL);
+  int retval;
+  while ((retval = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const string hash_str(
+      reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+    if (!shash::HexPtr(hash_str).IsValid()) {
+      LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+               "ignoring invalid entry %s in cache database", hash_str.c_str());
+      continue;
+    }
+    index_.Load(shash::MkFromHexPtr(shash::HexPtr(hash_str)),
+                sqlite3_column_int64(stmt, 1),
+                sqlite3_column_int64(stmt, 2),
+                sqlite3_column_int(stmt, 3));
+  }
+  sqlite3_finalize(stmt);
+  LogCvmfs(kLogQuota, kLogDebug, "loaded %u entries from cache database",
+           index_.size());
+  return retval == SQLITE_DONE;
+}
+
+
 /**
  * Entry point for the shared cache manager process
  */
@@ -976,6 +1154,14 @@ int PosixQuotaManager::MainCacheManager(int argc, char **argv) {
   if (logfiles.size() > 1)
     SetLogMicroSyslog(logfiles[1]);
 
+  // Older clients do not pass the replacement policy
+  QuotaPolicy::Type policy = QuotaPolicy::kPolicyLru;
+  if ((argc > 11) && !QuotaPolicy::ParseType(argv[11], &policy)) {
+    LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+             "unknown cache replacement policy %s, using LRU", argv[11]);
+  }
+  shared_manager.index_.SetPolicy(QuotaPolicy::Create(policy));
+
   if (!foreground)
     Daemonize();
 
@@ -1041,6 +1227,9 @@ int PosixQuotaManager::MainCacheManager(int argc, char **argv) {
     return 1;
   }
 
+  // Clients fall back to the FIFO if the ring cannot be created
+  shared_manager.CreateRing();
+
   const string fifo_path = shared_manager.workspace_dir_ + "/cachemgr";
   shared_manager.pipe_lru_[0] = open(fifo_path.c_str(), O_RDONLY | O_NONBLOCK);
   if (shared_manager.pipe_lru_[0] < 0) {
@@ -1065,9 +1254,14 @@ int PosixQuotaManager::MainCacheManager(int argc, char **argv) {
   // Don't let Ctrl-C ungracefully kill interactive session
   signal(SIGINT, SIG_IGN);
 
+  shared_manager.SpawnUnlinker();
   shared_manager.MainCommandServer(&shared_manager);
+  shared_manager.StopUnlinker();
   unlink(fifo_path.c_str());
   unlink(protocol_revision_path.c_str());
+  unlink((shared_manager.workspace_dir_ + "/cachemgr.ring").c_str());
+  delete shared_manager.ring_;
+  shared_manager.ring_ = NULL;
   shared_manager.CloseDatabase();
   unlink(crash_guard.c_str());
   UnlockFile(fd_lockfile_fifo);
@@ -1091,22 +1285,14 @@ void *PosixQuotaManager::MainCommandServer(void *data) {
   char description_buffer[kCommandBufferSize*kMaxDescription];
   unsigned num_commands = 0;
 
-  while (read(quota_mgr->pipe_lru_[0], &command_buffer[num_commands],
-              sizeof(command_buffer[0])) == sizeof(command_buffer[0]))
+  while (quota_mgr->ReadCommand(
+           &command_buffer[num_commands],
+           &description_buffer[kMaxDescription*num_commands]))
   {
     const CommandType command_type = command_buffer[num_commands].command_type;
     LogCvmfs(kLogQuota, kLogDebug, "received command %d", command_type);
     const uint64_t size = command_buffer[num_commands].GetSize();
 
-    // Inserts and pins come with a description (usually a path)
-    if ((command_type == kInsert) || (command_type == kInsertVolatile) ||
-        (command_type == kPin) || (command_type == kPinRegular))
-    {
-      const int desc_length = command_buffer[num_commands].desc_length;
-      ReadPipe(quota_mgr->pipe_lru_[0],
-               &description_buffer[kMaxDescription*num_commands], desc_length);
-    }
-
     // The protocol revision is returned immediately
     if (command_type == kGetProtocolRevision) {
       int return_pipe =
@@ -1132,6 +1318,18 @@ void *PosixQuotaManager::MainCommandServer(void *data) {
       continue;
     }
 
+    // The eviction statistics are returned immediately
+    if (command_type == kEvictionStatistics) {
+      int return_pipe =
+        quota_mgr->BindReturnPipe(command_buffer[num_commands].return_pipe);
+      if (return_pipe < 0)
+        continue;
+      const EvictionStatistics stats = quota_mgr->CollectEvictionStatistics();
+      WritePipe(return_pipe, &stats, sizeof(stats));
+      quota_mgr->UnbindReturnPipe(return_pipe);
+      continue;
+    }
+
     // Reservations are handled immediately and "out of band"
     if (command_type == kReserve) {
       bool success = true;
@@ -1237,23 +1435,7 @@ void *PosixQuotaManager::MainCommandServer(void *data) {
           LogCvmfs(kLogQuota, kLogDebug,
                    "remove orphaned pinned hash %s from cache database",
                    hash_str.c_str());
-          sqlite3_bind_text(quota_mgr->stmt_size_, 1, &hash_str[0],
-                            hash_str.length(), SQLITE_STATIC);
-          int retval;
-          if ((retval = sqlite3_step(quota_mgr->stmt_size_)) == SQLITE_ROW) {
-            uint64_t size = sqlite3_column_int64(quota_mgr->stmt_size_, 0);
-            sqlite3_bind_text(quota_mgr->stmt_rm_, 1, &(hash_str[0]),
-                              hash_str.length(), SQLITE_STATIC);
-            retval = sqlite3_step(quota_mgr->stmt_rm_);
-            if ((retval == SQLITE_DONE) || (retval == SQLITE_OK)) {
-              quota_mgr->gauge_ -= size;
-            } else {
-              LogCvmfs(kLogQuota, kLogDebug | kLogSyslogErr,
-                       "failed to delete %s (%d)", hash_str.c_str(), retval);
-            }
-            sqlite3_reset(quota_mgr->stmt_rm_);
-          }
-          sqlite3_reset(quota_mgr->stmt_size_);
+          quota_mgr->DoRemove(hash);
         }
       } else {
         LogCvmfs(kLogQuota, kLogDebug, "this chunk was not pinned");
@@ -1292,35 +1474,9 @@ void *PosixQuotaManager::MainCommandServer(void *data) {
           const string hash_str = hash.ToString();
           LogCvmfs(kLogQuota, kLogDebug, "manually removing %s",
                    hash_str.c_str());
-          bool success = false;
-
-          sqlite3_bind_text(quota_mgr->stmt_size_, 1, &hash_str[0],
-                            hash_str.length(), SQLITE_STATIC);
-          int retval;
-          if ((retval = sqlite3_step(quota_mgr->stmt_size_)) == SQLITE_ROW) {
-            uint64_t size = sqlite3_column_int64(quota_mgr->stmt_size_, 0);
-            uint64_t is_pinned = sqlite3_column_int64(quota_mgr->stmt_size_, 1);
-
-            sqlite3_bind_text(quota_mgr->stmt_rm_, 1, &(hash_str[0]),
-                              hash_str.length(), SQLITE_STATIC);
-            retval = sqlite3_step(quota_mgr->stmt_rm_);
-            if ((retval == SQLITE_DONE) || (retval == SQLITE_OK)) {
-              success = true;
-              quota_mgr->gauge_ -= size;
-              if (is_pinned) {
-                quota_mgr->pinned_chunks_.erase(hash);
-                quota_mgr->pinned_ -= size;
-              }
-            } else {
-              LogCvmfs(kLogQuota, kLogDebug | kLogSyslogErr,
-                       "failed to delete %s (%d)", hash_str.c_str(), retval);
-            }
-            sqlite3_reset(quota_mgr->stmt_rm_);
-          } else {
-            // File does not exist
-            success = true;
-          }
-          sqlite3_reset(quota_mgr->stmt_size_);
+          // If the file does not exist, removal succeeds as well
+          quota_mgr->DoRemove(hash);
+          bool success = true;
 
           WritePipe(return_pipe, &success, sizeof(success));
           break; }
@@ -1337,6 +1493,9 @@ void *PosixQuotaManager::MainCommandServer(void *data) {
         case kListVolatile:
           if (!this_stmt_list) this_stmt_list = quota_mgr->stmt_list_volatile_;
 
+          // Listings are served from the cache catalog
+          quota_mgr->Checkpoint();
+
           // Pipe back the list, one by one
           int length;
           while (sqlite3_step(this_stmt_list) == SQLITE_ROW) {
@@ -1397,6 +1556,55 @@ void *PosixQuotaManager::MainCommandServer(void *data) {
 }
 
 
+/**
+ * Removes the files evicted by cleanups.  Pending unlinks are finished before
+ * the thread terminates, otherwise the files would stay in the cache without
+ * being accounted for.
+ */
+void *PosixQuotaManager::MainUnlinker(void *data) {
+  PosixQuotaManager *quota_mgr = static_cast<PosixQuotaManager *>(data);
+  LogCvmfs(kLogQuota, kLogDebug, "starting unlink thread");
+
+  vector<string> batch;
+  while (true) {
+    {
+      MutexLockGuard guard(&quota_mgr->lock_unlink_);
+      while (quota_mgr->unlink_queue_.empty() && !quota_mgr->unlinker_stop_) {
+        int retval = pthread_cond_wait(&quota_mgr->cond_unlink_,
+                                       &quota_mgr->lock_unlink_);
+        assert(retval == 0);
+      }
+      if (quota_mgr->unlink_queue_.empty())
+        break;
+      while (!quota_mgr->unlink_queue_.empty() &&
+             (batch.size() < kUnlinkBatchSize))
+      {
+        const string path = quota_mgr->unlink_queue_.front();
+        quota_mgr->unlink_queue_.pop_front();
+        // Skip files that got re-inserted in the meantime
+        set<string>::iterator iter = quota_mgr->unlink_pending_.find(path);
+        if (iter == quota_mgr->unlink_pending_.end())
+          continue;
+        quota_mgr->unlink_pending_.erase(iter);
+        batch.push_back(path);
+      }
+    }
+
+    for (unsigned i = 0; i < batch.size(); ++i) {
+      LogCvmfs(kLogQuota, kLogDebug, "unlink %s", batch[i].c_str());
+      unlink(batch[i].c_str());
+    }
+
+    MutexLockGuard guard(&quota_mgr->lock_unlink_);
+    quota_mgr->n_unlink_ += batch.size();
+    batch.clear();
+  }
+
+  LogCvmfs(kLogQuota, kLogDebug, "stopping unlink thread");
+  return NULL;
+}
+
+
 void PosixQuotaManager::MakeReturnPipe(int pipe[2]) {
   if (!shared_) {
     MakePipe(pipe);
@@ -1472,24 +1680,18 @@ bool PosixQuotaManager::Pin(
         CheckHighPinWatermark();
       }
     }
-    bool exists = Contains(hash_str);
+    bool exists = (index_.Lookup(hash) != NULL);
     if (!exists && (gauge_ + size > limit_)) {
       LogCvmfs(kLogQuota, kLogDebug, "over limit, gauge %lu, file size %lu",
                gauge_, size);
       int retval = DoCleanup(cleanup_threshold_);
       assert(retval != 0);
     }
-    sqlite3_bind_text(stmt_new_, 1, &hash_str[0], hash_str.length(),
-                      SQLITE_STATIC);
-    sqlite3_bind_int64(stmt_new_, 2, size);
-    sqlite3_bind_int64(stmt_new_, 3, seq_++);
-    sqlite3_bind_text(stmt_new_, 4, &description[0], description.length(),
-                      SQLITE_STATIC);
-    sqlite3_bind_int64(stmt_new_, 5, is_catalog ? kFileCatalog : kFileRegular);
-    sqlite3_bind_int64(stmt_new_, 6, 1);
-    int retval = sqlite3_step(stmt_new_);
-    assert((retval == SQLITE_DONE) || (retval == SQLITE_OK));
-    sqlite3_reset(stmt_new_);
+    const int type = is_catalog ? kFileCatalog : kFileRegular;
+    index_.Insert(hash, size, seq_, description, type, true);
+    journal_.AppendInsert(hash, size, seq_, description, type);
+    seq_++;
+    FlushJournal();
     if (!exists) gauge_ += size;
     return true;
   }
@@ -1527,16 +1729,16 @@ PosixQuotaManager::PosixQuotaManager(
   , seq_(0)
   , cache_dir_()  // initialized in body
   , workspace_dir_()  // initialized in body
+  , ring_(NULL)
+  , pipe_state_(kPipeIdle)
   , fd_lock_cachedb_(-1)
   , async_delete_(true)
+  , unlinker_running_(false)
+  , unlinker_stop_(false)
+  , n_unlink_(0)
   , database_(NULL)
-  , stmt_touch_(NULL)
-  , stmt_unpin_(NULL)
-  , stmt_block_(NULL)
-  , stmt_unblock_(NULL)
   , stmt_new_(NULL)
-  , stmt_lru_(NULL)
-  , stmt_size_(NULL)
+  , stmt_update_(NULL)
   , stmt_rm_(NULL)
   , stmt_list_(NULL)
   , stmt_list_pinned_(NULL)
@@ -1546,6 +1748,10 @@ PosixQuotaManager::PosixQuotaManager(
 {
   ParseDirectories(cache_workspace, &cache_dir_, &workspace_dir_);
   pipe_lru_[0] = pipe_lru_[1] = -1;
+  int retval = pthread_mutex_init(&lock_unlink_, NULL);
+  assert(retval == 0);
+  retval = pthread_cond_init(&cond_unlink_, NULL);
+  assert(retval == 0);
   cleanup_recorder_.AddRecorder(1, 90);  // last 1.5 min with second resolution
   // last 1.5 h with minute resolution
   cleanup_recorder_.AddRecorder(60, 90*60);
@@ -1557,24 +1763,30 @@ PosixQuotaManager::PosixQuotaManager(
 
 
 PosixQuotaManager::~PosixQuotaManager() {
-  if (!initialized_) return;
-
-  if (shared_) {
+  if (!initialized_) {
+    delete ring_;
+  } else if (shared_) {
     // Most of cleanup is done elsewhen by shared cache manager
     close(pipe_lru_[1]);
-    return;
-  }
-
-  if (spawned_) {
-    char fin = 0;
-    WritePipe(pipe_lru_[1], &fin, 1);
-    close(pipe_lru_[1]);
-    pthread_join(thread_lru_, NULL);
+    delete ring_;
   } else {
-    ClosePipe(pipe_lru_);
+    if (spawned_) {
+      char fin = 0;
+      WritePipe(pipe_lru_[1], &fin, 1);
+      close(pipe_lru_[1]);
+      pthread_join(thread_lru_, NULL);
+    } else {
+      ClosePipe(pipe_lru_);
+    }
+    // The quota manager thread might have queued unlinks until it stopped
+    StopUnlinker();
+    delete ring_;
+
+    CloseDatabase();
   }
 
-  CloseDatabase();
+  pthread_cond_destroy(&cond_unlink_);
+  pthread_mutex_destroy(&lock_unlink_);
 }
 
 
@@ -1583,95 +1795,172 @@ void PosixQuotaManager::ProcessCommandBunch(
   const LruCommand *commands,
   const char *descriptions)
 {
-  int retval = sqlite3_exec(database_, "BEGIN", NULL, NULL, NULL);
-  assert(retval == SQLITE_OK);
-
   for (unsigned i = 0; i < num; ++i) {
     const shash::Any hash = commands[i].RetrieveHash();
-    const string hash_str = hash.ToString();
     const unsigned size = commands[i].GetSize();
     LogCvmfs(kLogQuota, kLogDebug, "processing %s (%d)",
-             hash_str.c_str(), commands[i].command_type);
+             hash.ToString().c_str(), commands[i].command_type);
 
     bool exists;
+    uint64_t seq;
+    int type;
+    bool is_pinned;
     switch (commands[i].command_type) {
       case kTouch:
-        sqlite3_bind_int64(stmt_touch_, 1, seq_++);
-        sqlite3_bind_text(stmt_touch_, 2, &hash_str[0], hash_str.length(),
-                          SQLITE_STATIC);
-        retval = sqlite3_step(stmt_touch_);
-        LogCvmfs(kLogQuota, kLogDebug, "touching %s (%ld): %d",
-                 hash_str.c_str(), seq_-1, retval);
-        if ((retval != SQLITE_DONE) && (retval != SQLITE_OK)) {
-          PANIC(kLogSyslogErr, "failed to update %s in cachedb, error %d",
-                hash_str.c_str(), retval);
-        }
-        sqlite3_reset(stmt_touch_);
+        seq = seq_++;
+        if (index_.Touch(hash, seq))
+          journal_.AppendTouch(hash, seq);
+        LogCvmfs(kLogQuota, kLogDebug, "touching %s (%" PRIu64 ")",
+                 hash.ToString().c_str(), seq);
         break;
       case kUnpin:
-        sqlite3_bind_text(stmt_unpin_, 1, &hash_str[0], hash_str.length(),
-                          SQLITE_STATIC);
-        retval = sqlite3_step(stmt_unpin_);
-        LogCvmfs(kLogQuota, kLogDebug, "unpinning %s: %d",
-                 hash_str.c_str(), retval);
-        if ((retval != SQLITE_DONE) && (retval != SQLITE_OK)) {
-          PANIC(kLogSyslogErr, "failed to unpin %s in cachedb, error %d",
-                hash_str.c_str(), retval);
-        }
-        sqlite3_reset(stmt_unpin_);
+        // Pins are not journaled, they are reset on restart anyway
+        index_.SetPinned(hash, false);
+        LogCvmfs(kLogQuota, kLogDebug, "unpinning %s",
+                 hash.ToString().c_str());
         break;
       case kPin:
       case kPinRegular:
       case kInsert:
-      case kInsertVolatile:
+      case kInsertVolatile: {
         // It could already be in, check
-        exists = Contains(hash_str);
+        exists = (index_.Lookup(hash) != NULL);
 
-        // Cleanup, move to trash and unlink
-        if (!exists && (gauge_ + size > limit_)) {
-          LogCvmfs(kLogQuota, kLogDebug, "over limit, gauge %lu, file size %lu",
-                   gauge_, size);
-          retval = DoCleanup(cleanup_threshold_);
+        // Cleanup ahead of demand once the high watermark is reached.  If the
+        // insert hits the limit, the clients of the quota manager stall.
+        if (!exists && (gauge_ + size > GetHighWatermark()) &&
+            (gauge_ > cleanup_threshold_))
+        {
+          const bool is_stall = (gauge_ + size > limit_);
+          LogCvmfs(kLogQuota, kLogDebug, "over %s, gauge %lu, file size %lu",
+                   is_stall ? "limit" : "high watermark", gauge_, size);
+          const uint64_t start_ns = platform_monotonic_time_ns();
+          int retval = DoCleanup(cleanup_threshold_);
           assert(retval != 0);
+          if (is_stall) {
+            eviction_stats_.n_stall++;
+            eviction_stats_.stall_time_ns +=
+              platform_monotonic_time_ns() - start_ns;
+          } else {
+            eviction_stats_.n_cleanup_early++;
+          }
         }
+        if (!exists)
+          CancelUnlink(cache_dir_ + "/" + hash.MakePathWithoutSuffix());
 
         // Insert or replace
-        sqlite3_bind_text(stmt_new_, 1, &hash_str[0], hash_str.length(),
-                          SQLITE_STATIC);
-        sqlite3_bind_int64(stmt_new_, 2, size);
-        if (commands[i].command_type == kInsertVolatile) {
-          sqlite3_bind_int64(stmt_new_, 3, (seq_++) | kVolatileFlag);
-        } else {
-          sqlite3_bind_int64(stmt_new_, 3, seq_++);
-        }
-        sqlite3_bind_text(stmt_new_, 4, &descriptions[i*kMaxDescription],
-                          commands[i].desc_length, SQLITE_STATIC);
-        sqlite3_bind_int64(stmt_new_, 5, (commands[i].command_type == kPin) ?
-                           kFileCatalog : kFileRegular);
-        sqlite3_bind_int64(stmt_new_, 6,
-          ((commands[i].command_type == kPin) ||
-           (commands[i].command_type == kPinRegular)) ? 1 : 0);
-        retval = sqlite3_step(stmt_new_);
-        LogCvmfs(kLogQuota, kLogDebug, "insert or replace %s, method %d: %d",
-                 hash_str.c_str(), commands[i].command_type, retval);
-        if ((retval != SQLITE_DONE) && (retval != SQLITE_OK)) {
-          PANIC(kLogSyslogErr, "failed to insert %s in cachedb, error %d",
-                hash_str.c_str(), retval);
-        }
-        sqlite3_reset(stmt_new_);
+        seq = seq_++;
+        if (commands[i].command_type == kInsertVolatile)
+          seq |= kVolatileFlag;
+        type = (commands[i].command_type == kPin) ? kFileCatalog : kFileRegular;
+        is_pinned = (commands[i].command_type == kPin) ||
+                    (commands[i].command_type == kPinRegular);
+        const string description(&descriptions[i*kMaxDescription],
+                                 commands[i].desc_length);
+        index_.Insert(hash, size, seq, description, type, is_pinned);
+        journal_.AppendInsert(hash, size, seq, description, type);
+        LogCvmfs(kLogQuota, kLogDebug, "insert or replace %s, method %d",
+                 hash.ToString().c_str(), commands[i].command_type);
 
         if (!exists) gauge_ += size;
         break;
+      }
       default:
         // other types should have been taken care of by event loop
         PANIC(NULL);
     }
   }
 
-  retval = sqlite3_exec(database_, "COMMIT", NULL, NULL, NULL);
-  if (retval != SQLITE_OK) {
-    PANIC(kLogSyslogErr, "failed to commit to cachedb, error %d", retval);
+  FlushJournal();
+}
+
+
+/**
+ * Gets the next command for the quota manager thread resp. process.  Commands
+ * from the ring buffer are preferred.  A command from the pipe is only handed
+ * out once the ring buffer is drained, so that the commands a client put into
+ * the ring before it wrote to the pipe are processed first.  Returns false
+ * once the pipe is closed.
+ */
+bool PosixQuotaManager::ReadCommand(LruCommand *cmd, char *description) {
+  if (ring_ == NULL)
+    return ReadPipeCommand(cmd, description);
+
+  unsigned char message[QuotaRing::kMaxMessageSize];
+  unsigned size;
+  uint64_t stall_start = 0;
+  while (true) {
+    const QuotaRing::PopResult result = ring_->Pop(message, &size);
+    if (result == QuotaRing::kPopOk) {
+      if (size < sizeof(LruCommand)) {
+        LogCvmfs(kLogQuota, kLogDebug | kLogSyslogWarn,
+                 "ignoring truncated command in ring buffer");
+        continue;
+      }
+      memcpy(cmd, message, sizeof(LruCommand));
+      if (cmd->desc_length > size - sizeof(LruCommand))
+        cmd->desc_length = size - sizeof(LruCommand);
+      memcpy(description, message + sizeof(LruCommand), cmd->desc_length);
+      return true;
+    }
+
+    if (result == QuotaRing::kPopPending) {
+      // A client is about to publish the command, unless it stalled or died
+      const uint64_t now = platform_monotonic_time_ns();
+      if (stall_start == 0)
+        stall_start = now;
+      if (now - stall_start > kRingStallTimeoutMs * 1000000ULL) {
+        if (ring_->SkipPending()) {
+          LogCvmfs(kLogQuota, kLogDebug,
+                   "skipped stalled command in ring buffer");
+        }
+        stall_start = 0;
+      } else if (now - stall_start > 1000000ULL) {
+        SafeSleepMs(1);
+      } else {
+        sched_yield();
+      }
+      continue;
+    }
+    stall_start = 0;
+
+    // The ring buffer is empty
+    if (pipe_state_ == kPipeCommand) {
+      *cmd = pipe_command_;
+      memcpy(description, pipe_description_, cmd->desc_length);
+      pipe_state_ = kPipeIdle;
+      return true;
+    }
+    if (pipe_state_ == kPipeClosed)
+      return false;
+
+    // Sleep on the pipe.  Clients ring the doorbell after their next push.
+    ring_->ArmDoorbell();
+    if (!ring_->IsEmpty()) {
+      ring_->DisarmDoorbell();
+      continue;
+    }
+    if (!ReadPipeCommand(&pipe_command_, pipe_description_))
+      pipe_state_ = kPipeClosed;
+    else if (pipe_command_.command_type != kRingDoorbell)
+      pipe_state_ = kPipeCommand;
+    ring_->DisarmDoorbell();
+  }
+}
+
+
+bool PosixQuotaManager::ReadPipeCommand(LruCommand *cmd, char *description) {
+  if (read(pipe_lru_[0], cmd, sizeof(LruCommand)) != sizeof(LruCommand))
+    return false;
+
+  // Inserts and pins come with a description (usually a path)
+  const CommandType command_type = cmd->command_type;
+  if ((command_type == kInsert) || (command_type == kInsertVolatile) ||
+      (command_type == kPin) || (command_type == kPinRegular))
+  {
+    ReadPipe(pipe_lru_[0], description, cmd->desc_length);
   }
+  return true;
 }
 
 
@@ -1856,10 +2145,37 @@ void PosixQuotaManager::Remove(const shash::Any &hash) {
 }
 
 
+/**
+ * Sends a command that does not expect a reply.  The ring buffer is preferred
+ * over the pipe.  If the quota manager sleeps, it needs to be woken up through
+ * the pipe.
+ */
+void PosixQuotaManager::SendCommand(const LruCommand *cmd, const unsigned size)
+{
+  if (ring_ != NULL) {
+    for (unsigned i = 0; i < kRingPushRetries; ++i) {
+      if (ring_->TryPush(cmd, size)) {
+        if (ring_->TakeDoorbell()) {
+          LruCommand doorbell;
+          doorbell.command_type = kRingDoorbell;
+          WritePipe(pipe_lru_[1], &doorbell, sizeof(doorbell));
+        }
+        return;
+      }
+      // The ring buffer is full, let the quota manager catch up
+      sched_yield();
+    }
+  }
+  WritePipe(pipe_lru_[1], cmd, size);
+}
+
+
 void PosixQuotaManager::Spawn() {
   if (spawned_)
     return;
 
+  if (async_delete_)
+    SpawnUnlinker();
   if (pthread_create(&thread_lru_, NULL, MainCommandServer,
       static_cast<void *>(this)) != 0)
   {
@@ -1870,6 +2186,36 @@ void PosixQuotaManager::Spawn() {
 }
 
 
+void PosixQuotaManager::SpawnUnlinker() {
+  assert(!unlinker_running_);
+  unlinker_stop_ = false;
+  if (pthread_create(&thread_unlink_, NULL, MainUnlinker,
+      static_cast<void *>(this)) != 0)
+  {
+    PANIC(kLogDebug, "could not create unlink thread");
+  }
+  unlinker_running_ = true;
+}
+
+
+/**
+ * Waits for the pending unlinks to finish.
+ */
+void PosixQuotaManager::StopUnlinker() {
+  if (!unlinker_running_)
+    return;
+
+  {
+    MutexLockGuard guard(&lock_unlink_);
+    unlinker_stop_ = true;
+    int retval = pthread_cond_signal(&cond_unlink_);
+    assert(retval == 0);
+  }
+  pthread_join(thread_unlink_, NULL);
+  unlinker_running_ = false;
+}
+
+
 /**
  * Updates the sequence number of the file specified by the hash.
  */
@@ -1877,7 +2223,7 @@ void PosixQuotaManager::Touch(const shash::Any &hash) {
   LruCommand cmd;
   cmd.command_type = kTouch;
   cmd.StoreHash(hash);
-  WritePipe(pipe_lru_[1], &cmd, sizeof(cmd));
+  SendCommand(&cmd, sizeof(cmd));
 }
 
 
@@ -1887,6 +2233,34 @@ void PosixQuotaManager::UnbindReturnPipe(int pipe_wronly) {
 }
 
 
+/**
+ * Hands the paths of evicted files to the unlink thread.  Without the unlink
+ * thread, the files are removed synchronously.
+ */
+void PosixQuotaManager::Unlink(const vector<string> &paths) {
+  if (paths.empty())
+    return;
+
+  if (!async_delete_ || !unlinker_running_) {
+    for (unsigned i = 0, iEnd = paths.size(); i < iEnd; ++i) {
+      LogCvmfs(kLogQuota, kLogDebug, "unlink %s", paths[i].c_str());
+      unlink(paths[i].c_str());
+    }
+    MutexLockGuard guard(&lock_unlink_);
+    n_unlink_ += paths.size();
+    return;
+  }
+
+  MutexLockGuard guard(&lock_unlink_);
+  for (unsigned i = 0, iEnd = paths.size(); i < iEnd; ++i) {
+    unlink_queue_.push_back(paths[i]);
+    unlink_pending_.insert(paths[i]);
+  }
+  int retval = pthread_cond_signal(&cond_unlink_);
+  assert(retval == 0);
+}
+
+
 void PosixQuotaManager::UnlinkReturnPipe(int pipe_wronly) {
   if (shared_)
     unlink((workspace_dir_ + "/pipe" + StringifyInt(pipe_wronly)).c_str());
@@ -1899,7 +2273,7 @@ void PosixQuotaManager::Unpin(const shash::Any &hash) {
   LruCommand cmd;
   cmd.command_type = kUnpin;
   cmd.StoreHash(hash);
-  WritePipe(pipe_lru_[1], &cmd, sizeof(cmd));
+  SendCommand(&cmd, sizeof(cmd));
 }
 
 
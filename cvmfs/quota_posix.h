@@ -10,7 +10,9 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <deque>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -18,6 +20,9 @@
 #include "duplex_sqlite3.h"
 #include "gtest/gtest_prod.h"
 #include "quota.h"
+#include "quota_index.h"
+#include "quota_policy.h"
+#include "quota_ring.h"
 #include "statistics.h"
 #include "util/single_copy.h"
 #include "util/string.h"
@@ -27,14 +32,26 @@ class Recorder;
 }
 
 /**
- * Works with the PosixCacheManager.  Uses an SQlite database for cache contents
- * tracking.  Tracking is asynchronously.
+ * Works with the PosixCacheManager.  Cache contents are tracked asynchronously
+ * in an in-memory LRU index.  The SQlite cache catalog serves as a checkpoint
+ * of the index, changes since the last checkpoint are recorded in a journal.
+ *
+ * Commands are sent through a pipe (exclusive manager) or a FIFO (shared
+ * manager).  Commands that do not expect a reply (touch, insert, pin, unpin)
+ * are preferably sent through a ring buffer in shared memory, which saves a
+ * system call per command.  The pipe then only serves to wake up the quota
+ * manager.
+ *
+ * Cleanup starts ahead of demand at a high watermark below the limit.  The
+ * evicted files are unlinked in batches by a separate thread, so that the quota
+ * manager does not block on the file system while clients wait for it.
  *
  * TODO(jblomer): split into client, server, and protocol classes.
  */
 class PosixQuotaManager : public QuotaManager {
   FRIEND_TEST(T_QuotaManager, BindReturnPipe);
   FRIEND_TEST(T_QuotaManager, Cleanup);
+  FRIEND_TEST(T_QuotaManager, CleanupAsync);
   FRIEND_TEST(T_QuotaManager, Contains);
   FRIEND_TEST(T_QuotaManager, InitDatabase);
   FRIEND_TEST(T_QuotaManager, MakeReturnPipe);
@@ -42,13 +59,15 @@ class PosixQuotaManager : public QuotaManager {
  public:
   static PosixQuotaManager *Create(const std::string &cache_workspace,
     const uint64_t limit, const uint64_t cleanup_threshold,
-    const bool rebuild_database);
+    const bool rebuild_database,
+    const QuotaPolicy::Type policy = QuotaPolicy::kPolicyLru);
   static PosixQuotaManager *CreateShared(
     const std::string &exe_path,
     const std::string &cache_workspace,
     const uint64_t limit,
     const uint64_t cleanup_threshold,
-    bool foreground);
+    bool foreground,
+    const QuotaPolicy::Type policy = QuotaPolicy::kPolicyLru);
   static int MainCacheManager(int argc, char **argv);
 
   virtual ~PosixQuotaManager();
@@ -79,6 +98,7 @@ class PosixQuotaManager : public QuotaManager {
   virtual uint64_t GetSize();
   virtual uint64_t GetSizePinned();
   virtual uint64_t GetCleanupRate(uint64_t period_s);
+  virtual EvictionStatistics GetEvictionStatistics();
 
   virtual void Spawn();
   virtual pid_t GetPid();
@@ -118,6 +138,20 @@ class PosixQuotaManager : public QuotaManager {
     // as of protocol revision 2
     kListVolatile,
     kCleanupRate,
+    // as of protocol revision 3
+    kRingDoorbell,
+    // as of protocol revision 4
+    kEvictionStatistics,
+  };
+
+  /**
+   * Command that the quota manager read from the pipe while it was draining
+   * the ring buffer
+   */
+  enum PipeState {
+    kPipeIdle = 0,
+    kPipeCommand,
+    kPipeClosed,
   };
 
   /**
@@ -180,10 +214,16 @@ class PosixQuotaManager : public QuotaManager {
 
   /**
    * Collect a number of insert and touch operations before processing them
-   * as sqlite commands.
+   * and writing them to the journal.
    */
   static const unsigned kCommandBufferSize = 32;
 
+  /**
+   * Write the changes of the in-memory index to the cache catalog once the
+   * journal exceeds this size.
+   */
+  static const uint64_t kJournalCheckpointSize = 16 * 1024 * 1024;
+
   /**
    * Make sure that the amount of data transferred through the RPC pipe is
    * within the OS's guarantees for atomicity.
@@ -196,18 +236,50 @@ class PosixQuotaManager : public QuotaManager {
    */
   static const unsigned kHighPinWatermark = 75;
 
+  /**
+   * Number of attempts to push to a full ring buffer before the command is
+   * sent through the pipe instead.
+   */
+  static const unsigned kRingPushRetries = 16;
+
+  /**
+   * A reserved slot in the ring buffer that is not published within this time
+   * is skipped.  A client that lost its slot sends the command through the
+   * pipe instead.
+   */
+  static const unsigned kRingStallTimeoutMs = 10;
+
+  /**
+   * Cleanup starts when an insert would fill the cache beyond this percentage
+   * of the range between the cleanup threshold and the limit.  Only inserts
+   * that hit the limit itself are counted as stalls.
+   */
+  static const unsigned kHighWatermark = 90;
+
+  /**
+   * Maximum number of files that the unlink thread removes before it picks up
+   * new work from the queue.
+   */
+  static const unsigned kUnlinkBatchSize = 64;
+
   /**
    * The last bit in the sequence number indicates if an entry is volatile.
    * Such sequence numbers are negative and they are preferred during cleanup.
    * Volatile entries are used for instance for ALICE conditions data.
    */
-  static const uint64_t kVolatileFlag = 1ULL << 63;
+  static const uint64_t kVolatileFlag = QuotaIndex::kVolatileFlag;
 
   bool InitDatabase(const bool rebuild_database);
   bool RebuildDatabase();
+  bool LoadIndex();
+  void Checkpoint();
+  void FlushJournal();
   void CloseDatabase();
   bool Contains(const std::string &hash_str);
   bool DoCleanup(const uint64_t leave_size);
+  uint64_t GetHighWatermark() const;
+  EvictionStatistics CollectEvictionStatistics();
+  void DoRemove(const shash::Any &hash);
 
   void MakeReturnPipe(int pipe[2]);
   int BindReturnPipe(int pipe_wronly);
@@ -218,10 +290,20 @@ class PosixQuotaManager : public QuotaManager {
 
   void CheckFreeSpace();
   void CheckHighPinWatermark();
+  bool CreateRing();
+  void AttachRing();
+  void SendCommand(const LruCommand *cmd, const unsigned size);
+  bool ReadCommand(LruCommand *cmd, char *description);
+  bool ReadPipeCommand(LruCommand *cmd, char *description);
   void ProcessCommandBunch(const unsigned num,
                            const LruCommand *commands,
                            const char *descriptions);
   static void *MainCommandServer(void *data);
+  void SpawnUnlinker();
+  void StopUnlinker();
+  void Unlink(const std::vector<std::string> &paths);
+  void CancelUnlink(const std::string &path);
+  static void *MainUnlinker(void *data);
 
   void DoInsert(const shash::Any &hash, const uint64_t size,
                 const std::string &description, const CommandType command_type);
@@ -295,6 +377,20 @@ class PosixQuotaManager : public QuotaManager {
    */
   int pipe_lru_[2];
 
+  /**
+   * Optional shared memory channel for commands that do not expect a reply.
+   * NULL if not available, e.g. with an older shared cache manager.
+   */
+  QuotaRing *ring_;
+
+  /**
+   * Used by the quota manager to defer a command from the pipe until the ring
+   * buffer is drained.
+   */
+  PipeState pipe_state_;
+  LruCommand pipe_command_;
+  char pipe_description_[kMaxDescription];
+
   /**
    * In exclusive mode, controls the quota manager thread.
    */
@@ -307,24 +403,51 @@ class PosixQuotaManager : public QuotaManager {
 
   /**
    * If this is true, the unlink operations that correspond to a cleanup run
-   * will be performed in a detached, asynchronous process.
+   * will be performed asynchronously by the unlink thread.
    */
   bool async_delete_;
 
+  /**
+   * The unlink thread works on the paths of evicted files in unlink_queue_.
+   * A path that is re-inserted before it is unlinked is taken out of
+   * unlink_pending_ and then skipped by the unlink thread.  The queue and the
+   * counter are protected by lock_unlink_.
+   */
+  pthread_t thread_unlink_;
+  pthread_mutex_t lock_unlink_;
+  pthread_cond_t cond_unlink_;
+  bool unlinker_running_;
+  bool unlinker_stop_;
+  std::deque<std::string> unlink_queue_;
+  std::set<std::string> unlink_pending_;
+  uint64_t n_unlink_;
+
+  /**
+   * Cleanup counters, only modified by the quota manager thread resp. process.
+   * The unlink counters are taken from the unlink thread on request.
+   */
+  EvictionStatistics eviction_stats_;
+
   /**
    * Keeps track of the number of cleanups over time.  Use by
    * `cvmfs_talk cleanup rate`
    */
   perf::MultiRecorder cleanup_recorder_;
 
+  /**
+   * Cache contents in eviction order.  Only accessed by the quota manager
+   * thread resp. process (or by the main thread before spawning).
+   */
+  QuotaIndex index_;
+
+  /**
+   * Changes to index_ since the last checkpoint to the cache catalog.
+   */
+  QuotaJournal journal_;
+
   sqlite3 *database_;
-  sqlite3_stmt *stmt_touch_;
-  sqlite3_stmt *stmt_unpin_;
-  sqlite3_stmt *stmt_block_;
-  sqlite3_stmt *stmt_unblock_;
   sqlite3_stmt *stmt_new_;
-  sqlite3_stmt *stmt_lru_;
-  sqlite3_stmt *stmt_size_;
+  sqlite3_stmt *stmt_update_;
   sqlite3_stmt *stmt_rm_;
   sqlite3_stmt *stmt_list_;
   sqlite3_stmt *stmt_list_pinned_;  /**< Loaded catalogs are pinned. */
@@ -0,0 +1,239 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "quota_ring.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstring>
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+using namespace std;  // NOLINT
+
+
+QuotaRing::QuotaRing(
+  void *mapping,
+  const size_t mapping_size,
+  const string &name,
+  const bool is_owner)
+  : mapping_(mapping)
+  , mapping_size_(mapping_size)
+  , header_(reinterpret_cast<Header *>(mapping))
+  , slots_(reinterpret_cast<Slot *>(
+      reinterpret_cast<char *>(mapping) + sizeof(Header)))
+  , capacity_(0)
+  , name_(name)
+  , is_owner_(is_owner)
+{ }
+
+
+QuotaRing::~QuotaRing() {
+  munmap(mapping_, mapping_size_);
+  if (is_owner_ && !name_.empty())
+    UnlinkShared(name_);
+}
+
+
+void QuotaRing::Format(const unsigned capacity) {
+  memset(header_, 0, sizeof(Header));
+  header_->capacity = capacity;
+  header_->max_message_size = kMaxMessageSize;
+  for (unsigned i = 0; i < capacity; ++i)
+    slots_[i].seq = i;
+  capacity_ = capacity;
+  header_->version = kVersion;
+  // Written last, the ring is usable once the magic number is visible
+  atomic_write32(reinterpret_cast<atomic_int32 *>(&header_->magic), kMagic);
+}
+
+
+QuotaRing *QuotaRing::CreateAnonymous(const unsigned capacity) {
+  if (!IsValidCapacity(capacity))
+    return NULL;
+  const size_t size = GetMappingSize(capacity);
+  void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    LogCvmfs(kLogQuota, kLogDebug, "failed to map anonymous ring (%d)", errno);
+    return NULL;
+  }
+  QuotaRing *ring = new QuotaRing(mapping, size, "", true);
+  ring->Format(capacity);
+  return ring;
+}
+
+
+/**
+ * Creates a new named ring.  Fails if the shared memory object already exists.
+ */
+QuotaRing *QuotaRing::CreateShared(const string &name, const unsigned capacity)
+{
+  if (!IsValidCapacity(capacity))
+    return NULL;
+  const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    LogCvmfs(kLogQuota, kLogDebug, "failed to create shared memory %s (%d)",
+             name.c_str(), errno);
+    return NULL;
+  }
+  const size_t size = GetMappingSize(capacity);
+  if (ftruncate(fd, size) != 0) {
+    LogCvmfs(kLogQuota, kLogDebug, "failed to resize shared memory %s (%d)",
+             name.c_str(), errno);
+    close(fd);
+    shm_unlink(name.c_str());
+    return NULL;
+  }
+  void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    LogCvmfs(kLogQuota, kLogDebug, "failed to map shared memory %s (%d)",
+             name.c_str(), errno);
+    shm_unlink(name.c_str());
+    return NULL;
+  }
+  QuotaRing *ring = new QuotaRing(mapping, size, name, true);
+  ring->Format(capacity);
+  return ring;
+}
+
+
+QuotaRing *QuotaRing::AttachShared(const string &name) {
+  const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    LogCvmfs(kLogQuota, kLogDebug, "failed to open shared memory %s (%d)",
+             name.c_str(), errno);
+    return NULL;
+  }
+  platform_stat64 info;
+  if ((platform_fstat(fd, &info) != 0) ||
+      (static_cast<size_t>(info.st_size) < GetMappingSize(1)))
+  {
+    LogCvmfs(kLogQuota, kLogDebug, "invalid shared memory %s", name.c_str());
+    close(fd);
+    return NULL;
+  }
+  const size_t size = info.st_size;
+  void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    LogCvmfs(kLogQuota, kLogDebug, "failed to map shared memory %s (%d)",
+             name.c_str(), errno);
+    return NULL;
+  }
+
+  QuotaRing *ring = new QuotaRing(mapping, size, name, false);
+  const Header *header = ring->header_;
+  const uint32_t magic = atomic_read32(
+    reinterpret_cast<atomic_int32 *>(&ring->header_->magic));
+  if ((magic != kMagic) || (header->version != kVersion) ||
+      (header->max_message_size != kMaxMessageSize) ||
+      !IsValidCapacity(header->capacity) ||
+      (GetMappingSize(header->capacity) != size))
+  {
+    LogCvmfs(kLogQuota, kLogDebug, "incompatible ring in shared memory %s",
+             name.c_str());
+    delete ring;
+    return NULL;
+  }
+  ring->capacity_ = header->capacity;
+  return ring;
+}
+
+
+void QuotaRing::UnlinkShared(const string &name) {
+  shm_unlink(name.c_str());
+}
+
+
+/**
+ * Returns false if the ring is full or if the consumer skipped or abandoned the
+ * slot in the meantime (see SkipPending()).  In all cases, the message needs to
+ * be sent through a different channel.
+ */
+bool QuotaRing::TryPush(const void *message, const unsigned size) {
+  assert(size <= kMaxMessageSize);
+  int64_t pos = atomic_read64(&header_->head);
+  Slot *slot;
+  while (true) {
+    slot = GetSlot(pos);
+    const int64_t seq = atomic_read64(&slot->seq);
+    if (seq == pos) {
+      if (atomic_cas64(&header_->head, pos, pos + 1))
+        break;
+      pos = atomic_read64(&header_->head);
+    } else if (seq < pos) {
+      return false;
+    } else {
+      pos = atomic_read64(&header_->head);
+    }
+  }
+
+  // From here on, the slot is not handed to another producer before we are done
+  if (!atomic_cas64(&slot->seq, pos, ~pos))
+    return false;
+  slot->size = size;
+  memcpy(slot->message, message, size);
+  if (atomic_cas64(&slot->seq, ~pos, pos + 1))
+    return true;
+  // The consumer abandoned the slot, hand it over to the next producer
+  atomic_cas64(&slot->seq, ~(pos + capacity_), pos + capacity_);
+  return false;
+}
+
+
+/**
+ * Only called by the single consumer.  The message buffer needs to hold
+ * kMaxMessageSize bytes.
+ */
+QuotaRing::PopResult QuotaRing::Pop(void *message, unsigned *size) {
+  const int64_t pos = atomic_read64(&header_->tail);
+  Slot *slot = GetSlot(pos);
+  const int64_t seq = atomic_read64(&slot->seq);
+  if (seq != pos + 1) {
+    return (atomic_read64(&header_->head) == pos) ? kPopEmpty : kPopPending;
+  }
+
+  *size = (slot->size <= kMaxMessageSize) ? slot->size : kMaxMessageSize;
+  memcpy(message, slot->message, *size);
+  atomic_cas64(&slot->seq, pos + 1, pos + capacity_);
+  atomic_inc64(&header_->tail);
+  return kPopOk;
+}
+
+
+/**
+ * Moves the consumer past a slot that was reserved but not published.  A
+ * reserved slot that the producer did not yet start to write is handed back to
+ * the producers right away.  A slot that is being written is abandoned; the
+ * producer hands it back once it is done writing.  In both cases, the producer
+ * notices and sends its message through a different channel.  If the producer
+ * died while writing, the slot is lost and the ring remains full.  Returns
+ * false if the slot got published in the meantime.
+ */
+bool QuotaRing::SkipPending() {
+  const int64_t pos = atomic_read64(&header_->tail);
+  if (atomic_read64(&header_->head) == pos)
+    return false;
+  Slot *slot = GetSlot(pos);
+  if (!atomic_cas64(&slot->seq, pos, pos + capacity_) &&
+      !atomic_cas64(&slot->seq, ~pos, ~(pos + capacity_)))
+  {
+    return false;
+  }
+  atomic_inc64(&header_->tail);
+  return true;
+}
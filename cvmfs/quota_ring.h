@@ -0,0 +1,158 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#ifndef CVMFS_QUOTA_RING_H_
+#define CVMFS_QUOTA_RING_H_
+
+#include <gtest/gtest_prod.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "util/atomic.h"
+#include "util/single_copy.h"
+
+/**
+ * Bounded multi-producer, single-consumer queue of fixed-size messages in
+ * shared memory.  Used by the clients of the PosixQuotaManager to send LRU
+ * commands without a system call per command.  The ring lives either in an
+ * anonymous shared mapping (exclusive quota manager, one process) or in a named
+ * POSIX shared memory object that is created by the shared quota manager and
+ * attached by the clients.
+ *
+ * Every slot carries a sequence number (D. Vyukov's bounded queue).  Producers
+ * reserve a slot by incrementing the head and publish it by advancing the
+ * slot's sequence number.  The consumer reads slots in order and hands them
+ * back to the producers.
+ *
+ * Before a producer writes into its slot, it marks the slot as being written.
+ * The consumer can take back a reserved slot from a slow producer as long as
+ * the producer has not started writing.  A slot that is being written is
+ * abandoned instead: the consumer moves on, but the slot is only handed to the
+ * next producer once the slow producer finished writing.  The slow producer
+ * then sends its message through a different channel.  Until then, the ring
+ * appears full to the producers.
+ *
+ * The ring does not block.  Instead, the consumer "arms the doorbell" before it
+ * goes to sleep on a different channel (the quota manager's FIFO).  The
+ * producer that finds the doorbell armed takes it and wakes up the consumer,
+ * similar to the semantics of an eventfd.  An eventfd itself cannot be used
+ * because there is no way to hand it to the clients through the FIFO.
+ */
+class QuotaRing : SingleCopy {
+  FRIEND_TEST(T_QuotaRing, SkipPending);
+
+ public:
+  /**
+   * Same as the maximum atomic write of an LRU command plus description to the
+   * FIFO.
+   */
+  static const unsigned kMaxMessageSize = 512;
+  static const unsigned kDefaultCapacity = 1024;
+
+  enum PopResult {
+    kPopOk = 0,
+    kPopEmpty,
+    /**
+     * A producer has reserved the next slot but not yet published it
+     */
+    kPopPending,
+  };
+
+  static QuotaRing *CreateAnonymous(const unsigned capacity);
+  static QuotaRing *CreateShared(const std::string &name,
+                                 const unsigned capacity);
+  static QuotaRing *AttachShared(const std::string &name);
+  static void UnlinkShared(const std::string &name);
+  ~QuotaRing();
+
+  bool TryPush(const void *message, const unsigned size);
+  PopResult Pop(void *message, unsigned *size);
+  bool SkipPending();
+  bool IsEmpty() {
+    return atomic_read64(&header_->head) == atomic_read64(&header_->tail);
+  }
+
+  /**
+   * Called by the consumer before it sleeps.  The consumer needs to re-check
+   * the ring afterwards.
+   */
+  void ArmDoorbell() { atomic_write32(&header_->doorbell, 1); }
+  void DisarmDoorbell() { atomic_write32(&header_->doorbell, 0); }
+  /**
+   * Called by the producer after a successful push.  Returns true if the
+   * caller needs to wake up the consumer.
+   */
+  bool TakeDoorbell() {
+    return (atomic_load32(&header_->doorbell) == 1) &&
+           atomic_cas32(&header_->doorbell, 1, 0);
+  }
+
+  unsigned capacity() const { return capacity_; }
+  const std::string &name() const { return name_; }
+
+ private:
+  static const uint32_t kMagic = 0x52515643;  // "CVQR" on little-endian
+  static const uint32_t kVersion = 3;
+
+  /**
+   * Head, tail, and the doorbell are on separate cache lines.
+   */
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t capacity;
+    uint32_t max_message_size;
+    char pad0[48];
+    atomic_int64 head;
+    char pad1[56];
+    atomic_int64 tail;
+    char pad2[56];
+    atomic_int32 doorbell;
+    char pad3[60];
+  };
+
+  /**
+   * For the slot at position pos, seq is pos if the slot is free or reserved,
+   * ~pos while the producer writes the message, and pos + 1 once the message
+   * is published.  If the consumer abandons the slot while it is written, seq
+   * becomes ~(pos + capacity), which no producer can reserve.
+   */
+  struct Slot {
+    atomic_int64 seq;
+    uint32_t size;
+    uint32_t pad;
+    unsigned char message[kMaxMessageSize];
+  };
+
+  static size_t GetMappingSize(const unsigned capacity) {
+    return sizeof(Header) + static_cast<size_t>(capacity) * sizeof(Slot);
+  }
+  static bool IsValidCapacity(const unsigned capacity) {
+    return (capacity > 0) && ((capacity & (capacity - 1)) == 0);
+  }
+
+  QuotaRing(void *mapping, const size_t mapping_size, const std::string &name,
+            const bool is_owner);
+  void Format(const unsigned capacity);
+  Slot *GetSlot(const int64_t pos) {
+    return &slots_[pos & (capacity_ - 1)];
+  }
+
+  void *mapping_;
+  size_t mapping_size_;
+  Header *header_;
+  Slot *slots_;
+  unsigned capacity_;
+  /**
+   * Name of the shared memory object, empty for anonymous rings
+   */
+  std::string name_;
+  /**
+   * The creator of a named ring removes the shared memory object
+   */
+  bool is_owner_;
+};
+
+#endif  // CVMFS_QUOTA_RING_H_
@@ -226,6 +226,10 @@ cvmfs_server_ingest() {
     ingest_command="$ingest_command -C true"
   fi
 
+  if [ "x$CVMFS_CHUNKING_ALGORITHM" != "x" ]; then
+    ingest_command="$ingest_command -G $CVMFS_CHUNKING_ALGORITHM"
+  fi
+
   if [ "x$CVMFS_PRINT_STATISTICS" = "xtrue" ]; then
     ingest_command="$ingest_command -+stats"
   fi
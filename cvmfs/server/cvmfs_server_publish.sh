@@ -231,6 +231,9 @@ cvmfs_server_publish() {
        -l $CVMFS_MIN_CHUNK_SIZE \
        -a $CVMFS_AVG_CHUNK_SIZE \
        -h $CVMFS_MAX_CHUNK_SIZE"
+      if [ "x$CVMFS_CHUNKING_ALGORITHM" != "x" ]; then
+        sync_command="$sync_command -G $CVMFS_CHUNKING_ALGORITHM"
+      fi
     fi
     if [ "x$CVMFS_AUTOCATALOGS" = "xtrue" ]; then
       sync_command="$sync_command -A"
@@ -262,6 +265,9 @@ cvmfs_server_publish() {
     if [ "x$CVMFS_NUM_UPLOAD_TASKS" != "x" ]; then
       sync_command="$sync_command -0 $CVMFS_NUM_UPLOAD_TASKS"
     fi
+    if [ "x$CVMFS_NUM_TRAVERSAL_THREADS" != "x" ]; then
+      sync_command="$sync_command -j $CVMFS_NUM_TRAVERSAL_THREADS"
+    fi
     if [ "x$manual_revision" != "x" ]; then
       sync_command="$sync_command -v $manual_revision"
     fi
@@ -159,10 +159,40 @@ void Statistics::SnapshotCounters(
 
 Counter *Statistics::Register(const string &name, const string &desc) {
   MutexLockGuard lock_guard(lock_);
+  return &NewCounterInfo(name, desc)->counter;
+}
+
+
+/**
+ * Like Register() but for counters on the hot path that are updated by many
+ * threads.  The returned counter is used like any other counter.
+ */
+Counter *Statistics::RegisterSharded(const string &name, const string &desc) {
+  MutexLockGuard lock_guard(lock_);
+  CounterInfo *counter_info = NewCounterInfo(name, desc);
+  // Plain new only guarantees the alignment of an int64
+  void *shards;
+  int retval = posix_memalign(&shards, sizeof(CounterShard),
+                              Counter::kNumShards * sizeof(CounterShard));
+  assert((retval == 0) && "Out Of Memory");
+  counter_info->counter.shards_ = static_cast<CounterShard *>(shards);
+  for (unsigned i = 0; i < Counter::kNumShards; ++i)
+    atomic_init64(&counter_info->counter.shards_[i].value);
+  return &counter_info->counter;
+}
+
+
+/**
+ * Needs to be called with lock_ held.
+ */
+Statistics::CounterInfo *Statistics::NewCounterInfo(
+  const string &name,
+  const string &desc)
+{
   assert(counters_.find(name) == counters_.end());
   CounterInfo *counter_info = new CounterInfo(desc);
   counters_[name] = counter_info;
-  return &counter_info->counter;
+  return counter_info;
 }
 
 
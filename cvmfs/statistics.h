@@ -8,11 +8,13 @@
 #include <pthread.h>
 #include <stdint.h>
 
+#include <cstdlib>
 #include <map>
 #include <string>
 #include <vector>
 
 #include "util/atomic.h"
+#include "util/platform.h"
 
 #ifdef CVMFS_NAMESPACE_GUARD
 namespace CVMFS_NAMESPACE_GUARD {
@@ -22,16 +24,57 @@ namespace CVMFS_NAMESPACE_GUARD {
 namespace perf {
 
 /**
- * A wrapper around an atomic 64bit signed integer.
+ * One slot of a sharded counter, padded to a cache line.  The slots are
+ * allocated aligned to the cache line size (see Statistics::RegisterSharded).
+ */
+struct CounterShard {
+  atomic_int64 value;
+  char padding[64 - sizeof(atomic_int64)];
+};
+
+
+/**
+ * A wrapper around an atomic 64bit signed integer.  Counters that are updated
+ * by many threads concurrently can be sharded
+ * (see Statistics::RegisterSharded).
+ * Updates of a sharded counter go to the slot of the current CPU, so that the
+ * cache line does not bounce between the cores; Get() sums up the slots.
  */
 class Counter {
+  friend class Statistics;
+
  public:
-  Counter() { atomic_init64(&counter_); }
-  void Inc() { atomic_inc64(&counter_); }
-  void Dec() { atomic_dec64(&counter_); }
-  int64_t Get() { return atomic_read64(&counter_); }
-  void Set(const int64_t val) { atomic_write64(&counter_, val); }
-  int64_t Xadd(const int64_t delta) { return atomic_xadd64(&counter_, delta); }
+  static const unsigned kNumShards = 32;
+
+  Counter() : shards_(NULL) { atomic_init64(&counter_); }
+  void Inc() { atomic_inc64(GetSlot()); }
+  void Dec() { atomic_dec64(GetSlot()); }
+  int64_t Get() {
+    int64_t result = atomic_read64(&counter_);
+    if (shards_ != NULL) {
+      for (unsigned i = 0; i < kNumShards; ++i)
+        result += atomic_read64(&shards_[i].value);
+    }
+    return result;
+  }
+  /**
+   * Concurrent updates of a sharded counter during Set() may or may not be
+   * reflected in the new value.
+   */
+  void Set(const int64_t val) {
+    if (shards_ != NULL) {
+      for (unsigned i = 0; i < kNumShards; ++i)
+        atomic_write64(&shards_[i].value, 0);
+    }
+    atomic_write64(&counter_, val);
+  }
+  /**
+   * For sharded counters, the return value is the previous value of the
+   * current CPU's slot only.  Counters whose previous value matters should
+   * not be sharded.
+   */
+  int64_t Xadd(const int64_t delta) { return atomic_xadd64(GetSlot(), delta); }
+  bool IsSharded() const { return shards_ != NULL; }
 
   std::string Print();
   std::string PrintK();
@@ -42,7 +85,18 @@ class Counter {
   std::string ToString();
 
  private:
+  atomic_int64 *GetSlot() {
+    if (shards_ == NULL)
+      return &counter_;
+    return &shards_[platform_getcpu() % kNumShards].value;
+  }
+
   atomic_int64 counter_;
+  /**
+   * Owned by the Statistics object that registered the counter.  Copies of
+   * the counter share the slots.
+   */
+  CounterShard *shards_;
 };
 
 // perf::Func(Counter) is more clear to read in the code
@@ -68,6 +122,7 @@ class Statistics {
   ~Statistics();
   Statistics *Fork();
   Counter *Register(const std::string &name, const std::string &desc);
+  Counter *RegisterSharded(const std::string &name, const std::string &desc);
   Counter *Lookup(const std::string &name) const;
   std::string LookupDesc(const std::string &name);
   std::string PrintList(const PrintOptions print_options);
@@ -83,10 +138,14 @@ class Statistics {
       atomic_init32(&refcnt);
       atomic_inc32(&refcnt);
     }
+    ~CounterInfo() { free(counter.shards_); }
     atomic_int32 refcnt;
     Counter counter;
     std::string desc;
   };
+  CounterInfo *NewCounterInfo(const std::string &name,
+                              const std::string &desc);
+
   std::map<std::string, CounterInfo *> counters_;
   mutable pthread_mutex_t *lock_;
 };
@@ -114,6 +173,12 @@ class StatisticsTemplate {
     return statistics_->Register(name_major_ + "." + name_minor, desc);
   }
 
+  Counter *RegisterShardedTemplated(const std::string &name_minor,
+                                    const std::string &desc)
+  {
+    return statistics_->RegisterSharded(name_major_ + "." + name_minor, desc);
+  }
+
   Counter *RegisterOrLookupTemplated(const std::string &name_minor,
                                      const std::string &desc)
   {
@@ -20,16 +20,19 @@
 #include <vector>
 
 #include "catalog_sql.h"
+#include "catalog_traversal_parallel.h"
 #include "compression.h"
 #include "file_chunk.h"
 #include "history_sqlite.h"
 #include "manifest.h"
 #include "network/download.h"
+#include "object_fetcher.h"
 #include "reflog.h"
 #include "sanitizer.h"
 #include "shortstring.h"
 #include "util/exception.h"
 #include "util/logging.h"
+#include "util/platform.h"
 #include "util/pointer.h"
 #include "util/posix.h"
 
@@ -49,11 +52,30 @@ namespace swissknife {
 CommandCheck::CommandCheck()
     : check_chunks_(false)
     , no_duplicates_map_(false)
-    , is_remote_(false) {
-    const shash::Any hash_null;
-    duplicates_map_.Init(16, hash_null, hasher_any);
+    , is_remote_(false)
+    , num_threads_(8)
+    , pending_batches_(kMaxPendingBatches)
+{
+  const shash::Any hash_null;
+  duplicates_map_.Init(16, hash_null, hasher_any);
+  int retval = pthread_mutex_init(&lock_duplicates_map_, NULL);
+  assert(retval == 0);
+  retval = pthread_mutex_init(&lock_inspected_catalogs_, NULL);
+  assert(retval == 0);
+  atomic_init64(&num_catalogs_);
+  atomic_init64(&num_entries_);
+  atomic_init64(&num_objects_);
+  atomic_init64(&num_missing_objects_);
 }
 
+
+CommandCheck::~CommandCheck() {
+  assert(object_checkers_.empty());
+  pthread_mutex_destroy(&lock_inspected_catalogs_);
+  pthread_mutex_destroy(&lock_duplicates_map_);
+}
+
+
 bool CommandCheck::CompareEntries(const catalog::DirectoryEntry &a,
                                   const catalog::DirectoryEntry &b,
                                   const bool compare_names,
@@ -175,6 +197,112 @@ bool CommandCheck::Exists(const string &file)
 }
 
 
+/**
+ * Returns true if the object with the given hash has not been scheduled for
+ * an existence check before.  Called concurrently by the catalog inspection.
+ */
+bool CommandCheck::NeedsObjectCheck(const shash::Any &hash) {
+  // fallback cli option can force every object to be checked
+  if (no_duplicates_map_)
+    return true;
+  MutexLockGuard guard(&lock_duplicates_map_);
+  if (duplicates_map_.Contains(hash))
+    return false;
+  duplicates_map_.Insert(hash, 1);
+  return true;
+}
+
+
+void CommandCheck::ScheduleObjectCheck(const PendingObject &object,
+                                       ObjectBatch *batch)
+{
+  batch->push_back(object);
+  if (batch->size() >= kObjectBatchSize)
+    FlushObjectBatch(batch);
+}
+
+
+/**
+ * Hands over the collected objects to the checker threads.  Blocks if the
+ * checker threads are lagging behind.
+ */
+void CommandCheck::FlushObjectBatch(ObjectBatch *batch) {
+  if (batch->empty())
+    return;
+  ObjectBatch *pending = new ObjectBatch();
+  pending->swap(*batch);
+  pending_batches_.EnqueueBack(pending);
+}
+
+
+void CommandCheck::SpawnObjectCheckers() {
+  assert(object_checkers_.empty());
+  object_checkers_.resize(num_threads_);
+  for (unsigned i = 0; i < num_threads_; ++i) {
+    int retval =
+      pthread_create(&object_checkers_[i], NULL, MainObjectChecker, this);
+    assert(retval == 0);
+  }
+}
+
+
+/**
+ * Waits until all the queued objects are checked.
+ */
+void CommandCheck::TerminateObjectCheckers() {
+  // An empty batch tells a checker thread to quit
+  for (unsigned i = 0; i < object_checkers_.size(); ++i)
+    pending_batches_.EnqueueBack(new ObjectBatch());
+  for (unsigned i = 0; i < object_checkers_.size(); ++i) {
+    int retval = pthread_join(object_checkers_[i], NULL);
+    assert(retval == 0);
+  }
+  object_checkers_.clear();
+}
+
+
+void *CommandCheck::MainObjectChecker(void *data) {
+  CommandCheck *check = reinterpret_cast<CommandCheck *>(data);
+  while (true) {
+    ObjectBatch *batch = check->pending_batches_.PopFront();
+    if (batch->empty()) {
+      delete batch;
+      break;
+    }
+    for (unsigned i = 0; i < batch->size(); ++i)
+      check->CheckObject((*batch)[i]);
+    delete batch;
+  }
+  return NULL;
+}
+
+
+void CommandCheck::CheckObject(const PendingObject &object) {
+  const int64_t num_objects = atomic_xadd64(&num_objects_, 1) + 1;
+  if ((num_objects % kObjectProgressInterval) == 0) {
+    LogCvmfs(kLogCvmfs, kLogStdout,
+             "[checked objects] %" PRId64 " (%" PRId64 " missing)",
+             num_objects, atomic_read64(&num_missing_objects_));
+  }
+  if (Exists(object.object_path))
+    return;
+
+  atomic_inc64(&num_missing_objects_);
+  if (object.is_partial) {
+    LogCvmfs(kLogCvmfs, kLogStderr, "partial data chunk %s (%s -> "
+                                    "offset: %" PRId64 " | size: %" PRIu64
+                                    ") missing",
+             object.hash.ToStringWithSuffix().c_str(),
+             object.file_path.c_str(),
+             static_cast<int64_t>(object.offset),
+             static_cast<uint64_t>(object.size));
+  } else {
+    LogCvmfs(kLogCvmfs, kLogStderr, "data chunk %s (%s) missing",
+             object.hash.ToString().c_str(), object.file_path.c_str());
+  }
+}
+
+
 /**
  * Copies a file from the repository into a temporary file.
  */
@@ -334,7 +462,8 @@ bool CommandCheck::InspectHistory(history::History *history) {
 bool CommandCheck::Find(const catalog::Catalog *catalog,
                         const PathString &path,
                         catalog::DeltaCounters *computed_counters,
-                        set<PathString> *bind_mountpoints)
+                        set<PathString> *bind_mountpoints,
+                        ObjectBatch *pending_objects)
 {
   catalog::DirectoryEntryList entries;
   catalog::DirectoryEntry this_directory;
@@ -355,17 +484,15 @@ bool CommandCheck::Find(const catalog::Catalog *catalog,
   typedef map< uint32_t, vector<catalog::DirectoryEntry> > HardlinkMap;
   HardlinkMap hardlinks;
   bool found_nested_marker = false;
+  atomic_xadd64(&num_entries_, entries.size());
 
   for (unsigned i = 0; i < entries.size(); ++i) {
     // for performance reasons, keep track of files already checked
     // and only run requests once per hash
     const bool entry_needs_check =
+          check_chunks_ &&
           !entries[i].checksum().IsNull() && !entries[i].IsExternalFile() &&
-         // fallback cli option can force the entry to be checked
-          (no_duplicates_map_ ||
-             !duplicates_map_.Contains(entries[i].checksum()));
-    if (entry_needs_check && !no_duplicates_map_)
-        duplicates_map_.Insert(entries[i].checksum(), 1);
+          NeedsObjectCheck(entries[i].checksum());
 
     PathString full_path(path);
     full_path.Append("/", 1);
@@ -403,16 +530,13 @@ bool CommandCheck::Find(const catalog::Catalog *catalog,
     }
 
     // Check if the chunk is there
-    if (check_chunks_ && entry_needs_check)
-    {
+    if (entry_needs_check) {
       string chunk_path = "data/" + entries[i].checksum().MakePath();
       if (entries[i].IsDirectory())
         chunk_path += shash::kSuffixMicroCatalog;
-      if (!Exists(chunk_path)) {
-        LogCvmfs(kLogCvmfs, kLogStderr, "data chunk %s (%s) missing",
-                 entries[i].checksum().ToString().c_str(), full_path.c_str());
-        retval = false;
-      }
+      ScheduleObjectCheck(
+        PendingObject(chunk_path, entries[i].checksum(), full_path.ToString()),
+        pending_objects);
     }
 
     // Add hardlinks to counting map
@@ -504,8 +628,11 @@ bool CommandCheck::Find(const catalog::Catalog *catalog,
         }
       } else {
         // Recurse
-        if (!Find(catalog, full_path, computed_counters, bind_mountpoints))
+        if (!Find(catalog, full_path, computed_counters, bind_mountpoints,
+                  pending_objects))
+        {
           retval = false;
+        }
       }
     } else if (entries[i].IsLink()) {
       computed_counters->self.symlinks++;
@@ -601,23 +728,13 @@ bool CommandCheck::Find(const catalog::Catalog *catalog,
           const shash::Any &chunk_hash = this_chunk.content_hash();
           // for performance reasons, only perform the check once
           // and skip if the hash has been checked before
-          bool chunk_needs_check = true;
-          if (!no_duplicates_map_ && !duplicates_map_.Contains(chunk_hash)) {
-            duplicates_map_.Insert(chunk_hash, 1);
-          } else if (!no_duplicates_map_) {
-            chunk_needs_check = false;
-          }
-          if (chunk_needs_check) {
-           const string chunk_path = "data/" + chunk_hash.MakePath();
-           if (!Exists(chunk_path)) {
-              LogCvmfs(kLogCvmfs, kLogStderr, "partial data chunk %s (%s -> "
-                                              "offset: %d | size: %d) missing",
-                       this_chunk.content_hash().ToStringWithSuffix().c_str(),
-                       full_path.c_str(),
-                       this_chunk.offset(),
-                       this_chunk.size());
-              retval = false;
-            }
+          if (NeedsObjectCheck(chunk_hash)) {
+            PendingObject object("data/" + chunk_hash.MakePath(), chunk_hash,
+                                 full_path.ToString());
+            object.is_partial = true;
+            object.offset = this_chunk.offset();
+            object.size = this_chunk.size();
+            ScheduleObjectCheck(object, pending_objects);
           }
         }
       }
@@ -772,28 +889,44 @@ bool CommandCheck::FindSubtreeRootCatalog(const string &subtree_path,
 
 
 /**
- * Recursion on nested catalog level.  No ownership of computed_counters.
+ * Traverses the catalog tree below root_path in parallel and inspects every
+ * catalog.  The results are collected in inspected_catalogs_.
  */
-bool CommandCheck::InspectTree(const string                  &path,
-                               const shash::Any              &catalog_hash,
-                               const uint64_t                 catalog_size,
-                               const bool                     is_nested_catalog,
-                               const catalog::DirectoryEntry *transition_point,
-                               catalog::DeltaCounters        *computed_counters)
+template <class ObjectFetcherT>
+bool CommandCheck::TraverseCatalogs(ObjectFetcherT *object_fetcher,
+                                    const string &root_path,
+                                    const shash::Any &root_hash)
 {
-  LogCvmfs(kLogCvmfs, kLogStdout | kLogInform, "[inspecting catalog] %s at %s",
-           catalog_hash.ToString().c_str(), path == "" ? "/" : path.c_str());
+  typedef CatalogTraversalParallel<ObjectFetcherT> Traversal;
+  typename Traversal::Parameters params;
+  params.object_fetcher = object_fetcher;
+  params.num_threads = num_threads_;
+  params.serialize_callbacks = false;
+  Traversal traversal(params);
+  traversal.RegisterListener(&CommandCheck::InspectCatalog, this);
+  return traversal.TraverseSubtree(root_hash, root_path);
+}
 
-  const catalog::Catalog *catalog = FetchCatalog(path,
-                                                 catalog_hash,
-                                                 catalog_size);
-  if (catalog == NULL) {
-    LogCvmfs(kLogCvmfs, kLogStderr, "failed to open catalog %s",
-             catalog_hash.ToString().c_str());
-    return false;
-  }
 
-  int retval = true;
+/**
+ * Verifies a single catalog.  Called concurrently for different catalogs by
+ * the catalog traversal.  Checks that need the parent catalog are deferred to
+ * InspectHierarchy().
+ */
+void CommandCheck::InspectCatalog(
+  const CatalogTraversalData<catalog::Catalog> &data)
+{
+  const catalog::Catalog *catalog = data.catalog;
+  const string path = catalog->mountpoint().ToString();
+  LogCvmfs(kLogCvmfs, kLogStdout | kLogInform, "[inspecting catalog] %s at %s",
+           data.catalog_hash.ToString().c_str(),
+           path == "" ? "/" : path.c_str());
+
+  CatalogInfo info;
+  info.hash = data.catalog_hash;
+  info.file_size = data.file_size;
+  catalog::DeltaCounters *computed_counters = &info.computed_counters;
+  bool retval = true;
 
   if (catalog->root_prefix() != PathString(path.data(), path.length())) {
     LogCvmfs(kLogCvmfs, kLogStderr, "root prefix mismatch; "
@@ -802,48 +935,29 @@ bool CommandCheck::InspectTree(const string                  &path,
     retval = false;
   }
 
-  // Check transition point
-  catalog::DirectoryEntry root_entry;
-  if (!catalog->LookupPath(catalog->root_prefix(), &root_entry)) {
+  if (!catalog->LookupPath(catalog->root_prefix(), &info.root_entry)) {
     LogCvmfs(kLogCvmfs, kLogStderr, "failed to lookup root entry (%s)",
              path.c_str());
     retval = false;
   }
-  if (!root_entry.IsDirectory()) {
+  if (!info.root_entry.IsDirectory()) {
     LogCvmfs(kLogCvmfs, kLogStderr, "root entry not a directory (%s)",
              path.c_str());
     retval = false;
   }
-  if (is_nested_catalog) {
-    if (transition_point != NULL &&
-        !CompareEntries(*transition_point, root_entry, true, true)) {
-      LogCvmfs(kLogCvmfs, kLogStderr,
-               "transition point and root entry differ (%s)", path.c_str());
-      retval = false;
-    }
-    if (!root_entry.IsNestedCatalogRoot()) {
-      LogCvmfs(kLogCvmfs, kLogStderr,
-               "nested catalog root expected but not found (%s)", path.c_str());
-      retval = false;
-    }
-  } else {
-    if (root_entry.IsNestedCatalogRoot()) {
-      LogCvmfs(kLogCvmfs, kLogStderr,
-               "nested catalog root found but not expected (%s)", path.c_str());
-      retval = false;
-    }
-  }
 
   // Traverse the catalog
   set<PathString> bind_mountpoints;
+  ObjectBatch pending_objects;
   if (!Find(catalog, PathString(path.data(), path.length()),
-            computed_counters, &bind_mountpoints))
+            computed_counters, &bind_mountpoints, &pending_objects))
   {
     retval = false;
   }
+  FlushObjectBatch(&pending_objects);
 
   // Check number of entries
-  if (root_entry.HasXattrs())
+  if (info.root_entry.HasXattrs())
     computed_counters->self.xattrs++;
   const uint64_t num_found_entries =
     1 +
@@ -857,8 +971,10 @@ bool CommandCheck::InspectTree(const string                  &path,
              catalog->GetNumEntries(), num_found_entries);
     retval = false;
   }
+  // Additionally account for root directory
+  computed_counters->self.directories++;
 
-  // Recurse into nested catalogs
+  // Collect the nested catalogs
   const catalog::Catalog::NestedCatalogList &nested_catalogs =
     catalog->ListNestedCatalogs();
   const catalog::Catalog::NestedCatalogList own_nested_catalogs =
@@ -898,34 +1014,104 @@ bool CommandCheck::InspectTree(const string                  &path,
                i->mountpoint.c_str());
       continue;
     }
-    catalog::DirectoryEntry nested_transition_point;
-    if (!catalog->LookupPath(i->mountpoint, &nested_transition_point)) {
+    NestedInfo nested;
+    if (!catalog->LookupPath(i->mountpoint, &nested.transition_point)) {
       LogCvmfs(kLogCvmfs, kLogStderr, "failed to lookup transition point %s",
                i->mountpoint.c_str());
       retval = false;
-    } else {
-      catalog::DeltaCounters nested_counters;
-      const bool is_nested = true;
-      if (!InspectTree(i->mountpoint.ToString(), i->hash, i->size, is_nested,
-                       &nested_transition_point, &nested_counters))
-        retval = false;
-      nested_counters.PopulateToParent(computed_counters);
+      continue;
     }
+    nested.path = i->mountpoint.ToString();
+    nested.hash = i->hash;
+    nested.size = i->size;
+    info.nested_catalogs.push_back(nested);
+  }
+
+  info.stored_counters = catalog->GetCounters();
+  info.is_consistent = retval;
+  {
+    MutexLockGuard guard(&lock_inspected_catalogs_);
+    inspected_catalogs_[path] = info;
+  }
+  atomic_inc64(&num_catalogs_);
+}
+
+
+/**
+ * Recursion on nested catalog level over the results of the catalog
+ * inspection.  No ownership of computed_counters.
+ */
+bool CommandCheck::InspectHierarchy(
+  const string                  &path,
+  const shash::Any              &catalog_hash,
+  const uint64_t                 catalog_size,
+  const bool                     is_nested_catalog,
+  const catalog::DirectoryEntry *transition_point,
+  catalog::DeltaCounters        *computed_counters)
+{
+  map<string, CatalogInfo>::const_iterator iter =
+    inspected_catalogs_.find(path);
+  if ((iter == inspected_catalogs_.end()) ||
+      (iter->second.hash != catalog_hash))
+  {
+    LogCvmfs(kLogCvmfs, kLogStderr, "catalog %s at %s was not inspected",
+             catalog_hash.ToString().c_str(), path == "" ? "/" : path.c_str());
+    return false;
+  }
+  const CatalogInfo &info = iter->second;
+  bool retval = info.is_consistent;
+
+  if ((catalog_size > 0) && (info.file_size != catalog_size)) {
+    LogCvmfs(kLogCvmfs, kLogStderr, "catalog file size mismatch, "
+             "expected %" PRIu64 ", got %" PRIu64,
+             catalog_size, info.file_size);
+    retval = false;
+  }
+
+  // Check transition point
+  if (is_nested_catalog) {
+    if (transition_point != NULL &&
+        !CompareEntries(*transition_point, info.root_entry, true, true)) {
+      LogCvmfs(kLogCvmfs, kLogStderr,
+               "transition point and root entry differ (%s)", path.c_str());
+      retval = false;
+    }
+    if (!info.root_entry.IsNestedCatalogRoot()) {
+      LogCvmfs(kLogCvmfs, kLogStderr,
+               "nested catalog root expected but not found (%s)", path.c_str());
+      retval = false;
+    }
+  } else {
+    if (info.root_entry.IsNestedCatalogRoot()) {
+      LogCvmfs(kLogCvmfs, kLogStderr,
+               "nested catalog root found but not expected (%s)", path.c_str());
+      retval = false;
+    }
+  }
+
+  // Recurse into nested catalogs
+  *computed_counters = info.computed_counters;
+  for (unsigned i = 0; i < info.nested_catalogs.size(); ++i) {
+    const NestedInfo &nested = info.nested_catalogs[i];
+    catalog::DeltaCounters nested_counters;
+    const bool is_nested = true;
+    if (!InspectHierarchy(nested.path, nested.hash, nested.size, is_nested,
+                          &nested.transition_point, &nested_counters))
+    {
+      retval = false;
+    }
+    nested_counters.PopulateToParent(computed_counters);
   }
 
   // Check statistics counters
-  // Additionally account for root directory
-  computed_counters->self.directories++;
   catalog::Counters compare_counters;
   compare_counters.ApplyDelta(*computed_counters);
-  const catalog::Counters stored_counters = catalog->GetCounters();
-  if (!CompareCounters(compare_counters, stored_counters)) {
+  if (!CompareCounters(compare_counters, info.stored_counters)) {
     LogCvmfs(kLogCvmfs, kLogStderr, "statistics counter mismatch [%s]",
              catalog_hash.ToString().c_str());
     retval = false;
   }
 
-  delete catalog;
   return retval;
 }
 
@@ -969,6 +1155,13 @@ int CommandCheck::Main(const swissknife::ArgumentList &args) {
     subtree_path = MakeCanonicalPath(*args.find('s')->second);
   if (args.find('R') != args.end())
     reflog_chksum_path = *args.find('R')->second;
+  if (args.find('j') != args.end()) {
+    num_threads_ = String2Uint64(*args.find('j')->second);
+    if (num_threads_ == 0) {
+      LogCvmfs(kLogCvmfs, kLogStderr, "invalid number of threads");
+      return 1;
+    }
+  }
 
   // Repository can be HTTP address or on local file system
   is_remote_ = IsHttpUrl(repo_base_path_);
@@ -977,7 +1170,7 @@ int CommandCheck::Main(const swissknife::ArgumentList &args) {
   if (is_remote_) {
     const bool follow_redirects = (args.count('L') > 0);
     const string proxy = (args.count('@') > 0) ? *args.find('@')->second : "";
-    if (!this->InitDownloadManager(follow_redirects, proxy)) {
+    if (!this->InitDownloadManager(follow_redirects, proxy, num_threads_)) {
       return 1;
     }
 
@@ -1129,13 +1322,52 @@ int CommandCheck::Main(const swissknife::ArgumentList &args) {
   }
 
 
-  catalog::DeltaCounters computed_counters;
-  successful = InspectTree(subtree_path,
-                           root_hash,
-                           root_size,
-                           is_nested_catalog,
-                           NULL,
-                           &computed_counters) && successful;
+  const uint64_t start_time = platform_monotonic_time_ns();
+  if (check_chunks_)
+    SpawnObjectCheckers();
+  bool traversed;
+  if (is_remote_) {
+    HttpObjectFetcher<> object_fetcher(repo_name, repo_base_path_,
+                                       temp_directory_, download_manager(),
+                                       signature_manager());
+    traversed = TraverseCatalogs(&object_fetcher, subtree_path, root_hash);
+  } else {
+    // The current working directory is the repository
+    LocalObjectFetcher<> object_fetcher(".", temp_directory_);
+    traversed = TraverseCatalogs(&object_fetcher, subtree_path, root_hash);
+  }
+  if (check_chunks_) {
+    LogCvmfs(kLogCvmfs, kLogStdout,
+             "catalog traversal finished, waiting for the object checks");
+    TerminateObjectCheckers();
+  }
+
+  if (traversed) {
+    catalog::DeltaCounters computed_counters;
+    successful = InspectHierarchy(subtree_path,
+                                  root_hash,
+                                  root_size,
+                                  is_nested_catalog,
+                                  NULL,
+                                  &computed_counters) && successful;
+  } else {
+    LogCvmfs(kLogCvmfs, kLogStderr, "failed to traverse catalogs");
+    successful = false;
+  }
+  if (atomic_read64(&num_missing_objects_) > 0)
+    successful = false;
+
+  const double elapsed_s =
+    static_cast<double>(platform_monotonic_time_ns() - start_time) / 1e9;
+  const int64_t num_entries = atomic_read64(&num_entries_);
+  const int64_t num_objects = atomic_read64(&num_objects_);
+  LogCvmfs(kLogCvmfs, kLogStdout,
+           "inspected %" PRId64 " catalogs with %" PRId64 " entries and "
+           "%" PRId64 " objects in %.1f seconds "
+           "(%.0f entries/s, %.0f objects/s)",
+           atomic_read64(&num_catalogs_), num_entries, num_objects, elapsed_s,
+           (elapsed_s > 0) ? num_entries / elapsed_s : 0.0,
+           (elapsed_s > 0) ? num_objects / elapsed_s : 0.0);
 
   if (!successful) {
     LogCvmfs(kLogCvmfs, kLogStderr, "CATALOG PROBLEMS OR OTHER ERRORS FOUND");
@@ -5,13 +5,19 @@
 #ifndef CVMFS_SWISSKNIFE_CHECK_H_
 #define CVMFS_SWISSKNIFE_CHECK_H_
 
+#include <pthread.h>
+
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "catalog.h"
 #include "crypto/hash.h"
+#include "ingestion/tube.h"
 #include "smallhash.h"
 #include "swissknife.h"
+#include "util/atomic.h"
 
 namespace download {
 class DownloadManager;
@@ -28,10 +34,13 @@ class Manifest;
 
 namespace swissknife {
 
+template <class CatalogT>
+struct CatalogTraversalData;
+
 class CommandCheck : public Command {
  public:
   CommandCheck();
-  ~CommandCheck() { }
+  ~CommandCheck();
   virtual std::string GetName() const { return "check"; }
   virtual std::string GetDescription() const {
     return "CernVM File System repository sanity checker\n"
@@ -50,6 +59,8 @@ class CommandCheck : public Command {
     r.push_back(Parameter::Optional('N', "name of the repository"));
     r.push_back(Parameter::Optional('R', "path to reflog.chksum file"));
     r.push_back(Parameter::Optional('@', "proxy url"));
+    r.push_back(Parameter::Optional('j', "number of concurrent threads "
+                                         "(default: 8)"));
     r.push_back(Parameter::Switch('c', "check availability of data chunks"));
     r.push_back(Parameter::Switch('d', "don't use hashmap to avoid duplicated"
                                       " lookups. Note that this is a fallback"
@@ -60,12 +71,74 @@ class CommandCheck : public Command {
   int Main(const ArgumentList &args);
 
  protected:
-  bool InspectTree(const std::string               &path,
-                   const shash::Any                &catalog_hash,
-                   const uint64_t                   catalog_size,
-                   const bool                       is_nested_catalog,
-                   const catalog::DirectoryEntry  *transition_point,
-                   catalog::DeltaCounters         *computed_counters);
+  /**
+   * An object in the data store whose existence needs to be verified.  The
+   * remaining fields are only used to report a missing object.
+   */
+  struct PendingObject {
+    PendingObject(const std::string &object_path,
+                  const shash::Any &hash,
+                  const std::string &file_path)
+      : object_path(object_path)
+      , hash(hash)
+      , file_path(file_path)
+      , is_partial(false)
+      , offset(0)
+      , size(0)
+    { }
+
+    std::string object_path;
+    shash::Any hash;
+    std::string file_path;
+    bool is_partial;
+    off_t offset;
+    size_t size;
+  };
+  typedef std::vector<PendingObject> ObjectBatch;
+
+  /**
+   * Result of the inspection of a single catalog.  The checks that involve
+   * the parent catalog (transition points, catalog size, subtree counters) are
+   * done once all the catalogs have been inspected.
+   */
+  struct NestedInfo {
+    std::string path;
+    shash::Any hash;
+    uint64_t size;
+    catalog::DirectoryEntry transition_point;
+  };
+  struct CatalogInfo {
+    CatalogInfo() : file_size(0), is_consistent(true) { }
+
+    shash::Any hash;
+    uint64_t file_size;
+    bool is_consistent;
+    catalog::DirectoryEntry root_entry;
+    catalog::DeltaCounters computed_counters;
+    catalog::Counters stored_counters;
+    std::vector<NestedInfo> nested_catalogs;
+  };
+
+  template <class ObjectFetcherT>
+  bool TraverseCatalogs(ObjectFetcherT *object_fetcher,
+                        const std::string &root_path,
+                        const shash::Any &root_hash);
+  void InspectCatalog(
+    const CatalogTraversalData<catalog::Catalog> &data);
+  bool InspectHierarchy(const std::string             &path,
+                        const shash::Any              &catalog_hash,
+                        const uint64_t                 catalog_size,
+                        const bool                     is_nested_catalog,
+                        const catalog::DirectoryEntry *transition_point,
+                        catalog::DeltaCounters        *computed_counters);
+  bool NeedsObjectCheck(const shash::Any &hash);
+  void ScheduleObjectCheck(const PendingObject &object, ObjectBatch *batch);
+  void FlushObjectBatch(ObjectBatch *batch);
+  void SpawnObjectCheckers();
+  void TerminateObjectCheckers();
+  static void *MainObjectChecker(void *data);
+  void CheckObject(const PendingObject &object);
+
   catalog::Catalog* FetchCatalog(const std::string  &path,
                                  const shash::Any   &catalog_hash,
                                  const uint64_t      catalog_size = 0);
@@ -82,7 +155,8 @@ class CommandCheck : public Command {
   bool Find(const catalog::Catalog *catalog,
             const PathString &path,
             catalog::DeltaCounters *computed_counters,
-            std::set<PathString> *bind_mountpoints);
+            std::set<PathString> *bind_mountpoints,
+            ObjectBatch *pending_objects);
   bool Exists(const std::string &file);
   bool CompareCounters(const catalog::Counters &a,
                        const catalog::Counters &b);
@@ -92,12 +166,40 @@ class CommandCheck : public Command {
                       const bool is_transition_point = false);
 
  private:
+  /**
+   * Number of object existence checks handed over to the checker threads at
+   * once
+   */
+  static const unsigned kObjectBatchSize = 128;
+  /**
+   * Maximum number of queued batches before catalog inspection blocks
+   */
+  static const unsigned kMaxPendingBatches = 256;
+  /**
+   * The checker threads report progress every so many checked objects
+   */
+  static const unsigned kObjectProgressInterval = 10000;
+
   std::string temp_directory_;
   std::string repo_base_path_;
   bool        check_chunks_;
   bool        no_duplicates_map_;
   bool        is_remote_;
+  unsigned    num_threads_;
   SmallHashDynamic<shash::Any, char> duplicates_map_;
+  pthread_mutex_t lock_duplicates_map_;
+
+  std::map<std::string, CatalogInfo> inspected_catalogs_;
+  pthread_mutex_t lock_inspected_catalogs_;
+
+  Tube<ObjectBatch> pending_batches_;
+  std::vector<pthread_t> object_checkers_;
+
+  // Progress and throughput
+  atomic_int64 num_catalogs_;
+  atomic_int64 num_entries_;
+  atomic_int64 num_objects_;
+  atomic_int64 num_missing_objects_;
 };
 
 }  // namespace swissknife
@@ -164,10 +164,12 @@ int swissknife::CommandGraft::Main(const swissknife::ArgumentList &args) {
   hash_alg_ = (args.find('a') == args.end())
                   ? shash::kSha1
                   : shash::ParseHashAlgorithm(*args.find('a')->second);
+  compression_level_ = 0;
   compression_alg_ =
       (args.find('Z') == args.end())
           ? zlib::kNoCompression
-          : zlib::ParseCompressionAlgorithm(*args.find('Z')->second);
+          : zlib::ParseCompressionAlgorithm(*args.find('Z')->second,
+                                            &compression_level_);
 
   if (args.find('c') == args.end()) {
     chunk_size_ = kDefaultChunkSize;
@@ -249,6 +251,7 @@ int swissknife::CommandGraft::Publish(const std::string &input_file,
   std::vector<uint64_t> chunk_offsets;
   std::vector<shash::Any> chunk_checksums;
   zlib::Compressor *compressor = zlib::Compressor::Construct(compression_alg_);
+  compressor->SetLevel(compression_level_);
 
   bool retval =
       ChecksumFdWithChunks(fd, compressor, &processed_size, &file_hash,
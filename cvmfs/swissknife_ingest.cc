@@ -66,7 +66,16 @@ int swissknife::Ingest::Main(const swissknife::ArgumentList &args) {
   }
   if (args.find('Z') != args.end()) {
     params.compression_alg =
-        zlib::ParseCompressionAlgorithm(*args.find('Z')->second);
+        zlib::ParseCompressionAlgorithm(*args.find('Z')->second,
+                                        &params.compression_level);
+  }
+  if (args.find('G') != args.end()) {
+    params.chunking_algorithm =
+        ParseChunkingAlgorithm(*args.find('G')->second);
+    if (params.chunking_algorithm == kChunkingUnknown) {
+      PrintError("unknown file chunking algorithm");
+      return 1;
+    }
   }
 
   bool create_catalog = args.find('C') != args.end();
@@ -100,6 +109,8 @@ int swissknife::Ingest::Main(const swissknife::ArgumentList &args) {
     spooler_definition.number_of_concurrent_uploads =
         params.max_concurrent_write_jobs;
   }
+  spooler_definition.compression_level = params.compression_level;
+  spooler_definition.chunking_algorithm = params.chunking_algorithm;
 
   // Sanitize base_directory, removing any leading or trailing slashes
   // from non-root (!= "/") paths
@@ -31,6 +31,7 @@
 #include "manifest.h"
 #include "manifest_fetch.h"
 #include "network/download.h"
+#include "network/sink_file.h"
 #include "object_fetcher.h"
 #include "path_filters/relaxed_path_filter.h"
 #include "reflog.h"
@@ -179,10 +180,10 @@ static void ReportDownloadError(const download::JobInfo &download_job) {
 static void Store(
   const string &local_path,
   const string &remote_path,
-  const bool compressed_src)
+  const zlib::Algorithms compression_alg)
 {
   if (preload_cache) {
-    if (!compressed_src) {
+    if (compression_alg == zlib::kNoCompression) {
       int retval = rename(local_path.c_str(), remote_path.c_str());
       if (retval != 0) {
         PANIC(kLogStderr, "Failed to move '%s' to '%s'", local_path.c_str(),
@@ -196,7 +197,13 @@ static void Store(
         PANIC(kLogStderr, "Failed to create temporary file '%s'",
               remote_path.c_str());
       }
-      int retval = zlib::DecompressPath2File(local_path, fdest);
+      FILE *fsrc = fopen(local_path.c_str(), "r");
+      if (fsrc == NULL) {
+        PANIC(kLogStderr, "Failed to open '%s'", local_path.c_str());
+      }
+      cvmfs::FileSink filesink(fdest);
+      int retval = zlib::DecompressFile2Sink(fsrc, compression_alg, &filesink);
+      fclose(fsrc);
       if (!retval) {
         PANIC(kLogStderr, "Failed to preload %s to %s", local_path.c_str(),
               remote_path.c_str());
@@ -214,9 +221,9 @@ static void Store(
 static void Store(
   const string &local_path,
   const shash::Any &remote_hash,
-  const bool compressed_src = true)
+  const zlib::Algorithms compression_alg = zlib::kZlibDefault)
 {
-  Store(local_path, MakePath(remote_hash), compressed_src);
+  Store(local_path, MakePath(remote_hash), compression_alg);
 }
 
 
@@ -234,7 +241,7 @@ static void StoreBuffer(const unsigned char *buffer, const unsigned size,
   }
   assert(retval);
   fclose(ftmp);
-  Store(tmp_file, dest_path, true);
+  Store(tmp_file, dest_path, zlib::kZlibDefault);
 }
 
 static void StoreBuffer(const unsigned char *buffer, const unsigned size,
@@ -286,8 +293,7 @@ static void *MainWorker(void *data) {
         PANIC(kLogStderr, "Download error");
       }
       fclose(fchunk);
-      Store(tmp_file, chunk_hash,
-            (compression_alg == zlib::kZlibDefault) ? true : false);
+      Store(tmp_file, chunk_hash, compression_alg);
       atomic_inc64(&overall_new);
     }
     if (atomic_xadd64(&overall_chunks, 1) % 1000 == 0)
@@ -643,6 +643,14 @@ int swissknife::CommandSync::Main(const swissknife::ArgumentList &args) {
       return 2;
     }
   }
+  if (args.find('G') != args.end()) {
+    params.chunking_algorithm =
+        ParseChunkingAlgorithm(*args.find('G')->second);
+    if (params.chunking_algorithm == kChunkingUnknown) {
+      PrintError("unknown file chunking algorithm");
+      return 1;
+    }
+  }
   if (args.find('O') != args.end()) {
     params.generate_legacy_bulk_chunks = true;
   }
@@ -656,7 +664,8 @@ int swissknife::CommandSync::Main(const swissknife::ArgumentList &args) {
   }
   if (args.find('Z') != args.end()) {
     params.compression_alg =
-        zlib::ParseCompressionAlgorithm(*args.find('Z')->second);
+        zlib::ParseCompressionAlgorithm(*args.find('Z')->second,
+                                        &params.compression_level);
   }
 
   if (args.find('C') != args.end()) {
@@ -699,6 +708,10 @@ int swissknife::CommandSync::Main(const swissknife::ArgumentList &args) {
     params.num_upload_tasks = String2Uint64(*args.find('0')->second);
   }
 
+  if (args.find('j') != args.end()) {
+    params.num_traversal_threads = String2Uint64(*args.find('j')->second);
+  }
+
   if (args.find('T') != args.end()) {
     params.ttl_seconds = String2Uint64(*args.find('T')->second);
   }
@@ -742,6 +755,8 @@ int swissknife::CommandSync::Main(const swissknife::ArgumentList &args) {
         params.max_concurrent_write_jobs;
   }
   spooler_definition.num_upload_tasks = params.num_upload_tasks;
+  spooler_definition.chunking_algorithm = params.chunking_algorithm;
+  spooler_definition.compression_level = params.compression_level;
 
   upload::SpoolerDefinition spooler_definition_catalogs(
       spooler_definition.Dup2DefaultCompression());
@@ -837,6 +852,7 @@ int swissknife::CommandSync::Main(const swissknife::ArgumentList &args) {
       return 4;
     }
 
+    sync->set_num_threads(params.num_traversal_threads);
     sync->Traverse();
   } else {
     assert(!manifest->history().IsNull());
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "compression.h"
+#include "ingestion/chunk_detector.h"
 #include "repository_tag.h"
 #include "swissknife.h"
 #include "upload.h"
@@ -31,6 +32,7 @@ struct SyncParameters {
         dry_run(false),
         mucatalogs(false),
         use_file_chunking(false),
+        chunking_algorithm(kChunkingXor32),
         generate_legacy_bulk_chunks(false),
         ignore_xdir_hardlinks(false),
         stop_for_catalog_tweaks(false),
@@ -42,6 +44,7 @@ struct SyncParameters {
         ignore_special_files(false),
         branched_catalog(false),
         compression_alg(zlib::kZlibDefault),
+        compression_level(0),
         enforce_limits(false),
         nested_kcatalog_limit(0),
         root_kcatalog_limit(0),
@@ -53,6 +56,7 @@ struct SyncParameters {
         ttl_seconds(0),
         max_concurrent_write_jobs(0),
         num_upload_tasks(1),
+        num_traversal_threads(1),
         is_balanced(false),
         max_weight(kDefaultMaxWeight),
         min_weight(kDefaultMinWeight),
@@ -81,6 +85,7 @@ struct SyncParameters {
   bool dry_run;
   bool mucatalogs;
   bool use_file_chunking;
+  ChunkingAlgorithms chunking_algorithm;
   bool generate_legacy_bulk_chunks;
   bool ignore_xdir_hardlinks;
   bool stop_for_catalog_tweaks;
@@ -92,6 +97,7 @@ struct SyncParameters {
   bool ignore_special_files;
   bool branched_catalog;
   zlib::Algorithms compression_alg;
+  int compression_level;
   bool enforce_limits;
   unsigned nested_kcatalog_limit;
   unsigned root_kcatalog_limit;
@@ -103,6 +109,7 @@ struct SyncParameters {
   uint64_t ttl_seconds;
   uint64_t max_concurrent_write_jobs;
   unsigned num_upload_tasks;
+  unsigned num_traversal_threads;
   bool is_balanced;
   unsigned max_weight;
   unsigned min_weight;
@@ -267,6 +274,8 @@ class CommandSync : public Command {
     r.push_back(Parameter::Optional('l', "minimal file chunk size in bytes"));
     r.push_back(Parameter::Optional('q', "number of concurrent write jobs"));
     r.push_back(Parameter::Optional('0', "number of upload tasks"));
+    r.push_back(Parameter::Optional('j', "number of scratch area traversal "
+                                         "threads"));
     r.push_back(Parameter::Optional('v', "manual revision number"));
     r.push_back(Parameter::Optional('z', "log level (0-4, default: 2)"));
     r.push_back(Parameter::Optional('C', "trusted certificates"));
@@ -285,6 +294,9 @@ class CommandSync : public Command {
     r.push_back(Parameter::Optional('Z',
                                     "compression algorithm "
                                     "(default: zlib)"));
+    r.push_back(Parameter::Optional('G',
+                                    "file chunking algorithm [xor32, gear] "
+                                    "(default: xor32)"));
     r.push_back(Parameter::Optional('S',
                                     "virtual directory options "
                                     "[snapshots, remove]"));
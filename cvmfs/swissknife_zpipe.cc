@@ -23,7 +23,9 @@
 #include <cassert>
 #include <cstring>
 
+#include "compression.h"
 #include "duplex_zlib.h"
+#include "network/sink_file.h"
 #include "swissknife_zpipe.h"
 
 #if defined(MSDOS) || defined(OS2) || defined(WIN32) || defined(__CYGWIN__)
@@ -189,6 +191,28 @@ int swissknife::CommandZpipe::Main(const swissknife::ArgumentList &args) {
     SET_BINARY_MODE(stdin);
     SET_BINARY_MODE(stdout);
 
+    /* algorithms other than zlib go through the Compressor classes */
+    if (args.find('a') != args.end()) {
+      int level;
+      const zlib::Algorithms alg =
+        zlib::ParseCompressionAlgorithm(*args.find('a')->second, &level);
+      if (alg != zlib::kZlibDefault) {
+        bool retval;
+        if (args.find('d') == args.end()) {
+          retval = zlib::CompressFile2File(stdin, stdout, alg, level);
+        } else {
+          cvmfs::FileSink sink(stdout);
+          retval = zlib::DecompressFile2Sink(stdin, alg, &sink);
+        }
+        if (!retval) {
+          fprintf(stderr, "zpipe: %s stream failed\n",
+                  zlib::AlgorithmName(alg).c_str());
+          return 1;
+        }
+        return 0;
+      }
+    }
+
     /* do compression if no arguments */
     if (args.find('d') == args.end()) {
         ret = def(stdin, stdout, Z_DEFAULT_COMPRESSION);
@@ -16,12 +16,15 @@ class CommandZpipe : public Command {
   ~CommandZpipe() { }
   virtual std::string GetName() const { return "zpipe"; }
   virtual std::string GetDescription() const {
-    return "Compresses or decompresses a file using the DEFLATE algorithm.\n"
+    return "Compresses or decompresses a file using the DEFLATE algorithm "
+      "or the one given by -a.\n"
       "Input comes on stdin, output goes to stdout.";
   }
   virtual ParameterList GetParams() const {
     ParameterList r;
     r.push_back(Parameter::Switch('d', "decompress file"));
+    r.push_back(Parameter::Optional('a', "algorithm (zlib, zstd[:level], lz4, "
+                                         "none)"));
     return r;
   }
   virtual int Main(const ArgumentList &args);
@@ -47,6 +47,8 @@ SyncMediator::SyncMediator(catalog::WritableCatalogManager *catalog_manager,
                                          : SyncDiffReporter::kPrintDots)) {
   int retval = pthread_mutex_init(&lock_file_queue_, NULL);
   assert(retval == 0);
+  retval = pthread_mutex_init(&lock_hardlinks_, NULL);
+  assert(retval == 0);
 
   params->spooler->RegisterListener(&SyncMediator::PublishFilesCallback, this);
 
@@ -55,6 +57,7 @@ SyncMediator::SyncMediator(catalog::WritableCatalogManager *catalog_manager,
 
 SyncMediator::~SyncMediator() {
   pthread_mutex_destroy(&lock_file_queue_);
+  pthread_mutex_destroy(&lock_hardlinks_);
 }
 
 
@@ -270,8 +273,10 @@ void SyncMediator::EnterDirectory(SharedPtr<SyncItem> entry) {
     return;
   }
 
-  HardlinkGroupMap new_map;
-  hardlink_stack_.push(new_map);
+  MutexLockGuard guard(&lock_hardlinks_);
+  const bool inserted = hardlink_maps_.insert(HardlinkGroupMapTable::value_type(
+    entry->GetRelativePath(), HardlinkGroupMap())).second;
+  assert(inserted);
 }
 
 
@@ -281,9 +286,19 @@ void SyncMediator::LeaveDirectory(SharedPtr<SyncItem> entry)
     return;
   }
 
+  const std::string directory = entry->GetRelativePath();
   CompleteHardlinks(entry);
-  AddLocalHardlinkGroups(GetHardlinkMap());
-  hardlink_stack_.pop();
+  AddLocalHardlinkGroups(GetHardlinkMap(directory));
+  MutexLockGuard guard(&lock_hardlinks_);
+  hardlink_maps_.erase(directory);
+}
+
+
+HardlinkGroupMap &SyncMediator::GetHardlinkMap(const std::string &directory) {
+  MutexLockGuard guard(&lock_hardlinks_);
+  HardlinkGroupMapTable::iterator i = hardlink_maps_.find(directory);
+  assert(i != hardlink_maps_.end());
+  return i->second;
 }
 
 
@@ -392,11 +407,13 @@ void SyncMediator::InsertHardlink(SharedPtr<SyncItem> entry) {
            inode, entry->GetUnionPath().c_str());
 
   // Find the hard link group in the lists
-  HardlinkGroupMap::iterator hardlink_group = GetHardlinkMap().find(inode);
+  HardlinkGroupMap &hardlink_map =
+    GetHardlinkMap(entry->relative_parent_path());
+  HardlinkGroupMap::iterator hardlink_group = hardlink_map.find(inode);
 
-  if (hardlink_group == GetHardlinkMap().end()) {
+  if (hardlink_group == hardlink_map.end()) {
     // Create a new hardlink group
-    GetHardlinkMap().insert(
+    hardlink_map.insert(
       HardlinkGroupMap::value_type(inode, HardlinkGroup(entry)));
   } else {
     // Append the file to the appropriate hardlink group
@@ -423,10 +440,12 @@ void SyncMediator::InsertLegacyHardlink(SharedPtr<SyncItem> entry) {
     return;
 
   uint64_t inode = entry->GetUnionInode();
+  HardlinkGroupMap &hardlink_map =
+    GetHardlinkMap(entry->relative_parent_path());
   HardlinkGroupMap::iterator hl_group;
-  hl_group = GetHardlinkMap().find(inode);
+  hl_group = hardlink_map.find(inode);
 
-  if (hl_group != GetHardlinkMap().end()) {  // touched hardlinks in this group?
+  if (hl_group != hardlink_map.end()) {  // touched hardlinks in this group?
     bool found = false;
 
     // search for the entry in this group
@@ -463,7 +482,7 @@ void SyncMediator::CompleteHardlinks(SharedPtr<SyncItem> entry) {
   assert(handle_hardlinks_);
 
   // If no hardlink in this directory was changed, we can skip this
-  if (GetHardlinkMap().empty())
+  if (GetHardlinkMap(entry->GetRelativePath()).empty())
     return;
 
   LogCvmfs(kLogPublish, kLogVerboseMsg, "Post-processing hard links in %s",
@@ -836,31 +855,31 @@ void SyncDiffReporter::OnStats(const catalog::DeltaCounters & /*delta*/) {}
 
 void SyncDiffReporter::OnAdd(const std::string &path,
                              const catalog::DirectoryEntry & /*entry*/) {
-  changed_items_++;
+  atomic_inc64(&changed_items_);
   AddImpl(path);
 }
 void SyncDiffReporter::OnRemove(const std::string &path,
                                 const catalog::DirectoryEntry & /*entry*/) {
-  changed_items_++;
+  atomic_inc64(&changed_items_);
   RemoveImpl(path);
 }
 void SyncDiffReporter::OnModify(const std::string &path,
                                 const catalog::DirectoryEntry & /*entry_from*/,
                                 const catalog::DirectoryEntry & /*entry_to*/) {
-  changed_items_++;
+  atomic_inc64(&changed_items_);
   ModifyImpl(path);
 }
 
 void SyncDiffReporter::CommitReport() {
   if (print_action_ == kPrintDots) {
-    if (changed_items_ >= processing_dot_interval_) {
+    if (atomic_read64(&changed_items_) >= processing_dot_interval_) {
       LogCvmfs(kLogPublish, kLogStdout, "");
     }
   }
 }
 
 void SyncDiffReporter::PrintDots() {
-  if (changed_items_ % processing_dot_interval_ == 0) {
+  if (atomic_read64(&changed_items_) % processing_dot_interval_ == 0) {
     LogCvmfs(kLogPublish, kLogStdout | kLogNoLinebreak, ".");
   }
 }
@@ -1009,7 +1028,12 @@ void SyncMediator::RemoveFile(SharedPtr<SyncItem> entry) {
   perf::Xadd(counters_->sz_removed_bytes, entry->GetRdOnlySize());
 }
 
+/**
+ * Adds only the directory itself.  Used if the caller takes care of the
+ * directory's contents, e.g. the parallel traversal of the scratch area.
+ */
 void SyncMediator::AddUnmaterializedDirectory(SharedPtr<SyncItem> entry) {
+  EnsureAllowed(entry);
   AddDirectory(entry);
 }
 
@@ -1119,10 +1143,12 @@ void SyncMediator::AddLocalHardlinkGroups(const HardlinkGroupMap &hardlinks) {
     if (params_->dry_run)
       continue;
 
-    if (i->second.master->IsSymlink() || i->second.master->IsSpecialFile())
+    if (i->second.master->IsSymlink() || i->second.master->IsSpecialFile()) {
       AddHardlinkGroup(i->second);
-    else
+    } else {
+      MutexLockGuard guard(&lock_hardlinks_);
       hardlink_queue_.push_back(i->second);
+    }
   }
 }
 
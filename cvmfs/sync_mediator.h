@@ -28,7 +28,6 @@
 
 #include <map>
 #include <set>
-#include <stack>
 #include <string>
 #include <vector>
 
@@ -39,6 +38,7 @@
 #include "statistics.h"
 #include "swissknife_sync.h"
 #include "sync_item.h"
+#include "util/atomic.h"
 #include "util/platform.h"
 #include "util/pointer.h"
 #include "util/shared_ptr.h"
@@ -60,8 +60,9 @@ class SyncDiffReporter : public DiffListener {
   explicit SyncDiffReporter(PrintAction print_action = kPrintChanges,
                             unsigned int processing_dot_interval = 100)
       : print_action_(print_action),
-        processing_dot_interval_(processing_dot_interval),
-        changed_items_(0) {}
+        processing_dot_interval_(processing_dot_interval) {
+    atomic_init64(&changed_items_);
+  }
 
   virtual void OnInit(const history::History::Tag &from_tag,
                       const history::History::Tag &to_tag);
@@ -84,7 +85,7 @@ class SyncDiffReporter : public DiffListener {
 
   PrintAction print_action_;
   unsigned int processing_dot_interval_;
-  unsigned int changed_items_;
+  atomic_int64 changed_items_;
 };
 
 /**
@@ -144,6 +145,10 @@ typedef std::map<uint64_t, HardlinkGroup> HardlinkGroupMap;
  * changes into the repository.
  * Furthermore it sends new and modified files to the spooler for compression
  * and hashing.
+ *
+ * The methods can be called concurrently for different directories, e.g. by a
+ * parallel traversal of the scratch area.  The entries of a single directory
+ * must be processed by a single thread.
  */
 class SyncMediator : public virtual AbstractSyncMediator {
  public:
@@ -178,7 +183,7 @@ class SyncMediator : public virtual AbstractSyncMediator {
   }
 
  private:
-  typedef std::stack<HardlinkGroupMap> HardlinkGroupMapStack;
+  typedef std::map<std::string, HardlinkGroupMap> HardlinkGroupMapTable;
   typedef std::vector<HardlinkGroup> HardlinkGroupList;
 
   void EnsureAllowed(SharedPtr<SyncItem> entry);
@@ -248,7 +253,7 @@ class SyncMediator : public virtual AbstractSyncMediator {
 
   // Hardlink handling
   void CompleteHardlinks(SharedPtr<SyncItem> entry);
-  HardlinkGroupMap &GetHardlinkMap() { return hardlink_stack_.top(); }
+  HardlinkGroupMap &GetHardlinkMap(const std::string &directory);
   void LegacyRegularHardlinkCallback(const std::string &parent_dir,
                                      const std::string &file_name);
   void LegacySymlinkHardlinkCallback(const std::string &parent_dir,
@@ -275,12 +280,17 @@ class SyncMediator : public virtual AbstractSyncMediator {
 
   /**
    * Hardlinks are supported as long as they all reside in the same directory.
-   * If a recursion enters a directory, we push an empty HardlinkGroupMap to
-   * keep track of the hardlinks of this directory.
-   * When leaving a directory (i.e. it is completely processed) the stack is
-   * popped and the HardlinkGroupMap is processed.
+   * If a recursion enters a directory, we register an empty HardlinkGroupMap
+   * for its relative path to keep track of the hardlinks of this directory.
+   * When leaving a directory (i.e. it is completely processed) the
+   * HardlinkGroupMap is processed and dropped.  The table is keyed by path
+   * rather than being a stack because several directories can be open at the
+   * same time in a parallel traversal.  The lock protects the table and the
+   * hardlink_queue_, the maps themselves belong to the thread that processes
+   * their directory.
    */
-  HardlinkGroupMapStack hardlink_stack_;
+  HardlinkGroupMapTable hardlink_maps_;
+  pthread_mutex_t lock_hardlinks_;
 
   /**
    * New and modified files are sent to an external spooler for hashing and
@@ -19,6 +19,7 @@ SyncUnion::SyncUnion(AbstractSyncMediator *mediator,
       scratch_path_(scratch_path),
       union_path_(union_path),
       mediator_(mediator),
+      num_threads_(1),
       initialized_(false) {}
 
 bool SyncUnion::Initialize() {
@@ -69,6 +70,11 @@ bool SyncUnion::ProcessDirectory(const string &parent_dir,
 
 bool SyncUnion::ProcessDirectory(SharedPtr<SyncItem> entry) {
   if (entry->IsNew()) {
+    if (num_threads_ > 1) {
+      // The parallel traversal continues into the new directory
+      mediator_->AddUnmaterializedDirectory(entry);
+      return true;
+    }
     mediator_->Add(entry);
     // Recursion stops here. All content of new directory
     // is added later by the SyncMediator
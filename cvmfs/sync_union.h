@@ -139,12 +139,23 @@ class SyncUnion {
   bool IsInitialized() const { return initialized_; }
   virtual bool SupportsHardlinks() const { return false; }
 
+  /**
+   * With more than one thread, Traverse() processes the directories of the
+   * scratch area concurrently.  New directories are then traversed as part of
+   * the scratch area instead of being recursed by the SyncMediator, so that
+   * large new subtrees are spread over the threads as well.
+   */
+  void set_num_threads(const unsigned num_threads) {
+    num_threads_ = num_threads;
+  }
+
  protected:
   std::string rdonly_path_;
   std::string scratch_path_;
   std::string union_path_;
 
   AbstractSyncMediator *mediator_;
+  unsigned num_threads_;
 
   /**
    * Allow for preprocessing steps before emitting any SyncItems from SyncUnion.
@@ -50,7 +50,10 @@ void SyncUnionAufs::Traverse() {
            "recursion for scratch_path=[%s] with external data set to %d",
            scratch_path().c_str(), mediator_->IsExternalData());
 
-  traversal.Recurse(scratch_path());
+  if (num_threads_ > 1)
+    traversal.RecurseParallel(scratch_path(), num_threads_);
+  else
+    traversal.Recurse(scratch_path());
 }
 
 bool SyncUnionAufs::IsWhiteoutEntry(SharedPtr<SyncItem> entry) const {
@@ -170,7 +170,10 @@ void SyncUnionOverlayfs::Traverse() {
            "OverlayFS starting traversal "
            "recursion for scratch_path=[%s]",
            scratch_path().c_str());
-  traversal.Recurse(scratch_path());
+  if (num_threads_ > 1)
+    traversal.RecurseParallel(scratch_path(), num_threads_);
+  else
+    traversal.Recurse(scratch_path());
 }
 
 /**
@@ -556,6 +556,28 @@ void *TalkManager::MainResponder(void *data) {
       mount_point->statistics()->Lookup("page_cache_tracker.n_open_cached")->
         Set(page_cache_stats.n_open_cached);
 
+      QuotaManager *quota_mgr = file_system->cache_mgr()->quota_mgr();
+      if (quota_mgr->HasCapability(QuotaManager::kCapIntrospectEviction)) {
+        QuotaManager::EvictionStatistics eviction_stats =
+          quota_mgr->GetEvictionStatistics();
+        mount_point->statistics()->Lookup("quota.n_cleanup")->Set(
+          eviction_stats.n_cleanup);
+        mount_point->statistics()->Lookup("quota.n_cleanup_early")->Set(
+          eviction_stats.n_cleanup_early);
+        mount_point->statistics()->Lookup("quota.n_evict")->Set(
+          eviction_stats.n_evict);
+        mount_point->statistics()->Lookup("quota.sz_evict")->Set(
+          eviction_stats.sz_evict);
+        mount_point->statistics()->Lookup("quota.n_stall")->Set(
+          eviction_stats.n_stall);
+        mount_point->statistics()->Lookup("quota.stall_time_ms")->Set(
+          eviction_stats.stall_time_ns / (1000 * 1000));
+        mount_point->statistics()->Lookup("quota.n_unlink")->Set(
+          eviction_stats.n_unlink);
+        mount_point->statistics()->Lookup("quota.n_unlink_pending")->Set(
+          eviction_stats.n_unlink_pending);
+      }
+
       if (file_system->cache_mgr()->id() == kPosixCacheManager) {
         PosixCacheManager *cache_mgr =
           reinterpret_cast<PosixCacheManager *>(
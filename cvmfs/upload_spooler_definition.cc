@@ -28,8 +28,10 @@ SpoolerDefinition::SpoolerDefinition(
     : driver_type(Unknown),
       hash_algorithm(hash_algorithm),
       compression_alg(compression_algorithm),
+      compression_level(0),
       generate_legacy_bulk_chunks(generate_legacy_bulk_chunks),
       use_file_chunking(use_file_chunking),
+      chunking_algorithm(kChunkingXor32),
       min_file_chunk_size(min_file_chunk_size),
       avg_file_chunk_size(avg_file_chunk_size),
       max_file_chunk_size(max_file_chunk_size),
@@ -77,6 +79,7 @@ SpoolerDefinition::SpoolerDefinition(
 SpoolerDefinition SpoolerDefinition::Dup2DefaultCompression() const {
   SpoolerDefinition result(*this);
   result.compression_alg = zlib::kZlibDefault;
+  result.compression_level = 0;
   return result;
 }
 
@@ -9,6 +9,7 @@
 
 #include "compression.h"
 #include "crypto/hash.h"
+#include "ingestion/chunk_detector.h"
 
 namespace upload {
 
@@ -66,12 +67,18 @@ struct SpoolerDefinition {
 
   shash::Algorithms hash_algorithm;
   zlib::Algorithms compression_alg;
+  /**
+   * Algorithm specific compression level, e.g. from "zstd:19".  Zero selects
+   * the default level of the algorithm.
+   */
+  int compression_level;
   /**
    * If a file is chunked, clients >= 2.1.7 do not need the bulk chunk.  We can
    * force creating the bulk chunks for backwards compatibility.
    */
   bool generate_legacy_bulk_chunks;
   bool use_file_chunking;
+  ChunkingAlgorithms chunking_algorithm;
   size_t min_file_chunk_size;
   size_t avg_file_chunk_size;
   size_t max_file_chunk_size;
@@ -0,0 +1,308 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#include "cvmfs_config.h"
+#include "uring.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+// IORING_OP_RENAMEAT was added together with IORING_FEAT_EXT_ARG (Linux 5.11)
+#ifdef IORING_FEAT_EXT_ARG
+#define CVMFS_HAS_IO_URING
+#endif
+#endif
+
+#include "util/exception.h"
+#include "util/logging.h"
+#include "util/pointer.h"
+#include "util/smalloc.h"
+
+using namespace std;  // NOLINT
+
+
+IoUring::IoUring()
+  : fd_(-1)
+  , depth_(0)
+  , num_prepared_(0)
+  , num_syscalls_(0)
+  , sq_ring_(MAP_FAILED)
+  , sq_ring_size_(0)
+  , cq_ring_(MAP_FAILED)
+  , cq_ring_size_(0)
+  , sqes_(MAP_FAILED)
+  , sqes_size_(0)
+  , sq_head_(NULL)
+  , sq_tail_(NULL)
+  , sq_mask_(NULL)
+  , sq_array_(NULL)
+  , cq_head_(NULL)
+  , cq_tail_(NULL)
+  , cq_mask_(NULL)
+  , cqes_(NULL)
+  , last_sqe_(NULL)
+{ }
+
+
+IoUring::~IoUring() {
+  if (sqes_ != MAP_FAILED)
+    munmap(sqes_, sqes_size_);
+  if ((cq_ring_ != MAP_FAILED) && (cq_ring_ != sq_ring_))
+    munmap(cq_ring_, cq_ring_size_);
+  if (sq_ring_ != MAP_FAILED)
+    munmap(sq_ring_, sq_ring_size_);
+  if (fd_ >= 0)
+    close(fd_);
+}
+
+
+bool IoUring::IsAvailable() {
+  IoUring *ring = Create(1);
+  delete ring;
+  return ring != NULL;
+}
+
+
+#ifdef CVMFS_HAS_IO_URING
+
+namespace {
+
+unsigned LoadAcquire(const unsigned *p) {
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned *p, const unsigned value) {
+  __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+/**
+ * Checks that the kernel supports all the operations used by IoUring
+ */
+bool ProbeOperations(const int fd) {
+  const unsigned kNumOps = 256;
+  const size_t size = sizeof(struct io_uring_probe) +
+                      kNumOps * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe *probe =
+    reinterpret_cast<struct io_uring_probe *>(smalloc(size));
+  memset(probe, 0, size);
+  const int retval =
+    syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, kNumOps);
+  bool result = (retval == 0);
+  const int ops[] = {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE,
+                     IORING_OP_RENAMEAT};
+  for (unsigned i = 0; result && (i < sizeof(ops) / sizeof(ops[0])); ++i) {
+    result = (ops[i] <= probe->last_op) &&
+             (probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED);
+  }
+  free(probe);
+  return result;
+}
+
+}  // anonymous namespace
+
+
+IoUring *IoUring::Create(const unsigned depth) {
+  assert(depth > 0);
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  UniquePtr<IoUring> ring(new IoUring());
+  ring->fd_ = syscall(__NR_io_uring_setup, depth, &params);
+  if (ring->fd_ < 0) {
+    LogCvmfs(kLogCache, kLogDebug, "io_uring not available (%d)", errno);
+    return NULL;
+  }
+  if (!ProbeOperations(ring->fd_)) {
+    LogCvmfs(kLogCache, kLogDebug, "io_uring lacks required operations");
+    return NULL;
+  }
+
+  ring->sq_ring_size_ =
+    params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size_ =
+    params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->sq_ring_size_ = ring->cq_ring_size_ =
+      std::max(ring->sq_ring_size_, ring->cq_ring_size_);
+  }
+  ring->sq_ring_ = mmap(NULL, ring->sq_ring_size_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring->fd_,
+                        IORING_OFF_SQ_RING);
+  if (ring->sq_ring_ == MAP_FAILED)
+    return NULL;
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->cq_ring_ = ring->sq_ring_;
+  } else {
+    ring->cq_ring_ = mmap(NULL, ring->cq_ring_size_, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, ring->fd_,
+                          IORING_OFF_CQ_RING);
+    if (ring->cq_ring_ == MAP_FAILED)
+      return NULL;
+  }
+  ring->sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes_ = mmap(NULL, ring->sqes_size_, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring->fd_, IORING_OFF_SQES);
+  if (ring->sqes_ == MAP_FAILED)
+    return NULL;
+
+  char *sq = reinterpret_cast<char *>(ring->sq_ring_);
+  ring->sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+  ring->sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+  ring->sq_mask_ = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+  ring->sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+  char *cq = reinterpret_cast<char *>(ring->cq_ring_);
+  ring->cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+  ring->cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+  ring->cq_mask_ = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+  ring->cqes_ = cq + params.cq_off.cqes;
+  ring->depth_ = std::min(depth, params.sq_entries);
+  return ring.Release();
+}
+
+
+void *IoUring::NextSqe(const uint8_t opcode, const int fd) {
+  if (num_prepared_ == depth_)
+    return NULL;
+  const unsigned idx = (*sq_tail_ + num_prepared_) & *sq_mask_;
+  struct io_uring_sqe *sqe =
+    reinterpret_cast<struct io_uring_sqe *>(sqes_) + idx;
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->user_data = num_prepared_;
+  sq_array_[idx] = idx;
+  num_prepared_++;
+  last_sqe_ = sqe;
+  return sqe;
+}
+
+
+bool IoUring::PrepRead(int fd, void *buf, uint32_t size, uint64_t offset) {
+  struct io_uring_sqe *sqe =
+    reinterpret_cast<struct io_uring_sqe *>(NextSqe(IORING_OP_READ, fd));
+  if (sqe == NULL)
+    return false;
+  sqe->addr = reinterpret_cast<uintptr_t>(buf);
+  sqe->len = size;
+  sqe->off = offset;
+  return true;
+}
+
+
+bool IoUring::PrepWrite(
+  int fd,
+  const void *buf,
+  uint32_t size,
+  uint64_t offset)
+{
+  struct io_uring_sqe *sqe =
+    reinterpret_cast<struct io_uring_sqe *>(NextSqe(IORING_OP_WRITE, fd));
+  if (sqe == NULL)
+    return false;
+  sqe->addr = reinterpret_cast<uintptr_t>(buf);
+  sqe->len = size;
+  sqe->off = offset;
+  return true;
+}
+
+
+bool IoUring::PrepClose(int fd) {
+  return NextSqe(IORING_OP_CLOSE, fd) != NULL;
+}
+
+
+bool IoUring::PrepRename(const char *oldpath, const char *newpath) {
+  struct io_uring_sqe *sqe = reinterpret_cast<struct io_uring_sqe *>(
+    NextSqe(IORING_OP_RENAMEAT, AT_FDCWD));
+  if (sqe == NULL)
+    return false;
+  sqe->addr = reinterpret_cast<uintptr_t>(oldpath);
+  sqe->len = AT_FDCWD;
+  sqe->addr2 = reinterpret_cast<uintptr_t>(newpath);
+  return true;
+}
+
+
+void IoUring::Link() {
+  assert(last_sqe_ != NULL);
+  reinterpret_cast<struct io_uring_sqe *>(last_sqe_)->flags |= IOSQE_IO_LINK;
+}
+
+
+int IoUring::Submit(vector<int> *results) {
+  const unsigned num_ops = num_prepared_;
+  results->assign(num_ops, -ECANCELED);
+  if (num_ops == 0)
+    return 0;
+  num_prepared_ = 0;
+  last_sqe_ = NULL;
+  const unsigned tail = *sq_tail_;
+  StoreRelease(sq_tail_, tail + num_ops);
+
+  unsigned num_submit = num_ops;
+  unsigned num_complete = 0;
+  while (num_complete < num_ops) {
+    const int retval = syscall(__NR_io_uring_enter, fd_, num_submit,
+                               num_ops - num_complete, IORING_ENTER_GETEVENTS,
+                               NULL, 0);
+    num_syscalls_++;
+    if (retval < 0) {
+      if (errno == EINTR)
+        continue;
+      if (num_submit == num_ops) {
+        // Nothing was consumed by the kernel, withdraw the operations
+        StoreRelease(sq_tail_, tail);
+        return -errno;
+      }
+      // Operations in flight reference the caller's buffers
+      PANIC(kLogSyslogErr | kLogDebug, "io_uring_enter failed (%d)", errno);
+    }
+    num_submit -= std::min(num_submit, static_cast<unsigned>(retval));
+
+    unsigned head = *cq_head_;
+    const unsigned cq_tail = LoadAcquire(cq_tail_);
+    for (; head != cq_tail; ++head) {
+      const struct io_uring_cqe *cqe =
+        reinterpret_cast<struct io_uring_cqe *>(cqes_) + (head & *cq_mask_);
+      assert(cqe->user_data < num_ops);
+      (*results)[cqe->user_data] = cqe->res;
+      num_complete++;
+    }
+    StoreRelease(cq_head_, head);
+  }
+  return 0;
+}
+
+#else  // CVMFS_HAS_IO_URING
+
+IoUring *IoUring::Create(const unsigned depth) { return NULL; }
+void *IoUring::NextSqe(const uint8_t opcode, const int fd) { return NULL; }
+bool IoUring::PrepRead(int fd, void *buf, uint32_t size, uint64_t offset) {
+  return false;
+}
+bool IoUring::PrepWrite(
+  int fd, const void *buf, uint32_t size, uint64_t offset)
+{
+  return false;
+}
+bool IoUring::PrepClose(int fd) { return false; }
+bool IoUring::PrepRename(const char *oldpath, const char *newpath) {
+  return false;
+}
+void IoUring::Link() { }
+int IoUring::Submit(vector<int> *results) {
+  results->clear();
+  return -ENOSYS;
+}
+
+#endif  // CVMFS_HAS_IO_URING
@@ -0,0 +1,95 @@
+/**
+ * This file is part of the CernVM File System.
+ */
+
+#ifndef CVMFS_URING_H_
+#define CVMFS_URING_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "util/single_copy.h"
+
+/**
+ * Thin wrapper around a Linux io_uring instance that is used synchronously:
+ * a caller prepares a batch of operations, optionally linked into a chain, and
+ * submits the batch with a single system call that returns once all the
+ * operations are complete.  The system calls are used directly so that there
+ * is no dependency on liburing.
+ *
+ * An IoUring object must not be used by multiple threads at the same time.
+ * Create() returns NULL if io_uring is not available, e.g. on old kernels, on
+ * kernels that lack the required operations, if disabled by seccomp, or if
+ * cvmfs was built without the io_uring header.
+ */
+class IoUring : SingleCopy {
+ public:
+  static IoUring *Create(const unsigned depth);
+  static bool IsAvailable();
+  ~IoUring();
+
+  /**
+   * The Prep* methods return false if the batch is full (depth operations).
+   */
+  bool PrepRead(int fd, void *buf, uint32_t size, uint64_t offset);
+  bool PrepWrite(int fd, const void *buf, uint32_t size, uint64_t offset);
+  bool PrepClose(int fd);
+  bool PrepRename(const char *oldpath, const char *newpath);
+  /**
+   * The next prepared operation only starts if the last prepared operation
+   * succeeded.  Otherwise, it completes with -ECANCELED.  Short reads and
+   * writes count as failures.
+   */
+  void Link();
+
+  /**
+   * Submits the prepared operations and waits for their completion.  The
+   * results are in order of preparation and have the semantics of the
+   * corresponding system call's return value, with -errno on failure.
+   * Returns 0 or -errno if the batch could not be submitted.
+   */
+  int Submit(std::vector<int> *results);
+
+  unsigned depth() const { return depth_; }
+  unsigned num_prepared() const { return num_prepared_; }
+  /**
+   * Number of io_uring_enter() calls so far
+   */
+  uint64_t num_syscalls() const { return num_syscalls_; }
+
+ private:
+  IoUring();
+  void *NextSqe(const uint8_t opcode, const int fd);
+
+  int fd_;
+  unsigned depth_;
+  unsigned num_prepared_;
+  uint64_t num_syscalls_;
+
+  /**
+   * Mapped submission and completion queue rings, with their sizes
+   */
+  void *sq_ring_;
+  uint64_t sq_ring_size_;
+  void *cq_ring_;
+  uint64_t cq_ring_size_;
+  void *sqes_;
+  uint64_t sqes_size_;
+
+  /**
+   * Pointers into the mapped rings, opaque to avoid including the kernel
+   * header here
+   */
+  unsigned *sq_head_;
+  unsigned *sq_tail_;
+  unsigned *sq_mask_;
+  unsigned *sq_array_;
+  unsigned *cq_head_;
+  unsigned *cq_tail_;
+  unsigned *cq_mask_;
+  void *cqes_;
+  void *last_sqe_;
+};
+
+#endif  // CVMFS_URING_H_
@@ -33,6 +33,15 @@ static int64_t inline __attribute__((used)) atomic_read64(atomic_int64 *a) {
   return __sync_fetch_and_add(a, 0);
 }
 
+/**
+ * Unlike atomic_read32(), does not use a locked read-modify-write instruction
+ * and thus does not take exclusive ownership of the cache line.  Meant for
+ * values that are read much more often than written.
+ */
+static int32_t inline __attribute__((used)) atomic_load32(atomic_int32 *a) {
+  return __atomic_load_n(a, __ATOMIC_SEQ_CST);
+}
+
 static void inline __attribute__((used))
 atomic_write32(atomic_int32 *a, int32_t value) {
   while (!__sync_bool_compare_and_swap(a, atomic_read32(a), value)) {
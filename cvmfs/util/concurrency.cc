@@ -8,6 +8,7 @@
 #include <unistd.h>
 
 #include <cassert>
+#include <cstdlib>
 
 #include "util/logging.h"
 
@@ -68,6 +69,142 @@ bool Signal::IsSleeping() {
   return fired_ == false;
 }
 
+
+//------------------------------------------------------------------------------
+
+
+ShardedRwLock::ShardedRwLock() {
+  void *shards;
+  int retval = posix_memalign(&shards, sizeof(Shard),
+                              kNumShards * sizeof(Shard));
+  assert((retval == 0) && "Out Of Memory");
+  shards_ = static_cast<Shard *>(shards);
+  for (unsigned i = 0; i < kNumShards; ++i)
+    atomic_init32(&shards_[i].readers);
+  atomic_init32(&next_shard_);
+  atomic_init32(&writer_active_);
+  retval = pthread_key_create(&tls_key_, NULL);
+  assert(retval == 0);
+  retval = pthread_mutex_init(&lock_writer_, NULL);
+  assert(retval == 0);
+  retval = pthread_mutex_init(&lock_wait_, NULL);
+  assert(retval == 0);
+  retval = pthread_cond_init(&cond_readers_, NULL);
+  assert(retval == 0);
+  retval = pthread_cond_init(&cond_writer_, NULL);
+  assert(retval == 0);
+}
+
+
+ShardedRwLock::~ShardedRwLock() {
+  assert(CountReaders() == 0);
+  pthread_cond_destroy(&cond_writer_);
+  pthread_cond_destroy(&cond_readers_);
+  pthread_mutex_destroy(&lock_wait_);
+  pthread_mutex_destroy(&lock_writer_);
+  pthread_key_delete(tls_key_);
+  free(shards_);
+}
+
+
+uintptr_t ShardedRwLock::GetThreadState() {
+  uintptr_t state =
+    reinterpret_cast<uintptr_t>(pthread_getspecific(tls_key_));
+  if (state == 0) {
+    state = (atomic_xadd32(&next_shard_, 1) % kNumShards) + 1;
+    SetThreadState(state);
+  }
+  return state;
+}
+
+
+void ShardedRwLock::SetThreadState(uintptr_t state) {
+  int retval = pthread_setspecific(tls_key_, reinterpret_cast<void *>(state));
+  assert(retval == 0);
+}
+
+
+int32_t ShardedRwLock::CountReaders() {
+  int32_t result = 0;
+  for (unsigned i = 0; i < kNumShards; ++i)
+    result += atomic_read32(&shards_[i].readers);
+  return result;
+}
+
+
+void ShardedRwLock::WakeupWriter() {
+  MutexLockGuard guard(lock_wait_);
+  int retval = pthread_cond_broadcast(&cond_writer_);
+  assert(retval == 0);
+}
+
+
+void ShardedRwLock::ReadLock() {
+  uintptr_t state = GetThreadState();
+  assert((state & kWriterBit) == 0);
+  if ((state >> kDepthShift) == 0) {
+    Shard *shard = &shards_[(state & kShardMask) - 1];
+    while (true) {
+      atomic_inc32(&shard->readers);
+      if (atomic_load32(&writer_active_) == 0)
+        break;
+
+      // Back off until the writer is done
+      atomic_dec32(&shard->readers);
+      WakeupWriter();
+      MutexLockGuard guard(lock_wait_);
+      while (atomic_load32(&writer_active_) != 0) {
+        int retval = pthread_cond_wait(&cond_readers_, &lock_wait_);
+        assert(retval == 0);
+      }
+    }
+  }
+  SetThreadState(state + (uintptr_t(1) << kDepthShift));
+}
+
+
+void ShardedRwLock::WriteLock() {
+  uintptr_t state = GetThreadState();
+  assert((state & ~kShardMask) == 0);
+  int retval = pthread_mutex_lock(&lock_writer_);
+  assert(retval == 0);
+  atomic_write32(&writer_active_, 1);
+  {
+    MutexLockGuard guard(lock_wait_);
+    while (CountReaders() > 0) {
+      retval = pthread_cond_wait(&cond_writer_, &lock_wait_);
+      assert(retval == 0);
+    }
+  }
+  SetThreadState(state | kWriterBit);
+}
+
+
+void ShardedRwLock::Unlock() {
+  uintptr_t state = GetThreadState();
+  if (state & kWriterBit) {
+    {
+      MutexLockGuard guard(lock_wait_);
+      atomic_write32(&writer_active_, 0);
+      int retval = pthread_cond_broadcast(&cond_readers_);
+      assert(retval == 0);
+    }
+    int retval = pthread_mutex_unlock(&lock_writer_);
+    assert(retval == 0);
+    SetThreadState(state & ~kWriterBit);
+    return;
+  }
+
+  assert((state >> kDepthShift) > 0);
+  state -= uintptr_t(1) << kDepthShift;
+  SetThreadState(state);
+  if ((state >> kDepthShift) == 0) {
+    atomic_dec32(&shards_[(state & kShardMask) - 1].readers);
+    if (atomic_load32(&writer_active_) != 0)
+      WakeupWriter();
+  }
+}
+
 #ifdef CVMFS_NAMESPACE_GUARD
 }  // namespace CVMFS_NAMESPACE_GUARD
 #endif
@@ -343,6 +343,73 @@ class CVMFS_EXPORT Signal : SingleCopy {
 //
 
 
+/**
+ * A reader-writer lock for read-mostly data.  Readers only increment a counter
+ * in one of several cache-line sized shards, so that concurrent readers on
+ * different cores do not contend on a shared lock word.  Writers are rare and
+ * expensive: they announce themselves and wait until all the shards are
+ * drained.  Pending writers are preferred over new readers.
+ *
+ * Read locks are recursive, write locks are not.  Unlock() releases whatever
+ * the calling thread holds.
+ */
+class CVMFS_EXPORT ShardedRwLock : SingleCopy {
+ public:
+  static const unsigned kNumShards = 64;
+
+  ShardedRwLock();
+  ~ShardedRwLock();
+  void ReadLock();
+  void WriteLock();
+  void Unlock();
+
+ private:
+  /**
+   * The per-thread state is encoded in the thread specific value of tls_key_:
+   * the shard index plus one in the lowest byte, the writer bit, and the read
+   * recursion depth in the remaining bits.  Zero means the thread has not yet
+   * been assigned a shard.
+   */
+  static const uintptr_t kShardMask = 0xFF;
+  static const uintptr_t kWriterBit = 0x100;
+  static const unsigned kDepthShift = 9;
+
+  struct Shard {
+    atomic_int32 readers;
+    char padding[64 - sizeof(atomic_int32)];
+  };
+
+  uintptr_t GetThreadState();
+  void SetThreadState(uintptr_t state);
+  int32_t CountReaders();
+  void WakeupWriter();
+
+  /**
+   * Allocated aligned to the cache line size, so that no two shards share a
+   * cache line
+   */
+  Shard *shards_;
+  atomic_int32 next_shard_;
+  atomic_int32 writer_active_;
+  pthread_key_t tls_key_;
+  /**
+   * Serializes writers
+   */
+  pthread_mutex_t lock_writer_;
+  /**
+   * Protects the wait on the two condition variables
+   */
+  pthread_mutex_t lock_wait_;
+  pthread_cond_t cond_readers_;
+  pthread_cond_t cond_writer_;
+};
+
+
+//
+// -----------------------------------------------------------------------------
+//
+
+
 /**
  * Asynchronous FIFO channel template
  * Implements a thread safe FIFO queue that handles thread blocking if the queue
@@ -9,16 +9,20 @@
 #define CVMFS_UTIL_FS_TRAVERSAL_H_
 
 #include <errno.h>
+#include <pthread.h>
 
 #include <cassert>
 #include <cstdlib>
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "util/async.h"
+#include "util/atomic.h"
 #include "util/exception.h"
 #include "util/logging.h"
+#include "util/mutex.h"
 #include "util/platform.h"
 
 #ifdef CVMFS_NAMESPACE_GUARD
@@ -32,6 +36,10 @@ namespace CVMFS_NAMESPACE_GUARD {
  *
  * Callbacks are called for every directory entry found by the recursion engine.
  * The recursion can be influenced by return values of these callbacks.
+ *
+ * RecurseParallel() distributes the directories over several worker threads.
+ * The entries of a directory are still processed by a single thread in
+ * readdir() order, but different directories are processed concurrently.
  */
 template <class T>
 class FileSystemTraversal {
@@ -110,6 +118,95 @@ class FileSystemTraversal {
    * @param dir_path The directory to start the recursion at
    */
   void Recurse(const std::string &dir_path) const {
+    AssertValid(dir_path);
+    DoRecursion(dir_path, "", NULL, NULL);
+  }
+
+  /**
+   * Start the recursion with num_threads worker threads.  Subdirectories
+   * selected by fn_new_dir_prefix are queued and picked up by the next idle
+   * worker.  fn_enter_dir and the callbacks for the entries of a directory are
+   * called by the worker that reads the directory.  fn_leave_dir and
+   * fn_new_dir_postfix are called once the directory and all its
+   * subdirectories are processed, possibly concurrently with the remaining
+   * entries of the parent directory.  Thus the delegate must be thread-safe.
+   * Returns when the entire tree is traversed.
+   * @param dir_path The directory to start the recursion at
+   * @param num_threads The number of worker threads
+   */
+  void RecurseParallel(const std::string &dir_path,
+                       const unsigned num_threads) const
+  {
+    AssertValid(dir_path);
+    assert(num_threads > 0);
+
+    ParallelState state;
+    state.traversal = this;
+    state.finished = false;
+    int retval = pthread_mutex_init(&state.lock, NULL);
+    assert(retval == 0);
+    retval = pthread_cond_init(&state.cond, NULL);
+    assert(retval == 0);
+    state.queue.push_back(new ParallelDirectory(dir_path, "", NULL));
+
+    std::vector<pthread_t> threads(num_threads);
+    for (unsigned i = 0; i < num_threads; ++i) {
+      retval = pthread_create(&threads[i], NULL, MainParallel, &state);
+      if (retval != 0)
+        PANIC(kLogStderr, "failed to create traversal thread (%d)", retval);
+    }
+    for (unsigned i = 0; i < num_threads; ++i)
+      pthread_join(threads[i], NULL);
+
+    assert(state.finished && state.queue.empty());
+    pthread_cond_destroy(&state.cond);
+    pthread_mutex_destroy(&state.lock);
+  }
+
+ private:
+  /**
+   * A directory of the parallel recursion.  The pending counter starts with
+   * one for the directory's own entries and is incremented for every queued
+   * subdirectory.  When it drops to zero, the directory is left.
+   */
+  struct ParallelDirectory {
+    ParallelDirectory(const std::string &p, const std::string &n,
+                      ParallelDirectory *up)
+      : parent_path(p), dir_name(n), parent(up)
+    {
+      atomic_init32(&pending);
+      atomic_inc32(&pending);
+    }
+    std::string parent_path;
+    std::string dir_name;
+    ParallelDirectory *parent;
+    atomic_int32 pending;
+  };
+
+  /**
+   * Shared by the workers of RecurseParallel().  The queue is used as a stack,
+   * so that the traversal stays roughly depth-first.
+   */
+  struct ParallelState {
+    const FileSystemTraversal<T> *traversal;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    std::vector<ParallelDirectory *> queue;
+    bool finished;
+  };
+
+  // The delegate all hooks are called on
+  T *delegate_;
+
+  /** dir_path in callbacks will be relative to this directory */
+  std::string relative_to_directory_;
+  bool recurse_;
+
+
+  void Init() {
+  }
+
+  void AssertValid(const std::string &dir_path) const {
     assert(fn_enter_dir != NULL ||
            fn_leave_dir != NULL ||
            fn_new_file != NULL ||
@@ -123,24 +220,64 @@ class FileSystemTraversal {
     assert(relative_to_directory_.length() == 0 ||
            dir_path.substr(0, relative_to_directory_.length()) ==
              relative_to_directory_);
-
-    DoRecursion(dir_path, "");
   }
 
- private:
-  // The delegate all hooks are called on
-  T *delegate_;
-
-  /** dir_path in callbacks will be relative to this directory */
-  std::string relative_to_directory_;
-  bool recurse_;
+  static void *MainParallel(void *data) {
+    ParallelState *state = reinterpret_cast<ParallelState *>(data);
+    while (true) {
+      ParallelDirectory *directory;
+      {
+        MutexLockGuard guard(&state->lock);
+        while (state->queue.empty() && !state->finished)
+          pthread_cond_wait(&state->cond, &state->lock);
+        if (state->queue.empty())
+          return NULL;
+        directory = state->queue.back();
+        state->queue.pop_back();
+      }
+      state->traversal->DoRecursion(directory->parent_path,
+                                    directory->dir_name, state, directory);
+    }
+  }
 
+  void Schedule(ParallelState *state, ParallelDirectory *directory) const {
+    atomic_inc32(&directory->parent->pending);
+    MutexLockGuard guard(&state->lock);
+    state->queue.push_back(directory);
+    pthread_cond_signal(&state->cond);
+  }
 
-  void Init() {
+  /**
+   * Drops a reference to the directory.  Leaving the last directory of a
+   * subtree can complete its parent directories in turn.
+   */
+  void Release(ParallelState *state, ParallelDirectory *directory) const {
+    while (directory != NULL) {
+      if (atomic_xadd32(&directory->pending, -1) != 1)
+        return;
+      Notify(fn_leave_dir, directory->parent_path, directory->dir_name);
+      ParallelDirectory *parent = directory->parent;
+      if (parent == NULL) {
+        MutexLockGuard guard(&state->lock);
+        state->finished = true;
+        pthread_cond_broadcast(&state->cond);
+      } else {
+        Notify(fn_new_dir_postfix, directory->parent_path,
+               directory->dir_name);
+      }
+      delete directory;
+      directory = parent;
+    }
   }
 
-  void DoRecursion(const std::string &parent_path, const std::string &dir_name)
-    const
+  /**
+   * Without a parallel state, subdirectories are recursed into right away.
+   * Otherwise they are scheduled for the worker threads.
+   */
+  void DoRecursion(const std::string &parent_path,
+                   const std::string &dir_name,
+                   ParallelState *state,
+                   ParallelDirectory *directory) const
   {
     DIR *dip;
     platform_dirent64 *dit;
@@ -187,7 +324,13 @@ class FileSystemTraversal {
         LogCvmfs(kLogFsTraversal, kLogVerboseMsg, "passing directory %s/%s",
                  path.c_str(), dit->d_name);
         if (Notify(fn_new_dir_prefix, path, dit->d_name) && recurse_) {
-          DoRecursion(path, dit->d_name);
+          if (state != NULL) {
+            // Postfix notification when the subdirectory is released
+            Schedule(state,
+                     new ParallelDirectory(path, dit->d_name, directory));
+            continue;
+          }
+          DoRecursion(path, dit->d_name, NULL, NULL);
         }
         Notify(fn_new_dir_postfix, path, dit->d_name);
       } else if (S_ISREG(info.st_mode)) {
@@ -224,6 +367,10 @@ class FileSystemTraversal {
     // Close directory and notify user
     closedir(dip);
     LogCvmfs(kLogFsTraversal, kLogVerboseMsg, "leaving %s", path.c_str());
+    if (state != NULL) {
+      Release(state, directory);
+      return;
+    }
     Notify(fn_leave_dir, parent_path, dir_name);
   }
 
@@ -16,12 +16,14 @@
 #include <limits.h>
 #include <mntent.h>
 #include <pthread.h>
+#include <sched.h>
 #include <signal.h>
 #include <sys/file.h>
 #include <sys/mount.h>
 #include <sys/prctl.h>
 #include <sys/select.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/utsname.h>
 #include <unistd.h>
 
@@ -163,6 +165,58 @@ inline void platform_spinlock_unlock(platform_spinlock *lock) {
  */
 inline pthread_t platform_gettid() { return pthread_self(); }
 
+/**
+ * The CPU the calling thread is currently running on; 0 if unknown.
+ */
+inline unsigned platform_getcpu() {
+  int cpu = sched_getcpu();
+  return (cpu < 0) ? 0 : cpu;
+}
+
+/**
+ * The NUMA node of the CPU the calling thread is currently running on; 0 if
+ * unknown.  The glibc wrapper (since 2.29) goes through the vDSO and does not
+ * enter the kernel.
+ */
+inline unsigned platform_getnode() {
+  unsigned cpu;
+  unsigned node;
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 29))
+  if (getcpu(&cpu, &node) != 0)
+    return 0;
+#else
+  if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0)
+    return 0;
+#endif
+  return node;
+}
+
+/**
+ * Number of NUMA nodes with memory, 1 if the system is not NUMA.  Nodes that
+ * are possible but not online are not counted.  The sysfs file contains a
+ * node list such as "0" or "0-3", so this is the highest node number plus one.
+ */
+inline unsigned platform_numa_nodes() {
+  FILE *f = fopen("/sys/devices/system/node/has_memory", "r");
+  if (f == NULL)
+    f = fopen("/sys/devices/system/node/online", "r");
+  if (f == NULL)
+    return 1;
+  unsigned max_node = 0;
+  unsigned node = 0;
+  int c;
+  while ((c = fgetc(f)) != EOF) {
+    if ((c >= '0') && (c <= '9')) {
+      node = node * 10 + (c - '0');
+      max_node = (node > max_node) ? node : max_node;
+    } else {
+      node = 0;
+    }
+  }
+  fclose(f);
+  return max_node + 1;
+}
+
 inline int platform_sigwait(const int signum) {
   sigset_t sigset;
   int retval = sigemptyset(&sigset);
@@ -129,6 +129,13 @@ inline void platform_spinlock_unlock(platform_spinlock *lock) {
  */
 inline thread_port_t platform_gettid() { return mach_thread_self(); }
 
+/**
+ * Not available on macOS.
+ */
+inline unsigned platform_getcpu() { return 0; }
+inline unsigned platform_getnode() { return 0; }
+inline unsigned platform_numa_nodes() { return 1; }
+
 inline int platform_sigwait(const int signum) {
   sigset_t sigset;
   int retval = sigemptyset(&sigset);
@@ -0,0 +1,3 @@
+#!/bin/sh
+
+# there is nothing to configure 
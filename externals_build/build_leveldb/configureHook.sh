@@ -0,0 +1,3 @@
+#!/bin/sh
+
+# Nothing to do
@@ -0,0 +1,48 @@
+/* $OpenBSD: progs.h,v 1.9 2019/11/04 15:25:54 jsing Exp $ */
+/* Public domain */
+
+int asn1parse_main(int argc, char **argv);
+int ca_main(int argc, char **argv);
+int certhash_main(int argc, char **argv);
+int ciphers_main(int argc, char **argv);
+int cms_main(int argc, char **argv);
+int crl2pkcs7_main(int argc, char **argv);
+int crl_main(int argc, char **argv);
+int dgst_main(int argc, char **argv);
+int dh_main(int argc, char **argv);
+int dhparam_main(int argc, char **argv);
+int dsa_main(int argc, char **argv);
+int dsaparam_main(int argc, char **argv);
+int ec_main(int argc, char **argv);
+int ecparam_main(int argc, char **argv);
+int enc_main(int argc, char **argv);
+int errstr_main(int argc, char **argv);
+int gendh_main(int argc, char **argv);
+int gendsa_main(int argc, char **argv);
+int genpkey_main(int argc, char **argv);
+int genrsa_main(int argc, char **argv);
+int nseq_main(int argc, char **argv);
+int ocsp_main(int argc, char **argv);
+int passwd_main(int argc, char **argv);
+int pkcs7_main(int argc, char **argv);
+int pkcs8_main(int argc, char **argv);
+int pkcs12_main(int argc, char **argv);
+int pkey_main(int argc, char **argv);
+int pkeyparam_main(int argc, char **argv);
+int pkeyutl_main(int argc, char **argv);
+int prime_main(int argc, char **argv);
+int rand_main(int argc, char **argv);
+int req_main(int argc, char **argv);
+int rsa_main(int argc, char **argv);
+int rsautl_main(int argc, char **argv);
+int s_client_main(int argc, char **argv);
+int s_server_main(int argc, char **argv);
+int s_time_main(int argc, char **argv);
+int sess_id_main(int argc, char **argv);
+int smime_main(int argc, char **argv);
+int speed_main(int argc, char **argv);
+int spkac_main(int argc, char **argv);
+int ts_main(int argc, char **argv);
+int verify_main(int argc, char **argv);
+int version_main(int argc, char **argv);
+int x509_main(int argc, char **argv);
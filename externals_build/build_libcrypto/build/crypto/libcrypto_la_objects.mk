@@ -0,0 +1,3 @@
+libcrypto_la_objects= $(abs_top_builddir)/crypto/aes/libcrypto_la-aes-elf-x86_64.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-bsaes-elf-x86_64.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-vpaes-elf-x86_64.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aesni-elf-x86_64.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aesni-sha1-elf-x86_64.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-modexp512-elf-x86_64.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-mont-elf-x86_64.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-mont5-elf-x86_64.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-gf2m-elf-x86_64.lo $(abs_top_builddir)/crypto/camellia/libcrypto_la-cmll-elf-x86_64.lo $(abs_top_builddir)/crypto/md5/libcrypto_la-md5-elf-x86_64.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-ghash-elf-x86_64.lo $(abs_top_builddir)/crypto/rc4/libcrypto_la-rc4-elf-x86_64.lo $(abs_top_builddir)/crypto/rc4/libcrypto_la-rc4-md5-elf-x86_64.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha1-elf-x86_64.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha256-elf-x86_64.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha512-elf-x86_64.lo $(abs_top_builddir)/crypto/whrlpool/libcrypto_la-wp-elf-x86_64.lo $(abs_top_builddir)/crypto/libcrypto_la-cpuid-elf-x86_64.lo $(abs_top_builddir)/crypto/libcrypto_la-cpt_err.lo $(abs_top_builddir)/crypto/libcrypto_la-cryptlib.lo $(abs_top_builddir)/crypto/libcrypto_la-crypto_init.lo $(abs_top_builddir)/crypto/libcrypto_la-crypto_lock.lo $(abs_top_builddir)/crypto/libcrypto_la-cversion.lo $(abs_top_builddir)/crypto/libcrypto_la-ex_data.lo $(abs_top_builddir)/crypto/libcrypto_la-malloc-wrapper.lo $(abs_top_builddir)/crypto/libcrypto_la-mem_clr.lo $(abs_top_builddir)/crypto/libcrypto_la-mem_dbg.lo $(abs_top_builddir)/crypto/libcrypto_la-o_fips.lo $(abs_top_builddir)/crypto/libcrypto_la-o_init.lo $(abs_top_builddir)/crypto/libcrypto_la-o_str.lo $(abs_top_builddir)/crypto/libcrypto_la-o_time.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_cfb.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_ctr.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_ecb.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_ige.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_misc.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_ofb.lo $(abs_top_builddir)/crypto/aes/libcrypto_la-aes_wrap.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_bitstr.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_enum.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_int.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_mbstr.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_object.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_octet.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_pkey.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_print.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_pubkey.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_strex.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_string.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_strnid.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_time.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_time_tm.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_type.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-a_utf8.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-ameth_lib.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_err.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_gen.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_item.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_lib.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_old.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_old_lib.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_par.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn1_types.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn_mime.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-asn_moid.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-bio_asn1.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-bio_ndef.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-nsseq.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-p5_pbe.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-p5_pbev2.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-p8_pkey.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-t_crl.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-t_pkey.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-t_req.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-t_spki.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-t_x509.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-t_x509a.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_dec.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_enc.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_fre.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_new.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_prn.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_typ.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-tasn_utl.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_algor.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_attrib.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_bignum.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_crl.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_exten.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_info.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_long.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_name.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_pkey.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_pubkey.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_req.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_sig.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_spki.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_val.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_x509.lo $(abs_top_builddir)/crypto/asn1/libcrypto_la-x_x509a.lo $(abs_top_builddir)/crypto/bf/libcrypto_la-bf_cfb64.lo $(abs_top_builddir)/crypto/bf/libcrypto_la-bf_ecb.lo $(abs_top_builddir)/crypto/bf/libcrypto_la-bf_enc.lo $(abs_top_builddir)/crypto/bf/libcrypto_la-bf_ofb64.lo $(abs_top_builddir)/crypto/bf/libcrypto_la-bf_skey.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-b_dump.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-b_posix.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-b_print.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-b_sock.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bf_buff.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bf_nbio.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bf_null.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bio_cb.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bio_err.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bio_lib.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bio_meth.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_acpt.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_bio.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_conn.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_dgram.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_fd.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_file.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_log.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_mem.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_null.lo $(abs_top_builddir)/crypto/bio/libcrypto_la-bss_sock.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_add.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_asm.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_blind.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_const.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_ctx.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_depr.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_div.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_err.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_exp.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_exp2.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_gcd.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_gf2m.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_kron.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_lib.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_mod.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_mont.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_mpi.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_mul.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_nist.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_prime.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_print.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_rand.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_recp.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_shift.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_sqr.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_sqrt.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_word.lo $(abs_top_builddir)/crypto/bn/libcrypto_la-bn_x931p.lo $(abs_top_builddir)/crypto/buffer/libcrypto_la-buf_err.lo $(abs_top_builddir)/crypto/buffer/libcrypto_la-buf_str.lo $(abs_top_builddir)/crypto/buffer/libcrypto_la-buffer.lo $(abs_top_builddir)/crypto/bytestring/libcrypto_la-bs_ber.lo $(abs_top_builddir)/crypto/bytestring/libcrypto_la-bs_cbb.lo $(abs_top_builddir)/crypto/bytestring/libcrypto_la-bs_cbs.lo $(abs_top_builddir)/crypto/camellia/libcrypto_la-cmll_cfb.lo $(abs_top_builddir)/crypto/camellia/libcrypto_la-cmll_ctr.lo $(abs_top_builddir)/crypto/camellia/libcrypto_la-cmll_ecb.lo $(abs_top_builddir)/crypto/camellia/libcrypto_la-cmll_misc.lo $(abs_top_builddir)/crypto/camellia/libcrypto_la-cmll_ofb.lo $(abs_top_builddir)/crypto/cast/libcrypto_la-c_cfb64.lo $(abs_top_builddir)/crypto/cast/libcrypto_la-c_ecb.lo $(abs_top_builddir)/crypto/cast/libcrypto_la-c_enc.lo $(abs_top_builddir)/crypto/cast/libcrypto_la-c_ofb64.lo $(abs_top_builddir)/crypto/cast/libcrypto_la-c_skey.lo $(abs_top_builddir)/crypto/chacha/libcrypto_la-chacha.lo $(abs_top_builddir)/crypto/cmac/libcrypto_la-cm_ameth.lo $(abs_top_builddir)/crypto/cmac/libcrypto_la-cm_pmeth.lo $(abs_top_builddir)/crypto/cmac/libcrypto_la-cmac.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_asn1.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_att.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_cd.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_dd.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_enc.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_env.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_err.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_ess.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_io.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_kari.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_lib.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_pwri.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_sd.lo $(abs_top_builddir)/crypto/cms/libcrypto_la-cms_smime.lo $(abs_top_builddir)/crypto/comp/libcrypto_la-c_rle.lo $(abs_top_builddir)/crypto/comp/libcrypto_la-c_zlib.lo $(abs_top_builddir)/crypto/comp/libcrypto_la-comp_err.lo $(abs_top_builddir)/crypto/comp/libcrypto_la-comp_lib.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_api.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_def.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_err.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_lib.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_mall.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_mod.lo $(abs_top_builddir)/crypto/conf/libcrypto_la-conf_sap.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_b64.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_err.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_log.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_oct.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_policy.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_prn.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_sct.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_sct_ctx.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_vfy.lo $(abs_top_builddir)/crypto/ct/libcrypto_la-ct_x509v3.lo $(abs_top_builddir)/crypto/curve25519/libcrypto_la-curve25519-generic.lo $(abs_top_builddir)/crypto/curve25519/libcrypto_la-curve25519.lo $(abs_top_builddir)/crypto/des/libcrypto_la-cbc_cksm.lo $(abs_top_builddir)/crypto/des/libcrypto_la-cbc_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-cfb64ede.lo $(abs_top_builddir)/crypto/des/libcrypto_la-cfb64enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-cfb_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-des_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-ecb3_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-ecb_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-ede_cbcm_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-enc_read.lo $(abs_top_builddir)/crypto/des/libcrypto_la-enc_writ.lo $(abs_top_builddir)/crypto/des/libcrypto_la-fcrypt.lo $(abs_top_builddir)/crypto/des/libcrypto_la-fcrypt_b.lo $(abs_top_builddir)/crypto/des/libcrypto_la-ofb64ede.lo $(abs_top_builddir)/crypto/des/libcrypto_la-ofb64enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-ofb_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-pcbc_enc.lo $(abs_top_builddir)/crypto/des/libcrypto_la-qud_cksm.lo $(abs_top_builddir)/crypto/des/libcrypto_la-rand_key.lo $(abs_top_builddir)/crypto/des/libcrypto_la-set_key.lo $(abs_top_builddir)/crypto/des/libcrypto_la-str2key.lo $(abs_top_builddir)/crypto/des/libcrypto_la-xcbc_enc.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_ameth.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_asn1.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_check.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_depr.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_err.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_gen.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_key.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_lib.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_pmeth.lo $(abs_top_builddir)/crypto/dh/libcrypto_la-dh_prn.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_ameth.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_asn1.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_depr.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_err.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_gen.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_key.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_lib.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_meth.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_ossl.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_pmeth.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_prn.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_sign.lo $(abs_top_builddir)/crypto/dsa/libcrypto_la-dsa_vrf.lo $(abs_top_builddir)/crypto/dso/libcrypto_la-dso_dlfcn.lo $(abs_top_builddir)/crypto/dso/libcrypto_la-dso_err.lo $(abs_top_builddir)/crypto/dso/libcrypto_la-dso_lib.lo $(abs_top_builddir)/crypto/dso/libcrypto_la-dso_null.lo $(abs_top_builddir)/crypto/dso/libcrypto_la-dso_openssl.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec2_mult.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec2_oct.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec2_smpl.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_ameth.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_asn1.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_check.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_curve.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_cvt.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_err.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_key.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_kmeth.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_lib.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_mult.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_oct.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_pmeth.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ec_print.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-eck_prn.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ecp_mont.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ecp_nist.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ecp_oct.lo $(abs_top_builddir)/crypto/ec/libcrypto_la-ecp_smpl.lo $(abs_top_builddir)/crypto/ecdh/libcrypto_la-ecdh_kdf.lo $(abs_top_builddir)/crypto/ecdh/libcrypto_la-ech_err.lo $(abs_top_builddir)/crypto/ecdh/libcrypto_la-ech_key.lo $(abs_top_builddir)/crypto/ecdh/libcrypto_la-ech_lib.lo $(abs_top_builddir)/crypto/ecdsa/libcrypto_la-ecs_asn1.lo $(abs_top_builddir)/crypto/ecdsa/libcrypto_la-ecs_err.lo $(abs_top_builddir)/crypto/ecdsa/libcrypto_la-ecs_lib.lo $(abs_top_builddir)/crypto/ecdsa/libcrypto_la-ecs_ossl.lo $(abs_top_builddir)/crypto/ecdsa/libcrypto_la-ecs_sign.lo $(abs_top_builddir)/crypto/ecdsa/libcrypto_la-ecs_vrf.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_all.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_cnf.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_ctrl.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_dyn.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_err.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_fat.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_init.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_lib.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_list.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_openssl.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_pkey.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-eng_table.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_asnmth.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_cipher.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_dh.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_digest.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_dsa.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_ecdh.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_ecdsa.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_eckey.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_pkmeth.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_rand.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_rsa.lo $(abs_top_builddir)/crypto/engine/libcrypto_la-tb_store.lo $(abs_top_builddir)/crypto/err/libcrypto_la-err.lo $(abs_top_builddir)/crypto/err/libcrypto_la-err_all.lo $(abs_top_builddir)/crypto/err/libcrypto_la-err_prn.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-bio_b64.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-bio_enc.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-bio_md.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-c_all.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-digest.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_aes.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_aes_cbc_hmac_sha1.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_bf.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_camellia.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_cast.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_chacha.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_chacha20poly1305.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_des.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_des3.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_gost2814789.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_idea.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_null.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_old.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_rc2.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_rc4.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_rc4_hmac_md5.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_sm4.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-e_xcbc_d.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-encode.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_aead.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_enc.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_err.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_key.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_lib.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_pbe.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-evp_pkey.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_gost2814789.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_gostr341194.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_md4.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_md5.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_md5_sha1.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_null.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_ripemd.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_sha1.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_sigver.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_streebog.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_sm3.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-m_wp.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-names.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p5_crpt.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p5_crpt2.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_dec.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_enc.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_lib.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_open.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_seal.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_sign.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-p_verify.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-pmeth_fn.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-pmeth_gn.lo $(abs_top_builddir)/crypto/evp/libcrypto_la-pmeth_lib.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost2814789.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost89_keywrap.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost89_params.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost89imit_ameth.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost89imit_pmeth.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost_asn1.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gost_err.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gostr341001.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gostr341001_ameth.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gostr341001_key.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gostr341001_params.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gostr341001_pmeth.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-gostr341194.lo $(abs_top_builddir)/crypto/gost/libcrypto_la-streebog.lo $(abs_top_builddir)/crypto/hkdf/libcrypto_la-hkdf.lo $(abs_top_builddir)/crypto/hmac/libcrypto_la-hm_ameth.lo $(abs_top_builddir)/crypto/hmac/libcrypto_la-hm_pmeth.lo $(abs_top_builddir)/crypto/hmac/libcrypto_la-hmac.lo $(abs_top_builddir)/crypto/idea/libcrypto_la-i_cbc.lo $(abs_top_builddir)/crypto/idea/libcrypto_la-i_cfb64.lo $(abs_top_builddir)/crypto/idea/libcrypto_la-i_ecb.lo $(abs_top_builddir)/crypto/idea/libcrypto_la-i_ofb64.lo $(abs_top_builddir)/crypto/idea/libcrypto_la-i_skey.lo $(abs_top_builddir)/crypto/lhash/libcrypto_la-lh_stats.lo $(abs_top_builddir)/crypto/lhash/libcrypto_la-lhash.lo $(abs_top_builddir)/crypto/md4/libcrypto_la-md4_dgst.lo $(abs_top_builddir)/crypto/md4/libcrypto_la-md4_one.lo $(abs_top_builddir)/crypto/md5/libcrypto_la-md5_dgst.lo $(abs_top_builddir)/crypto/md5/libcrypto_la-md5_one.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-cbc128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-ccm128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-cfb128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-ctr128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-cts128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-gcm128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-ofb128.lo $(abs_top_builddir)/crypto/modes/libcrypto_la-xts128.lo $(abs_top_builddir)/crypto/objects/libcrypto_la-o_names.lo $(abs_top_builddir)/crypto/objects/libcrypto_la-obj_dat.lo $(abs_top_builddir)/crypto/objects/libcrypto_la-obj_err.lo $(abs_top_builddir)/crypto/objects/libcrypto_la-obj_lib.lo $(abs_top_builddir)/crypto/objects/libcrypto_la-obj_xref.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_asn.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_cl.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_err.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_ext.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_ht.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_lib.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_prn.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_srv.lo $(abs_top_builddir)/crypto/ocsp/libcrypto_la-ocsp_vfy.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_all.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_err.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_info.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_lib.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_oth.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_pk8.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_pkey.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_sign.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_x509.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pem_xaux.lo $(abs_top_builddir)/crypto/pem/libcrypto_la-pvkfmt.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_add.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_asn.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_attr.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_crpt.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_crt.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_decr.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_init.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_key.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_kiss.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_mutl.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_npas.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_p8d.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_p8e.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-p12_utl.lo $(abs_top_builddir)/crypto/pkcs12/libcrypto_la-pk12err.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-bio_pk7.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pk7_asn1.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pk7_attr.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pk7_doit.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pk7_lib.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pk7_mime.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pk7_smime.lo $(abs_top_builddir)/crypto/pkcs7/libcrypto_la-pkcs7err.lo $(abs_top_builddir)/crypto/poly1305/libcrypto_la-poly1305.lo $(abs_top_builddir)/crypto/rand/libcrypto_la-rand_err.lo $(abs_top_builddir)/crypto/rand/libcrypto_la-rand_lib.lo $(abs_top_builddir)/crypto/rand/libcrypto_la-randfile.lo $(abs_top_builddir)/crypto/rc2/libcrypto_la-rc2_cbc.lo $(abs_top_builddir)/crypto/rc2/libcrypto_la-rc2_ecb.lo $(abs_top_builddir)/crypto/rc2/libcrypto_la-rc2_skey.lo $(abs_top_builddir)/crypto/rc2/libcrypto_la-rc2cfb64.lo $(abs_top_builddir)/crypto/rc2/libcrypto_la-rc2ofb64.lo $(abs_top_builddir)/crypto/ripemd/libcrypto_la-rmd_dgst.lo $(abs_top_builddir)/crypto/ripemd/libcrypto_la-rmd_one.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_ameth.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_asn1.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_chk.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_crpt.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_depr.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_eay.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_err.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_gen.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_lib.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_meth.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_none.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_oaep.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_pk1.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_pmeth.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_prn.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_pss.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_saos.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_sign.lo $(abs_top_builddir)/crypto/rsa/libcrypto_la-rsa_x931.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha1_one.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha1dgst.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha256.lo $(abs_top_builddir)/crypto/sha/libcrypto_la-sha512.lo $(abs_top_builddir)/crypto/sm3/libcrypto_la-sm3.lo $(abs_top_builddir)/crypto/sm4/libcrypto_la-sm4.lo $(abs_top_builddir)/crypto/stack/libcrypto_la-stack.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_asn1.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_conf.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_err.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_lib.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_req_print.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_req_utils.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_rsp_print.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_rsp_sign.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_rsp_utils.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_rsp_verify.lo $(abs_top_builddir)/crypto/ts/libcrypto_la-ts_verify_ctx.lo $(abs_top_builddir)/crypto/txt_db/libcrypto_la-txt_db.lo $(abs_top_builddir)/crypto/ui/libcrypto_la-ui_err.lo $(abs_top_builddir)/crypto/ui/libcrypto_la-ui_lib.lo $(abs_top_builddir)/crypto/ui/libcrypto_la-ui_openssl.lo $(abs_top_builddir)/crypto/ui/libcrypto_la-ui_util.lo $(abs_top_builddir)/crypto/whrlpool/libcrypto_la-wp_dgst.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-by_dir.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-by_file.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-by_mem.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-pcy_cache.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-pcy_data.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-pcy_lib.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-pcy_map.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-pcy_node.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-pcy_tree.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_addr.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_akey.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_akeya.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_alt.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_att.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_asid.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_bcons.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_bitst.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_cmp.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_conf.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_constraints.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_cpols.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_crld.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_d2.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_def.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_enum.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_err.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_ext.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_extku.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_genn.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_ia5.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_info.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_int.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_issuer_cache.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_lib.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_lu.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_ncons.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_obj.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_ocsp.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_pci.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_pcia.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_pcons.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_pku.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_pmaps.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_prn.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_purp.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_r2x.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_req.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_set.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_skey.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_sxnet.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_trs.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_txt.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_utl.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_v3.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_verify.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_vfy.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509_vpm.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509cset.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509name.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509rset.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509spki.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x509type.lo $(abs_top_builddir)/crypto/x509/libcrypto_la-x_all.lo
+libcompat_la_objects=  $(abs_top_builddir)/crypto/compat/strlcat.lo  $(abs_top_builddir)/crypto/compat/strlcpy.lo     $(abs_top_builddir)/crypto/compat/strtonum.lo   $(abs_top_builddir)/crypto/compat/freezero.lo   $(abs_top_builddir)/crypto/compat/getprogname_linux.lo      $(abs_top_builddir)/crypto/compat/recallocarray.lo  $(abs_top_builddir)/crypto/compat/syslog_r.lo  $(abs_top_builddir)/crypto/compat/timingsafe_memcmp.lo  $(abs_top_builddir)/crypto/compat/timingsafe_bcmp.lo          
+libcompatnoopt_la_objects= 